@@ -237,10 +237,21 @@ public:
 
     int64_t tileMb(int64_t i) const;
     int64_t tileNb(int64_t j) const;
+
+    int64_t tileRowOffset(int64_t i) const;
+    int64_t tileColOffset(int64_t j) const;
+    int64_t tileRowIndex(int64_t row) const;
+    int64_t tileColIndex(int64_t col) const;
+
 private:
     int64_t tileMbInternal(int64_t i) const;
     int64_t tileNbInternal(int64_t j) const;
 
+    int64_t tileRowOffsetInternal(int64_t i) const;
+    int64_t tileColOffsetInternal(int64_t j) const;
+    int64_t tileRowIndexInternal(int64_t row) const;
+    int64_t tileColIndexInternal(int64_t col) const;
+
 public:
     Tile<scalar_t>* tileInsert( int64_t i, int64_t j, int device=HostNum );
     Tile<scalar_t>* tileInsert( int64_t i, int64_t j, int device,
@@ -447,6 +458,12 @@ public:
     void tileRecv(int64_t i, int64_t j, int dst_rank,
                   Layout layout, int tag = 0);
 
+    void tileIsend(int64_t i, int64_t j, int dst_rank, int tag,
+                   MPI_Request* request);
+
+    void tileIrecv(int64_t i, int64_t j, int src_rank,
+                   Layout layout, int tag, MPI_Request* request);
+
     template <Target target = Target::Host>
     void tileBcast(int64_t i, int64_t j, BaseMatrix const& B,
                    Layout layout, int tag = 0, int64_t life_factor = 1);
@@ -533,6 +550,7 @@ protected:
     void tileIbcastToSet(int64_t i, int64_t j, std::set<int> const& bcast_set,
                         int radix, int tag, Layout layout,
                         std::vector<MPI_Request>& send_requests,
+                        std::list< std::vector<uint8_t> >& send_buffers,
                         Target target);
 
 public:
@@ -565,6 +583,50 @@ public:
         storage_->releaseWorkspace();
     }
 
+    //--------------------------------------------------------------------------
+    /// @return compression of tiles sent in broadcasts.
+    TileCompression tileCompression() const
+    {
+        return storage_->tile_compression_;
+    }
+
+    //--------------------------------------------------------------------------
+    /// @return relative error bound for TileCompression::Lossy.
+    double tileCompressionTolerance() const
+    {
+        return storage_->tile_compression_tol_;
+    }
+
+    //--------------------------------------------------------------------------
+    /// Sets compression of tiles sent in broadcasts, e.g., in gemm and
+    /// potrf, for the matrix and all its views. Must be the same on all
+    /// ranks.
+    ///
+    /// With TileCompression::Lossy, each element received is within a
+    /// relative error tolerance of the sent one,
+    /// $|a_{ij} - \tilde{a}_{ij}| \le$ tolerance $|a_{ij}|$,
+    /// for normalized numbers; tolerance must be positive.
+    /// WARNING: only receivers get the rounded values. The rank owning a
+    /// tile keeps it at full precision, so ranks compute with slightly
+    /// different copies of a broadcast tile, and results are not bitwise
+    /// reproducible across process grids. Use it only where such
+    /// differences are within the accuracy needed, e.g., for a
+    /// factorization that is then refined, as in gesvMixed.
+    ///
+    /// Packing runs at about 2-3 GB/s and unpacking at 1-3.5 GB/s per core,
+    /// so TileCompression::Lossless only reduces broadcast time on links
+    /// slower than about 2 GB/s per core, and only for data with
+    /// structure, e.g., smooth or sparse tiles. Tiles whose sample does
+    /// not compress are sent raw, costing little more than a copy.
+    ///
+    void tileCompression(TileCompression compression, double tolerance = 0)
+    {
+        slate_assert( compression != TileCompression::Lossy
+                      || tolerance > 0 );
+        storage_->tile_compression_ = compression;
+        storage_->tile_compression_tol_ = tolerance;
+    }
+
     void eraseLocalWorkspaceTile(int64_t i, int64_t j);
 
     void eraseLocalWorkspace();
@@ -802,7 +864,7 @@ BaseMatrix<scalar_t>::BaseMatrix(
       op_(Op::NoTrans),
       layout_(Layout::ColMajor),
       storage_(std::make_shared< MatrixStorage< scalar_t > >(
-          inTileMb, inTileNb, inTileRank, inTileDevice, mpi_comm)),
+          m, n, inTileMb, inTileNb, inTileRank, inTileDevice, mpi_comm)),
       mpi_comm_(mpi_comm)
 {
     // Count number of block rows.
@@ -1024,38 +1086,18 @@ BaseMatrix<scalar_t>::BaseMatrix(
     assert(col2 < n());
 
     // Map row indices (row1, row2) => block-row indices (i1, i2).
-    int64_t i1 = 0;
-    int64_t i2;
-    int64_t row = tileMb( i1 );  // past end of tile i1
-    while (row <= row1) {
-        ++i1;
-        row += tileMb( i1 );
-    }
-    int64_t new_row0_offset = row1 - (row - tileMb( i1 ));  // beginning of tile i1
-    i2 = i1;
-    while (row <= row2) {
-        ++i2;
-        row += tileMb( i2 );
-    }
-    int64_t new_last_mb = row2 - (row - tileMb( i2 )) + 1;
+    int64_t i1 = tileRowIndex( row1 );
+    int64_t i2 = std::max( i1, tileRowIndex( std::max( row1, row2 ) ) );
+    int64_t new_row0_offset = row1 - tileRowOffset( i1 );  // beginning of tile i1
+    int64_t new_last_mb = row2 - tileRowOffset( i2 ) + 1;
     if (i1 == i2)
         new_last_mb -= new_row0_offset;
 
     // Map col indices (col1, col2) => block-col indices (j1, j2).
-    int64_t j1 = 0;
-    int64_t j2;
-    int64_t col = tileNb( j1 );  // past end of tile j1
-    while (col <= col1) {
-        ++j1;
-        col += tileNb( j1 );
-    }
-    int64_t new_col0_offset = col1 - (col - tileNb( j1 ));  // beginning of tile j1
-    j2 = j1;
-    while (col <= col2) {
-        ++j2;
-        col += tileNb( j2 );
-    }
-    int64_t new_last_nb = col2 - (col - tileNb( j2 )) + 1;
+    int64_t j1 = tileColIndex( col1 );
+    int64_t j2 = std::max( j1, tileColIndex( std::max( col1, col2 ) ) );
+    int64_t new_col0_offset = col1 - tileColOffset( j1 );  // beginning of tile j1
+    int64_t new_last_nb = col2 - tileColOffset( j2 ) + 1;
     if (j1 == j2)
         new_last_nb -= new_col0_offset;
 
@@ -1146,14 +1188,10 @@ BaseMatrix<out_scalar_t> BaseMatrix<scalar_t>::baseEmptyLike(
     // Adjust size to include parent matrix outside this sub-matrix.
     int64_t ioffset = this->ioffset();
     int64_t joffset = this->joffset();
-    int64_t parent_m = m;
-    for (int i = 0; i < ioffset; ++i) {
-        parent_m += newMb(i);
-    }
-    int64_t parent_n = n;
-    for (int j = 0; j < joffset; ++j) {
-        parent_n += newNb(j);
-    }
+    int64_t parent_m = m + (mb != 0 ? mb * ioffset
+                                     : this->storage_->tileRowOffset(ioffset));
+    int64_t parent_n = n + (nb != 0 ? nb * joffset
+                                     : this->storage_->tileColOffset(joffset));
 
     // Create new parent matrix B.
     BaseMatrix<out_scalar_t> B;
@@ -1300,24 +1338,20 @@ Tile<scalar_t> BaseMatrix<scalar_t>::operator()(
 
 //------------------------------------------------------------------------------
 /// Returns number of rows in op(A).
+/// O(1), using the tile offsets precomputed in the matrix storage.
 template <typename scalar_t>
 int64_t BaseMatrix<scalar_t>::m() const
 {
-    int64_t sum = 0;
-    for (int64_t i = 0; i < mt(); ++i)
-        sum += tileMb(i);
-    return sum;
+    return tileRowOffset(mt());
 }
 
 //------------------------------------------------------------------------------
 /// Returns number of columns in op(A).
+/// O(1), using the tile offsets precomputed in the matrix storage.
 template <typename scalar_t>
 int64_t BaseMatrix<scalar_t>::n() const
 {
-    int64_t sum = 0;
-    for (int64_t j = 0; j < nt(); ++j)
-        sum += tileNb(j);
-    return sum;
+    return tileColOffset(nt());
 }
 
 //------------------------------------------------------------------------------
@@ -1414,6 +1448,146 @@ int64_t BaseMatrix<scalar_t>::tileNbInternal(int64_t j) const
         return storage_->tileNb(joffset_ + j);
 }
 
+//------------------------------------------------------------------------------
+/// Returns index of the first row of block row i of op(A),
+/// i.e., sum of tileMb(k) for k < i. O(1).
+///
+/// @param[in] i
+///     Tile's block row index. 0 <= i <= mt; i = mt returns m.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileRowOffset(int64_t i) const
+{
+    if (op_ == Op::NoTrans)
+        return tileRowOffsetInternal(i);
+    else
+        return tileColOffsetInternal(i);
+}
+
+//------------------------------------------------------------------------------
+/// Returns index of the first col of block col j of op(A),
+/// i.e., sum of tileNb(k) for k < j. O(1).
+///
+/// @param[in] j
+///     Tile's block column index. 0 <= j <= nt; j = nt returns n.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileColOffset(int64_t j) const
+{
+    if (op_ == Op::NoTrans)
+        return tileColOffsetInternal(j);
+    else
+        return tileRowOffsetInternal(j);
+}
+
+//------------------------------------------------------------------------------
+/// Returns block row of op(A) containing the given row. O(log mt).
+///
+/// @param[in] row
+///     Row index. 0 <= row < m.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileRowIndex(int64_t row) const
+{
+    if (op_ == Op::NoTrans)
+        return tileRowIndexInternal(row);
+    else
+        return tileColIndexInternal(row);
+}
+
+//------------------------------------------------------------------------------
+/// Returns block col of op(A) containing the given col. O(log nt).
+///
+/// @param[in] col
+///     Column index. 0 <= col < n.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileColIndex(int64_t col) const
+{
+    if (op_ == Op::NoTrans)
+        return tileColIndexInternal(col);
+    else
+        return tileRowIndexInternal(col);
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Returns first row of block row i of A,
+/// ignoring transposition, which is handled in tileRowOffset().
+/// This handles the first and last block rows for slicing,
+/// consistent with tileMbInternal().
+///
+/// @param[in] i
+///     Tile's block row index. 0 <= i <= mt_.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileRowOffsetInternal(int64_t i) const
+{
+    assert(0 <= i && i <= mt_);
+    if (i == 0)
+        return 0;
+    else if (i == mt_)
+        return tileRowOffsetInternal(mt_ - 1) + last_mb_;
+    else
+        return storage_->tileRowOffset(ioffset_ + i)
+               - storage_->tileRowOffset(ioffset_) - row0_offset_;
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Returns first col of block col j of A,
+/// ignoring transposition, which is handled in tileColOffset().
+/// This handles the first and last block cols for slicing,
+/// consistent with tileNbInternal().
+///
+/// @param[in] j
+///     Tile's block column index. 0 <= j <= nt_.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileColOffsetInternal(int64_t j) const
+{
+    assert(0 <= j && j <= nt_);
+    if (j == 0)
+        return 0;
+    else if (j == nt_)
+        return tileColOffsetInternal(nt_ - 1) + last_nb_;
+    else
+        return storage_->tileColOffset(joffset_ + j)
+               - storage_->tileColOffset(joffset_) - col0_offset_;
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Returns block row of A containing the given row,
+/// ignoring transposition, which is handled in tileRowIndex().
+///
+/// @param[in] row
+///     Row index in A.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileRowIndexInternal(int64_t row) const
+{
+    int64_t row0 = storage_->tileRowOffset(ioffset_) + row0_offset_;
+    int64_t i = storage_->tileRowIndex(row0 + row) - ioffset_;
+    return std::min(i, mt_ - 1);
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Returns block col of A containing the given col,
+/// ignoring transposition, which is handled in tileColIndex().
+///
+/// @param[in] col
+///     Column index in A.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::tileColIndexInternal(int64_t col) const
+{
+    int64_t col0 = storage_->tileColOffset(joffset_) + col0_offset_;
+    int64_t j = storage_->tileColIndex(col0 + col) - joffset_;
+    return std::min(j, nt_ - 1);
+}
+
 //------------------------------------------------------------------------------
 /// Insert tile {i, j} of op(A) and allocate its data.
 ///
@@ -1723,6 +1897,19 @@ void BaseMatrix<scalar_t>::tileModified(int64_t i, int64_t j, int device, bool p
 
     tile_instance.setState(MOSI::Modified);
 
+    // A generated tile (Matrix::fromGenerator) becomes an origin tile on the
+    // host when first modified, so it is kept and updated like any origin
+    // tile, instead of being released and regenerated.
+    if (storage_->tileGenerator && tileIsLocal(i, j)) {
+        if (! tile_node.existsOn( HostNum )) {
+            storage_->tileAcquire( globalIndex( i, j, HostNum ),
+                                   tile_instance.tile()->layout() );
+        }
+        Tile<scalar_t>* host_tile = tile_node[ HostNum ].tile();
+        if (host_tile->workspace())
+            host_tile->kind_ = TileKind::SlateOwned;
+    }
+
     for (int d = HostNum; d < num_devices(); ++d) {
         if (d != device && tile_node.existsOn(d)) {
             if (! permissive)
@@ -1829,6 +2016,102 @@ void BaseMatrix<scalar_t>::tileRecv(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Starts a nonblocking send of tile {i, j} of op(A) to the given MPI rank,
+/// on host. Destination rank must call tileRecv() or tileIrecv().
+/// The tile must not be modified before the request completes.
+///
+/// @param[in] i
+///     Tile's block row index. 0 <= i < mt.
+///
+/// @param[in] j
+///     Tile's block column index. 0 <= j < nt.
+///
+/// @param[in] dst_rank
+///     Destination MPI rank. If dst_rank == mpiRank, this is a no-op,
+///     and request is set to MPI_REQUEST_NULL.
+///
+/// @param[in] tag
+///     MPI tag.
+///
+/// @param[out] request
+///     MPI request to complete, e.g., with MPI_Waitall.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIsend(
+    int64_t i, int64_t j, int dst_rank, int tag, MPI_Request* request)
+{
+    if (dst_rank != mpiRank()) {
+        tileGetForReading(i, j, LayoutConvert::None);
+        at(i, j).isend(dst_rank, mpiComm(), tag, request);
+    }
+    else {
+        *request = MPI_REQUEST_NULL;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Starts a nonblocking receive of tile {i, j} of op(A) from the given
+/// MPI rank, on host. As in tileRecv(), the tile is allocated as workspace
+/// with life = 1 if it doesn't yet exist, or 1 is added to life if it does
+/// exist, and it is marked as modified on host.
+/// The tile must not be accessed before the request completes.
+/// Source rank must call tileSend() or tileIsend().
+///
+/// @param[in] i
+///     Tile's block row index. 0 <= i < mt.
+///
+/// @param[in] j
+///     Tile's block column index. 0 <= j < nt.
+///
+/// @param[in] src_rank
+///     Source MPI rank. If src_rank == mpiRank, this is a no-op,
+///     and request is set to MPI_REQUEST_NULL.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the received data.
+///     WARNING: must match the layout of the tile in the sender MPI rank.
+///
+/// @param[in] tag
+///     MPI tag.
+///
+/// @param[out] request
+///     MPI request to complete, e.g., with MPI_Waitall.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIrecv(
+    int64_t i, int64_t j, int src_rank, Layout layout, int tag,
+    MPI_Request* request)
+{
+    if (src_rank != mpiRank()) {
+        if (! tileIsLocal(i, j)) {
+            // Create tile to receive data, with life span.
+            // If tile already exists, add to its life span.
+            LockGuard guard(storage_->getTilesMapLock());
+            auto iter = storage_->find( globalIndex( i, j, HostNum ) );
+
+            int64_t life = 1;
+            if (iter == storage_->end())
+                tileInsertWorkspace( i, j, HostNum, layout );
+            else
+                life += tileLife(i, j);
+            tileLife(i, j, life);
+        }
+        else {
+            tileAcquire(i, j, layout);
+        }
+
+        // Start receiving data.
+        at(i, j).irecv(src_rank, mpiComm(), layout, tag, request);
+
+        tileLayout(i, j, layout);
+        tileModified( i, j, HostNum, true );
+    }
+    else {
+        *request = MPI_REQUEST_NULL;
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Send tile {i, j} of op(A) to all MPI ranks in matrix B.
 /// If target is Devices, also copies tile to all devices on each MPI rank.
@@ -1923,6 +2206,7 @@ void BaseMatrix<scalar_t>::listBcast(
     MPI_Comm_size(mpiComm(), &mpi_size);
 
     std::vector<MPI_Request> send_requests;
+    std::list< std::vector<uint8_t> > send_buffers;
 
     for (auto bcast : bcast_list) {
 
@@ -1961,7 +2245,8 @@ void BaseMatrix<scalar_t>::listBcast(
             // Send across MPI ranks.
             // Previous used MPI bcast: tileBcastToSet(i, j, bcast_set);
             // Currently uses 2D hypercube p2p send.
-            tileIbcastToSet(i, j, bcast_set, 2, tag, layout, send_requests, target);
+            tileIbcastToSet(i, j, bcast_set, 2, tag, layout, send_requests,
+                            send_buffers, target);
         }
 
         // Copy to devices.
@@ -2304,8 +2589,10 @@ void BaseMatrix<scalar_t>::tileBcastToSet(
 {
     std::vector<MPI_Request> requests;
     requests.reserve(radix);
+    std::list< std::vector<uint8_t> > buffers;
 
-    tileIbcastToSet(i, j, bcast_set, radix, tag, layout, requests, target);
+    tileIbcastToSet(i, j, bcast_set, radix, tag, layout, requests, buffers,
+                    target);
     slate_mpi_call(MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
 }
 
@@ -2317,6 +2604,9 @@ void BaseMatrix<scalar_t>::tileBcastToSet(
 /// This function implements a custom pattern using sends and receives.
 /// Data received must be in 'layout' (ColMajor/RowMajor) major.
 /// Nonblocking sends are used, with requests appended to the provided vector.
+/// If tileCompression() is enabled, host tiles are packed and sent as bytes.
+/// The root packs the tile once; other ranks forward the packed data as
+/// received, without packing it again.
 ///
 /// @param[in] i
 ///     Tile's block row index. 0 <= i < mt.
@@ -2339,11 +2629,17 @@ void BaseMatrix<scalar_t>::tileBcastToSet(
 /// @param[in,out] send_requests
 ///     Vector where requests for this bcast are appended.
 ///
+/// @param[in,out] send_buffers
+///     List where packed buffers for this bcast are appended, if
+///     tileCompression() is enabled. The caller must keep them until
+///     send_requests complete.
+///
 template <typename scalar_t>
 void BaseMatrix<scalar_t>::tileIbcastToSet(
     int64_t i, int64_t j, std::set<int> const& bcast_set,
     int radix, int tag, Layout layout,
     std::vector<MPI_Request>& send_requests,
+    std::list< std::vector<uint8_t> >& send_buffers,
     Target target)
 {
     // Quit if only root in the broadcast set.
@@ -2382,26 +2678,71 @@ void BaseMatrix<scalar_t>::tileIbcastToSet(
         }
     #endif
 
+    // Host tiles are packed with compression, if enabled.
+    TileCompression compression = tileCompression();
+    bool packed = device == HostNum && compression != TileCompression::None;
+    std::vector<uint8_t>* packed_buffer = nullptr;
+
     // Receive.
     if (! recv_from.empty()) {
         // read tile
         tileAcquire(i, j, device, layout);
 
-        at(i, j, device).recv(new_vec[recv_from.front()], mpi_comm_, layout, tag);
+        if (packed) {
+            auto Aij = at(i, j, device);
+            std::vector<uint8_t> buffer(Aij.packedMaxBytes());
+            slate_mpi_call(
+                MPI_Recv(buffer.data(), buffer.size(), MPI_BYTE,
+                         new_vec[recv_from.front()], tag, mpi_comm_,
+                         MPI_STATUS_IGNORE));
+            Aij.unpack(buffer.data(), layout);
+
+            // Keep the packed data to forward it as received.
+            if (! send_to.empty()) {
+                buffer.resize(internal::packed_bytes(buffer.data()));
+                send_buffers.push_back(std::move(buffer));
+                packed_buffer = &send_buffers.back();
+            }
+        }
+        else {
+            at(i, j, device).recv(new_vec[recv_from.front()], mpi_comm_, layout, tag);
+        }
         tileLayout(i, j, device, layout);
         tileModified(i, j, device, true);
     }
 
     if (! send_to.empty()) {
-        // read tile
-        tileGetForReading(i, j, device, LayoutConvert(layout));
-
-        auto Aij = at(i, j, device);
-        // Forward using multiple mpi_isend() calls
-        for (int dst : send_to) {
-            MPI_Request request;
-            Aij.isend(new_vec[dst], mpi_comm_, tag, &request);
-            send_requests.push_back(request);
+        if (packed) {
+            // Pack once for all destinations. The buffer is held by the
+            // caller until the sends complete.
+            if (packed_buffer == nullptr) {
+                tileGetForReading(i, j, device, LayoutConvert(layout));
+                send_buffers.emplace_back();
+                packed_buffer = &send_buffers.back();
+                at(i, j, device).pack(compression, tileCompressionTolerance(),
+                                      *packed_buffer);
+            }
+
+            for (int dst : send_to) {
+                MPI_Request request;
+                slate_mpi_call(
+                    MPI_Isend(packed_buffer->data(), packed_buffer->size(),
+                              MPI_BYTE, new_vec[dst], tag, mpi_comm_,
+                              &request));
+                send_requests.push_back(request);
+            }
+        }
+        else {
+            // read tile
+            tileGetForReading(i, j, device, LayoutConvert(layout));
+
+            // Forward using multiple mpi_isend() calls
+            auto Aij = at(i, j, device);
+            for (int dst : send_to) {
+                MPI_Request request;
+                Aij.isend(new_vec[dst], mpi_comm_, tag, &request);
+                send_requests.push_back(request);
+            }
         }
     }
 }
@@ -2720,6 +3061,8 @@ void BaseMatrix<scalar_t>::tileAcquire(int64_t i, int64_t j, int device,
 //------------------------------------------------------------------------------
 /// Gets tile(i, j) on device.
 /// Will copy-in the tile if it does not exist or its state is MOSI::Invalid.
+/// For a matrix with a tile generator (Matrix::fromGenerator), a local tile
+/// without any instance is generated first.
 /// Finds a source tile whose state is valid (Modified|Shared) by
 /// looping on existing tile instances.
 /// Updates source tile's state to shared if copied-in.
@@ -2769,6 +3112,9 @@ void BaseMatrix<scalar_t>::tileGet(int64_t i, int64_t j, int dst_device,
     const int invalid_dev = HostNum - 1; // invalid device number
     int src_device = invalid_dev;
 
+    // for a generated matrix, generate the tile if it has no instance
+    storage_->tileGenerate(globalIndex(i, j));
+
     // find tile on destination
     auto& tile_node = storage_->at(globalIndex(i, j));
     auto dst_tile_instance = &(tile_node[dst_device]);
@@ -3378,6 +3724,13 @@ void BaseMatrix<scalar_t>::tileGetAndHoldAllOnDevices(LayoutConvert layout)
 template <typename scalar_t>
 Tile<scalar_t>* BaseMatrix<scalar_t>::tileUpdateOrigin(int64_t i, int64_t j)
 {
+    // A generated tile that was never modified has no origin;
+    // its data is the generator's.
+    if (storage_->tileIsGenerated(globalIndex(i, j))) {
+        tileGetForReading(i, j, LayoutConvert::None);
+        return storage_->at(globalIndex(i, j))[ HostNum ].tile();
+    }
+
     auto& tile_node = storage_->at(globalIndex(i, j));
 
     LockGuard guard(tile_node.getLock());
@@ -3417,7 +3770,10 @@ void BaseMatrix<scalar_t>::tileUpdateAllOrigin()
     std::vector< std::set<ij_tuple> > tiles_set_dev(num_devices());
     for (int64_t j = 0; j < this->nt(); ++j) {
         for (int64_t i = 0; i < this->mt(); ++i) {
-            if (this->tileIsLocal(i, j)) {
+            // Skip generated tiles that were never modified; they have no
+            // origin to update.
+            if (this->tileIsLocal(i, j)
+                && ! storage_->tileIsGenerated(globalIndex(i, j))) {
                 // this->tileUpdateOrigin(i, j);
                 auto& tile_node = storage_->at(globalIndex(i, j));
 
@@ -4065,7 +4421,10 @@ std::tuple<int64_t, int64_t, int>
 template <typename scalar_t>
 void BaseMatrix<scalar_t>::eraseLocalWorkspaceTile(int64_t i, int64_t j)
 {
-    if (this->tileIsLocal( i, j )) {
+    // A generated tile may not have been used yet.
+    if (this->tileIsLocal( i, j )
+        && this->storage_->find( this->globalIndex( i, j ) )
+           != this->storage_->end()) {
         auto& tile_node = this->storage_->at( this->globalIndex( i, j ) );
 
         LockGuard guard( tile_node.getLock() );
@@ -13,6 +13,8 @@
 #include "lapack.hh"
 
 #include <algorithm>
+#include <functional>
+#include <string>
 #include <utility>
 
 #include "slate/internal/mpi.hh"
@@ -112,6 +114,22 @@ public:
         return fromDevices(m, n, Aarray, num_devices, lda, nb, nb, p, q, mpi_comm);
     }
 
+    //----------
+    static
+    Matrix fromMappedFile(int64_t m, int64_t n, int64_t mb, int64_t nb,
+                          int p, int q, const char* prefix,
+                          MPI_Comm mpi_comm);
+
+    //----------
+    static
+    Matrix fromGenerator(int64_t m, int64_t n, int64_t mb, int64_t nb,
+                         int p, int q,
+                         std::function<void (int64_t row, int64_t col,
+                                             int64_t mb, int64_t nb,
+                                             scalar_t* A, int64_t lda)>
+                             generator,
+                         MPI_Comm mpi_comm);
+
     //----------
     template <typename out_scalar_t=scalar_t>
     Matrix<out_scalar_t> emptyLike(int64_t mb=0, int64_t nb=0,
@@ -401,6 +419,147 @@ Matrix<scalar_t> Matrix<scalar_t>::fromDevices(
                             p, q, mpi_comm);
 }
 
+//------------------------------------------------------------------------------
+/// [static]
+/// Named constructor returns a new Matrix whose local tiles are in a
+/// memory-mapped file, one file per MPI rank, named `<prefix>.<rank>`.
+/// Creating the matrix does not read or copy any data: tiles point into the
+/// mapping, and the OS pages them in on first access and out when memory
+/// is tight. Writes to tiles go to the file.
+///
+/// Local tiles are stored in column-major order of tiles; each tile is
+/// column-major with leading dimension equal to its number of rows. This
+/// is the layout written by ooc_store, so a matrix stored for the
+/// out-of-core drivers can be mapped directly. The file is created or
+/// extended if it is shorter; new tiles read as zeros.
+///
+/// For a matrix shared between processes on a node, map files in a shared
+/// memory file system such as /dev/shm.
+///
+/// The mapping lives as long as the matrix storage, i.e., until the last
+/// shallow copy of the matrix is destroyed.
+///
+/// @param[in] m
+///     Number of rows of the matrix. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of the matrix. n >= 0.
+///
+/// @param[in] mb
+///     Row block size in 2D block-cyclic distribution. mb > 0.
+///
+/// @param[in] nb
+///     Column block size in 2D block-cyclic distribution. nb > 0.
+///
+/// @param[in] p
+///     Number of block rows in 2D block-cyclic distribution. p > 0.
+///
+/// @param[in] q
+///     Number of block columns of 2D block-cyclic distribution. q > 0.
+///
+/// @param[in] prefix
+///     Prefix of the file names; each rank maps `<prefix>.<rank>`.
+///
+/// @param[in] mpi_comm
+///     MPI communicator to distribute matrix across.
+///     p*q == MPI_Comm_size(mpi_comm).
+///
+template <typename scalar_t>
+Matrix<scalar_t> Matrix<scalar_t>::fromMappedFile(
+    int64_t m, int64_t n, int64_t mb, int64_t nb,
+    int p, int q, const char* prefix, MPI_Comm mpi_comm)
+{
+    Matrix<scalar_t> A( m, n, mb, nb, p, q, mpi_comm );
+
+    size_t size = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j ))
+                size += A.tileMb( i ) * A.tileNb( j ) * sizeof(scalar_t);
+        }
+    }
+
+    std::string filename
+        = std::string( prefix ) + "." + std::to_string( A.mpiRank() );
+    scalar_t* data = A.storage_->mapFile( filename.c_str(), size );
+
+    int64_t offset = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                A.tileInsert( i, j, HostNum, &data[ offset ], A.tileMb( i ) );
+                offset += A.tileMb( i ) * A.tileNb( j );
+            }
+        }
+    }
+    return A;
+}
+
+//------------------------------------------------------------------------------
+/// [static]
+/// Named constructor returns a new Matrix whose tiles are computed on
+/// demand by a user function, e.g., for a matrix defined by a kernel
+/// $a_{ij} = K(x_i, y_j)$, instead of being inserted and filled up front.
+///
+/// A local tile is generated, on the host, the first time it is read or
+/// written through tileGetForReading, tileGetForWriting, etc., which all
+/// SLATE routines use to access tiles, so generation overlaps with the
+/// computation on other tiles. Only tiles that are used are generated,
+/// e.g., only the local tiles of A( :, k1:k2 ) for A.sub( 0, mt-1, k1, k2 ).
+/// Generated tiles are workspace tiles: A.releaseWorkspace() frees them,
+/// and they are generated again if needed, so operating on a few block
+/// columns at a time, the full matrix need never be in memory.
+/// A tile becomes an origin tile when it is first modified, so routines
+/// that overwrite A, such as potrf, work in place on a generated matrix.
+///
+/// The generator fills a whole tile per call, so it can evaluate the
+/// kernel in vectorized batches. It is called concurrently for different
+/// tiles, so must be thread safe.
+///
+/// Tiles are not inserted, so accessing a tile directly with A( i, j )
+/// requires getting it first, e.g., with A.tileGetForReading.
+///
+/// @param[in] m
+///     Number of rows of the matrix. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of the matrix. n >= 0.
+///
+/// @param[in] mb
+///     Row block size in 2D block-cyclic distribution. mb > 0.
+///
+/// @param[in] nb
+///     Column block size in 2D block-cyclic distribution. nb > 0.
+///
+/// @param[in] p
+///     Number of block rows in 2D block-cyclic distribution. p > 0.
+///
+/// @param[in] q
+///     Number of block columns of 2D block-cyclic distribution. q > 0.
+///
+/// @param[in] generator
+///     Function generator( row, col, mb, nb, A, lda ) that fills the
+///     mb-by-nb column-major array A, with leading dimension lda, with
+///     the block of the matrix starting at global row and column indices
+///     row and col.
+///
+/// @param[in] mpi_comm
+///     MPI communicator to distribute matrix across.
+///     p*q == MPI_Comm_size(mpi_comm).
+///
+template <typename scalar_t>
+Matrix<scalar_t> Matrix<scalar_t>::fromGenerator(
+    int64_t m, int64_t n, int64_t mb, int64_t nb,
+    int p, int q,
+    std::function<void (int64_t row, int64_t col, int64_t mb, int64_t nb,
+                        scalar_t* A, int64_t lda)> generator,
+    MPI_Comm mpi_comm)
+{
+    Matrix<scalar_t> A( m, n, mb, nb, p, q, mpi_comm );
+    A.storage_->tileGenerator = generator;
+    return A;
+}
+
 //------------------------------------------------------------------------------
 /// Named constructor returns a new, empty Matrix with the same structure
 /// (distribution and number of tiles) as this matrix. Tiles are not allocated.
@@ -827,6 +986,10 @@ void Matrix<scalar_t>::insertLocalTiles(Target origin)
 }
 
 //------------------------------------------------------------------------------
+/// Copies A into this matrix, tile by tile. A and this matrix must have the
+/// same tiling, but may have different distributions. To change the tile
+/// size, use slate::redistribute( A, B ) instead.
+///
 template <typename scalar_t>
 void Matrix<scalar_t>::redistribute(Matrix<scalar_t>& A)
 {
@@ -8,6 +8,7 @@
 
 #include "slate/internal/Memory.hh"
 #include "slate/internal/Trace.hh"
+#include "slate/internal/compress.hh"
 #include "slate/internal/device.hh"
 #include "slate/types.hh"
 #include "slate/Exception.hh"
@@ -16,11 +17,13 @@
 #include <blas.hh>
 #include <lapack.hh>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 #include "slate/internal/mpi.hh"
 #include "slate/internal/openmp.hh"
@@ -152,8 +155,25 @@ public:
     void send(int dst, MPI_Comm mpi_comm, int tag = 0) const;
     void isend(int dst, MPI_Comm mpi_comm, int tag, MPI_Request *req); // const;
     void recv(int src, MPI_Comm mpi_comm, Layout layout, int tag = 0);
+    void irecv(int src, MPI_Comm mpi_comm, Layout layout, int tag,
+               MPI_Request* req);
     void bcast(int bcast_root, MPI_Comm mpi_comm);
 
+    void pack(TileCompression compression, double tolerance,
+              std::vector<uint8_t>& buffer) const;
+    void unpack(uint8_t const* buffer, Layout layout);
+
+    /// @return maximum size in bytes of a buffer packed by pack().
+    size_t packedMaxBytes() const
+    {
+        using real_t = blas::real_type<scalar_t>;
+        const int64_t r = sizeof(scalar_t) / sizeof(real_t);
+        int64_t count = layout_ == Layout::ColMajor ? nb_ : mb_;
+        int64_t blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
+        return internal::packed_max_bytes( count, r*blocklength,
+                                           sizeof(real_t) );
+    }
+
     /// Returns shallow copy of tile that is transposed.
     template <typename TileType>
     friend TileType transpose(TileType& A);
@@ -1121,6 +1141,125 @@ void Tile<scalar_t>::recv(int src, MPI_Comm mpi_comm, Layout layout, int tag)
     // by receiving less / compacted data
 }
 
+//------------------------------------------------------------------------------
+/// Starts a nonblocking receive of a tile from MPI rank src.
+/// The data must not be used before req completes.
+///
+/// @param[in] src
+///     Source MPI rank in mpi_comm.
+///
+/// @param[in] mpi_comm
+///     MPI communicator.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the received data.
+///     WARNING: need to call tileLayout(...) to properly set the layout of the
+///              origin matrix tile afterwards.
+///
+/// @param[in] tag
+///     MPI tag.
+///
+/// @param[out] req
+///     MPI request to complete, e.g., with MPI_Wait.
+///
+// todo need to copy or verify metadata (sizes, op, uplo, ...)
+template <typename scalar_t>
+void Tile<scalar_t>::irecv(
+    int src, MPI_Comm mpi_comm, Layout layout, int tag, MPI_Request* req)
+{
+    trace::Block trace_block("MPI_Irecv");
+
+    // If no stride.
+    if (this->isContiguous()) {
+        // Use simple recv.
+        int count = mb_*nb_;
+
+        slate_mpi_call(
+            MPI_Irecv(data_, count, mpi_type<scalar_t>::value, src, tag,
+                      mpi_comm, req));
+    }
+    else {
+        // Otherwise, use strided recv.
+        int count = layout_ == Layout::ColMajor ? nb_ : mb_;
+        int blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
+        int stride = stride_;
+        MPI_Datatype newtype;
+
+        slate_mpi_call(
+            MPI_Type_vector(
+                count, blocklength, stride, mpi_type<scalar_t>::value,
+                &newtype));
+
+        slate_mpi_call(MPI_Type_commit(&newtype));
+
+        // Freeing the type does not affect the pending receive.
+        slate_mpi_call(
+            MPI_Irecv(data_, 1, newtype, src, tag, mpi_comm, req));
+
+        slate_mpi_call(MPI_Type_free(&newtype));
+    }
+    // set this tile layout to match the received data layout
+    this->layout(layout);
+}
+
+//------------------------------------------------------------------------------
+/// Packs tile data, in its current layout, into a contiguous buffer with
+/// the given compression, for sending with MPI_BYTE. Data is read
+/// directly from the tile, without an intermediate copy.
+/// @see internal::pack_reals
+///
+/// @param[in] compression
+///     Compression of the packed data.
+///
+/// @param[in] tolerance
+///     For TileCompression::Lossy, bound on the relative error of each
+///     element, $|a_{ij} - \tilde{a}_{ij}| \le$ tolerance $|a_{ij}|$.
+///     Must be positive for TileCompression::Lossy; otherwise ignored.
+///
+/// @param[out] buffer
+///     The packed data, at most packedMaxBytes() long.
+///
+template <typename scalar_t>
+void Tile<scalar_t>::pack(
+    TileCompression compression, double tolerance,
+    std::vector<uint8_t>& buffer) const
+{
+    using real_t = blas::real_type<scalar_t>;
+    const int64_t r = sizeof(scalar_t) / sizeof(real_t);
+
+    int64_t count = layout_ == Layout::ColMajor ? nb_ : mb_;
+    int64_t blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
+
+    internal::pack_reals((real_t const*) data_, count, r*blocklength,
+                         r*stride_, compression, tolerance, buffer);
+}
+
+//------------------------------------------------------------------------------
+/// Unpacks tile data from a buffer packed by pack(), directly into the tile.
+///
+/// @param[in] buffer
+///     The packed data.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the packed data.
+///     WARNING: need to call tileLayout(...) to properly set the layout of the
+///              origin matrix tile afterwards.
+///
+template <typename scalar_t>
+void Tile<scalar_t>::unpack(uint8_t const* buffer, Layout layout)
+{
+    using real_t = blas::real_type<scalar_t>;
+    const int64_t r = sizeof(scalar_t) / sizeof(real_t);
+
+    // As in recv, data is stored using this tile's current layout.
+    int64_t count = layout_ == Layout::ColMajor ? nb_ : mb_;
+    int64_t blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
+
+    internal::unpack_reals(buffer, (real_t*) data_, count, r*blocklength,
+                           r*stride_);
+    this->layout(layout);
+}
+
 //------------------------------------------------------------------------------
 /// Broadcasts tile from MPI rank bcast_root, using given communicator.
 ///
@@ -45,6 +45,26 @@ enum class TileReleaseStrategy : char {
     All       = 'A',    ///< tiles are released by rotines in all namespaces
 };
 
+//------------------------------------------------------------------------------
+/// File format for matrix I/O.
+/// @ingroup enum
+///
+enum class FileFormat : char {
+    Tiled    = 'T',     ///< SLATE tiled binary format, with header
+    ColMajor = 'C',     ///< raw column-major, without header, for interop
+};
+
+//------------------------------------------------------------------------------
+/// Compression of tiles sent between MPI ranks in broadcasts.
+/// @ingroup enum
+///
+enum class TileCompression : char {
+    None     = 'N',     ///< send tiles as is
+    Lossless = 'L',     ///< XOR delta, byte shuffle, and zero suppression
+    Lossy    = 'R',     ///< round mantissas to a relative error bound,
+                        ///< then as Lossless
+};
+
 namespace internal {
 
 /// TargetType is used to overload functions, since there is no C++
@@ -80,6 +100,16 @@ enum class Option : char {
     PrintPrecision,     ///< precision print format specifier
                         ///< For correct printing, PrintWidth = PrintPrecision + 6.
     PivotThreshold,     ///< threshold for pivoting, >= 0, <= 1
+    FileFormat,         ///< file format for read and write (@see FileFormat)
+    CheckpointInterval, ///< panels between checkpoints of factorizations,
+                        ///< 0: no checkpoints
+    CheckpointFile,     ///< prefix of checkpoint file names
+    Layout,             ///< tile layout for computation on devices (@see Layout)
+    OutOfCoreFile,      ///< prefix of per-rank out-of-core tile file names
+    OutOfCoreMemory,    ///< host memory per rank for out-of-core tiles, bytes
+    StrassenCrossover,  ///< smallest dimension to recurse in gemmStrassen
+    ShiftGroups,        ///< number of process groups in multi-shift solves
+    PivotBatch,         ///< panels whose row swaps are applied together, >= 1
 
     // Methods, listed alphabetically.
     MethodCholQR,       ///< Select the algorithm to compute A^H * A
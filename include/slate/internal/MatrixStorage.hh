@@ -298,7 +298,8 @@ public:
     MatrixStorage( int64_t m, int64_t n, int64_t mb, int64_t nb,
                    GridOrder order, int p, int q, MPI_Comm mpi_comm );
 
-    MatrixStorage(std::function<int64_t (int64_t i)>& inTileMb,
+    MatrixStorage(int64_t m, int64_t n,
+                  std::function<int64_t (int64_t i)>& inTileMb,
                   std::function<int64_t (int64_t j)>& inTileNb,
                   std::function<int (ij_tuple ij)>& inTileRank,
                   std::function<int (ij_tuple ij)>& inTileDevice,
@@ -441,6 +442,17 @@ public:
     std::function<int (ij_tuple ij)> tileRank;
     std::function<int (ij_tuple ij)> tileDevice;
 
+    /// If set, fills local tiles on demand; see tileGenerate.
+    /// Called with the tile's global row and column offsets, its size,
+    /// and its column-major data.
+    std::function<void (int64_t row, int64_t col, int64_t mb, int64_t nb,
+                        scalar_t* data, int64_t lda)> tileGenerator;
+
+    int64_t tileRowOffset(int64_t i) const;
+    int64_t tileColOffset(int64_t j) const;
+    int64_t tileRowIndex(int64_t row) const;
+    int64_t tileColIndex(int64_t col) const;
+
     //--------------------------------------------------------------------------
     /// @return whether tile {i, j} is local.
     bool tileIsLocal(ij_tuple ij)
@@ -455,6 +467,10 @@ public:
         Layout layout=Layout::ColMajor);
     TileInstance<scalar_t>& tileAcquire(ijdev_tuple ijdev, Layout layout);
 
+    scalar_t* mapFile(const char* filename, size_t size);
+    void tileGenerate(ij_tuple ij);
+    bool tileIsGenerated(ij_tuple ij);
+
     void tileMakeTransposable(Tile<scalar_t>* tile);
     void tileLayoutReset(Tile<scalar_t>* tile);
 
@@ -501,6 +517,17 @@ public:
     }
 
 private:
+    void initTileOffsets(int64_t m, int64_t n);
+
+    static int64_t tileOffset(
+        std::vector<int64_t> const& offsets,
+        std::function<int64_t (int64_t i)> const& tileSize,
+        int64_t i);
+    static int64_t tileIndex(
+        std::vector<int64_t> const& offsets,
+        std::function<int64_t (int64_t i)> const& tileSize,
+        int64_t index);
+
     TilesMap tiles_;        ///< map of tiles and associated states
     mutable omp_nest_lock_t lock_;  ///< TilesMap lock
     slate::Memory memory_;  ///< memory allocator
@@ -508,11 +535,27 @@ private:
     std::map< int, std::stack<void*> > allocated_mem_;
     bool own;
 
+    /// File mapping backing UserOwned tiles, from mapFile; unmapped by the
+    /// destructor after the tiles are erased.
+    std::unique_ptr<MappedRegion> mapped_;
+
+    /// Compression of tiles sent in broadcasts; see BaseMatrix::tileCompression.
+    TileCompression tile_compression_ = TileCompression::None;
+
+    /// Relative error bound for TileCompression::Lossy.
+    double tile_compression_tol_ = 0;
+
     int mpi_rank_;
     static int num_devices_;
 
     int64_t batch_array_size_;
 
+    /// Prefix sums of tileMb and tileNb: row_offsets_[ i ] is the
+    /// first row of block row i, row_offsets_[ mt ] >= m; likewise
+    /// col_offsets_ for block columns. Built once at construction.
+    std::vector<int64_t> row_offsets_;
+    std::vector<int64_t> col_offsets_;
+
     // BLAS++ communication queues
     std::vector< lapack::Queue* > comm_queues_;
     // BLAS++ compute queues
@@ -582,14 +625,17 @@ MatrixStorage<scalar_t>::MatrixStorage(
         };
     }
 
+    initTileOffsets(m, n);
     initQueues();
     omp_init_nest_lock(&lock_);
 }
 
 //------------------------------------------------------------------------------
 /// For memory, assumes tiles of size mb = inTileMb(0) x nb = inTileNb(0).
+/// The m, n dimensions are used only to size the tile offset tables.
 template <typename scalar_t>
 MatrixStorage<scalar_t>::MatrixStorage(
+    int64_t m, int64_t n,
     std::function<int64_t (int64_t i)>& inTileMb,
     std::function<int64_t (int64_t j)>& inTileNb,
     std::function<int (ij_tuple ij)>& inTileRank,
@@ -610,10 +656,122 @@ MatrixStorage<scalar_t>::MatrixStorage(
     // todo: similar code in BaseMatrix(...) and MatrixStorage(...)
     num_devices_ = memory_.num_devices_;
 
+    initTileOffsets(m, n);
     initQueues();
     omp_init_nest_lock(&lock_);
 }
 
+//------------------------------------------------------------------------------
+/// [private]
+/// Builds prefix sums of tileMb and tileNb, covering at least m rows
+/// and n cols, so that offset and reverse lookups do not have to
+/// sum tile sizes with a std::function call per tile.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::initTileOffsets(int64_t m, int64_t n)
+{
+    row_offsets_.assign(1, 0);
+    while (row_offsets_.back() < m) {
+        int64_t mb = tileMb(row_offsets_.size() - 1);
+        slate_assert(mb > 0);
+        row_offsets_.push_back(row_offsets_.back() + mb);
+    }
+
+    col_offsets_.assign(1, 0);
+    while (col_offsets_.back() < n) {
+        int64_t nb = tileNb(col_offsets_.size() - 1);
+        slate_assert(nb > 0);
+        col_offsets_.push_back(col_offsets_.back() + nb);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [private]
+/// @return offset of tile i from the prefix sums, extending past the
+/// end of the table with tileSize if needed.
+///
+template <typename scalar_t>
+int64_t MatrixStorage<scalar_t>::tileOffset(
+    std::vector<int64_t> const& offsets,
+    std::function<int64_t (int64_t i)> const& tileSize,
+    int64_t i)
+{
+    assert(i >= 0);
+    int64_t last = offsets.size() - 1;
+    if (i <= last)
+        return offsets[ i ];
+
+    int64_t offset = offsets[ last ];
+    for (int64_t k = last; k < i; ++k)
+        offset += tileSize(k);
+    return offset;
+}
+
+//------------------------------------------------------------------------------
+/// [private]
+/// @return index of the tile containing index, by binary search in
+/// the prefix sums, extending past the end of the table with tileSize
+/// if needed.
+///
+template <typename scalar_t>
+int64_t MatrixStorage<scalar_t>::tileIndex(
+    std::vector<int64_t> const& offsets,
+    std::function<int64_t (int64_t i)> const& tileSize,
+    int64_t index)
+{
+    assert(index >= 0);
+    if (index < offsets.back()) {
+        auto iter = std::upper_bound(offsets.begin(), offsets.end(), index);
+        return (iter - offsets.begin()) - 1;
+    }
+
+    int64_t i = offsets.size() - 1;
+    int64_t offset = offsets.back() + tileSize(i);
+    while (offset <= index) {
+        ++i;
+        offset += tileSize(i);
+    }
+    return i;
+}
+
+//------------------------------------------------------------------------------
+/// @return first row of block row i, i.e., sum of tileMb(k) for k < i.
+/// O(1) for tiles within the matrix dimensions.
+///
+template <typename scalar_t>
+int64_t MatrixStorage<scalar_t>::tileRowOffset(int64_t i) const
+{
+    return tileOffset(row_offsets_, tileMb, i);
+}
+
+//------------------------------------------------------------------------------
+/// @return first col of block col j, i.e., sum of tileNb(k) for k < j.
+/// O(1) for tiles within the matrix dimensions.
+///
+template <typename scalar_t>
+int64_t MatrixStorage<scalar_t>::tileColOffset(int64_t j) const
+{
+    return tileOffset(col_offsets_, tileNb, j);
+}
+
+//------------------------------------------------------------------------------
+/// @return block row i containing the given row. O(log mt).
+///
+template <typename scalar_t>
+int64_t MatrixStorage<scalar_t>::tileRowIndex(int64_t row) const
+{
+    return tileIndex(row_offsets_, tileMb, row);
+}
+
+//------------------------------------------------------------------------------
+/// @return block col j containing the given col. O(log nt).
+///
+template <typename scalar_t>
+int64_t MatrixStorage<scalar_t>::tileColIndex(int64_t col) const
+{
+    return tileIndex(col_offsets_, tileNb, col);
+}
+
 //------------------------------------------------------------------------------
 /// Destructor deletes all tiles and frees workspace buffers.
 ///
@@ -1203,6 +1361,105 @@ TileInstance<scalar_t>& MatrixStorage<scalar_t>::tileInsert(
     return tile_node[device];
 }
 
+//------------------------------------------------------------------------------
+/// Maps a file to back this rank's local tiles, which are then inserted by
+/// the caller with tileInsert( ijdev, data, lda ) at pointers into the
+/// mapping. The mapping lives as long as the storage, so it outlives all
+/// tiles in it, including in shallow copies of the matrix.
+/// A storage can map at most one file.
+///
+/// @param[in] filename
+///     File to map; created or extended to size bytes if needed.
+///
+/// @param[in] size
+///     Size of the mapping in bytes.
+///
+/// @return start of the mapping, aligned to a page.
+///
+template <typename scalar_t>
+scalar_t* MatrixStorage<scalar_t>::mapFile(const char* filename, size_t size)
+{
+    slate_assert( mapped_ == nullptr );
+    mapped_.reset( new MappedRegion( filename, size ) );
+    return (scalar_t*) mapped_->data();
+}
+
+//------------------------------------------------------------------------------
+/// If tileGenerator is set and local tile {i, j} has no instance, inserts
+/// it on the host as a workspace tile and fills it by calling
+/// tileGenerator. Being workspace, the tile is freed by releaseWorkspace
+/// or tile release like any other workspace tile, and generated again on
+/// its next access. When first modified, BaseMatrix::tileModified makes
+/// it an origin tile, which is kept.
+///
+/// The tile is on hold and its TileNode is locked while it is generated,
+/// so other threads getting the tile wait, while other tiles can be
+/// generated concurrently.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileGenerate(ij_tuple ij)
+{
+    if (! tileGenerator || ! tileIsLocal(ij))
+        return;
+
+    int64_t i = std::get<0>(ij);
+    int64_t j = std::get<1>(ij);
+
+    omp_nest_lock_t* node_lock;
+    TileInstance_t* tile_instance;
+    {
+        LockGuard guard(getTilesMapLock());
+
+        auto iter = tiles_.find(ij);
+        if (iter != tiles_.end() && ! iter->second->empty())
+            return;
+
+        tile_instance = &tileInsert({i, j, HostNum}, TileKind::Workspace);
+        tile_instance->setState(MOSI::OnHold);
+        node_lock = at(ij).getLock();
+        omp_set_nest_lock(node_lock);
+    }
+
+    Tile<scalar_t>* tile = tile_instance->tile();
+    try {
+        tileGenerator(tileRowOffset(i), tileColOffset(j),
+                      tile->mb(), tile->nb(), tile->data(), tile->stride());
+    }
+    catch (...) {
+        omp_unset_nest_lock(node_lock);
+        throw;
+    }
+    tile_instance->setState(MOSI::Shared);
+    tile_instance->setState(~MOSI::OnHold);
+    omp_unset_nest_lock(node_lock);
+}
+
+//------------------------------------------------------------------------------
+/// Returns whether local tile {i, j} is still defined by tileGenerator:
+/// it has no origin instance, since it was never used, or was generated
+/// but not modified. BaseMatrix::tileModified makes a generated tile an
+/// origin tile when it is first modified.
+///
+template <typename scalar_t>
+bool MatrixStorage<scalar_t>::tileIsGenerated(ij_tuple ij)
+{
+    if (! tileGenerator || ! tileIsLocal(ij))
+        return false;
+
+    LockGuard guard(getTilesMapLock());
+
+    auto iter = tiles_.find(ij);
+    if (iter == tiles_.end())
+        return true;
+
+    auto& tile_node = *(iter->second);
+    for (int d = HostNum; d < num_devices_; ++d) {
+        if (tile_node.existsOn(d) && tile_node[d].tile()->origin())
+            return false;
+    }
+    return true;
+}
+
 //------------------------------------------------------------------------------
 /// Makes tile layout convertible by extending its data buffer.
 /// Attaches an auxiliary buffer to hold the transposed data when needed.
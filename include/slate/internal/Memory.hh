@@ -94,6 +94,31 @@ private:
     std::map< int, size_t > capacity_;
 };
 
+//------------------------------------------------------------------------------
+/// Memory-mapped file holding the local tiles of a matrix, e.g., for
+/// Matrix::fromMappedFile. The file is mapped shared, so writes to tiles
+/// go to the file, and other processes mapping the same file, e.g., in
+/// /dev/shm, see the same data. Unmapped and closed by the destructor.
+class MappedRegion {
+public:
+    MappedRegion(const char* filename, size_t size);
+    ~MappedRegion();
+
+    MappedRegion(MappedRegion const& orig) = delete;
+    MappedRegion& operator = (MappedRegion const& orig) = delete;
+
+    /// @return start of the mapping, aligned to a page.
+    void* data() const { return data_; }
+
+    /// @return size of the mapping in bytes.
+    size_t size() const { return size_; }
+
+private:
+    void* data_;
+    size_t size_;
+    int fd_;
+};
+
 } // namespace slate
 
 #endif // SLATE_MEMORY_HH
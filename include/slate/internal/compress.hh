@@ -0,0 +1,90 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_COMPRESS_HH
+#define SLATE_COMPRESS_HH
+
+#include "slate/enums.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Codec for tile payloads sent in broadcasts; see TileCompression.
+//
+// A packed buffer is a 16 byte header, holding the payload size,
+// followed by the payload. The data is count columns of blocklength
+// real numbers, split into blocks of at most packed_block_size numbers.
+// Each number in a block is XOR-ed with the previous one, then bytes are
+// shuffled into planes, so byte b of all numbers is together. Each plane
+// is stored as is, omitted if zero, or as a bitmap of its nonzero bytes
+// followed by those bytes, whichever is smallest.
+// With TileCompression::Lossy, numbers are first rounded to the fewest
+// mantissa bits that meet the error bound.
+// If a sample of the data does not compress well, the payload is the
+// raw numbers instead, flagged in the header.
+
+/// Size of the header of a packed buffer, in bytes.
+constexpr size_t packed_header_bytes = 16;
+
+/// Numbers per block; a block's workspace stays in L1 cache.
+constexpr size_t packed_block_size = 256;
+
+/// Numbers encoded before deciding whether encoding pays off.
+constexpr size_t packed_sample_size = 4096;
+
+/// Largest packed-to-raw size ratio of the sample for which the rest is
+/// encoded; above it, the whole tile is stored raw. Encoding runs at
+/// about 2-3 GB/s per core, so a ratio near 1 would only add time.
+constexpr double packed_max_ratio = 0.75;
+
+//------------------------------------------------------------------------------
+/// @return maximum size of the packed buffer for count columns of
+/// blocklength real numbers, each elem_size bytes.
+inline size_t packed_max_bytes(
+    int64_t count, int64_t blocklength, size_t elem_size )
+{
+    size_t blocks = (blocklength + packed_block_size - 1) / packed_block_size;
+    // Each byte plane of each block has a 1 byte mode.
+    return packed_header_bytes
+           + count * (blocklength + blocks) * elem_size;
+}
+
+//------------------------------------------------------------------------------
+/// @return size of the packed buffer, from its header.
+inline size_t packed_bytes( uint8_t const* buffer )
+{
+    uint64_t payload_bytes;
+    std::memcpy( &payload_bytes, buffer + 8, sizeof(payload_bytes) );
+    return packed_header_bytes + payload_bytes;
+}
+
+void pack_reals(
+    float const* x, int64_t count, int64_t blocklength, int64_t stride,
+    TileCompression compression, double tolerance,
+    std::vector<uint8_t>& buffer );
+
+void pack_reals(
+    double const* x, int64_t count, int64_t blocklength, int64_t stride,
+    TileCompression compression, double tolerance,
+    std::vector<uint8_t>& buffer );
+
+void unpack_reals(
+    uint8_t const* buffer,
+    float* x, int64_t count, int64_t blocklength, int64_t stride );
+
+void unpack_reals(
+    uint8_t const* buffer,
+    double* x, int64_t count, int64_t blocklength, int64_t stride );
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_COMPRESS_HH
@@ -45,6 +45,7 @@ enum {
 
     MPI_MAX,
     MPI_MAXLOC,
+    MPI_MIN,
     MPI_SUM,
 
     MPI_SUCCESS,
@@ -57,6 +58,7 @@ enum {
 extern int* MPI_STATUS_IGNORE;
 #define MPI_STATUSES_IGNORE NULL
 #define MPI_REQUEST_NULL 0
+#define MPI_UNDEFINED (-32766)
 
 typedef void (MPI_User_function) (void* a,
                                   void* b, int* len, MPI_Datatype* type);
@@ -82,6 +84,7 @@ int MPI_Comm_free(MPI_Comm* comm);
 int MPI_Comm_group(MPI_Comm comm, MPI_Group* group);
 int MPI_Comm_rank(MPI_Comm comm, int* rank);
 int MPI_Comm_size(MPI_Comm comm, int* size);
+int MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm* newcomm);
 MPI_Fint MPI_Comm_f2c(MPI_Comm comm);
 
 int MPI_Group_free(MPI_Group* group);
@@ -135,6 +138,12 @@ int MPI_Wait(MPI_Request* request, MPI_Status* status);
 
 int MPI_Waitall(int count, MPI_Request requests[], MPI_Status statuses[]);
 
+int MPI_Waitany(int count, MPI_Request requests[], int* index,
+                MPI_Status* status);
+
+int MPI_Testany(int count, MPI_Request requests[], int* index, int* flag,
+                MPI_Status* status);
+
 int MPI_Error_string(int errorcode, char* string, int* resultlen);
 
 int MPI_Finalize(void);
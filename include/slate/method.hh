@@ -79,10 +79,12 @@ namespace MethodGemm {
 
     constexpr char GemmA_str[] = "A";
     constexpr char GemmC_str[] = "C";
+    constexpr char Strassen_str[] = "S";
     const Method Error  = baseMethodError;
     const Method Auto   = baseMethodAuto;
     const Method GemmA  = 1;  ///< Select gemmA algorithm
     const Method GemmC  = 2;  ///< Select gemmC algorithm
+    const Method Strassen = 3;  ///< Select gemmStrassen algorithm
 
     template <typename TA, typename TB>
     inline Method select_algo(TA& A, TB& B, Options& opts) {
@@ -109,6 +111,8 @@ namespace MethodGemm {
             return GemmA;
         else if (method_ == "c" || method_ == "gemmc")
             return GemmC;
+        else if (method_ == "s" || method_ == "strassen")
+            return Strassen;
         else
             throw slate::Exception("unknown gemm method");
     }
@@ -119,6 +123,7 @@ namespace MethodGemm {
             case Auto:  return baseMethodAuto_str;
             case GemmA: return GemmA_str;
             case GemmC: return GemmC_str;
+            case Strassen: return Strassen_str;
             default:    return baseMethodError_str;
         }
     }
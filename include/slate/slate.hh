@@ -58,6 +58,14 @@ void copy(
     dst_matrix_type& B,
     Options const& opts = Options());
 
+//-----------------------------------------
+// redistribute()
+template <typename scalar_t>
+void redistribute(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // scale()
 // General matrix.
@@ -143,6 +151,90 @@ void set(
     set(value, value, A, opts);
 }
 
+//------------------------------------------------------------------------------
+// Matrix I/O
+
+//-----------------------------------------
+// read()
+template <typename scalar_t>
+void read(
+    const char* filename,
+    Matrix<scalar_t>& A,
+    Options const& opts = Options());
+
+void read_header(
+    const char* filename,
+    int64_t* m, int64_t* n, int64_t* mb, int64_t* nb,
+    MPI_Comm mpi_comm);
+
+//-----------------------------------------
+// write()
+template <typename scalar_t>
+void write(
+    const char* filename,
+    Matrix<scalar_t>& A,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// import_coo()
+template <typename scalar_t>
+void import_coo(
+    int64_t nnz, int64_t const* rowind, int64_t const* colind,
+    scalar_t const* values,
+    Matrix<scalar_t>& A,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// import_csr()
+template <typename scalar_t>
+void import_csr(
+    int64_t mloc, int64_t row_offset,
+    int64_t const* rowptr, int64_t const* colind, scalar_t const* values,
+    Matrix<scalar_t>& A,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// import_dense()
+template <typename scalar_t>
+void import_dense(
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    scalar_t const* data, int64_t lda,
+    Matrix<scalar_t>& A,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// export_dense()
+template <typename scalar_t>
+void export_dense(
+    Matrix<scalar_t>& A,
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    scalar_t* data, int64_t lda,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// export_csr()
+template <typename scalar_t>
+void export_csr(
+    Matrix<scalar_t>& A,
+    int64_t mloc, int64_t row_offset,
+    std::vector<int64_t>& rowptr, std::vector<int64_t>& colind,
+    std::vector<scalar_t>& values,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// ooc_store()
+template <typename scalar_t>
+void ooc_store(
+    BaseMatrix<scalar_t>& A,
+    Options const& opts);
+
+//-----------------------------------------
+// ooc_load()
+template <typename scalar_t>
+void ooc_load(
+    BaseMatrix<scalar_t>& A,
+    Options const& opts);
+
 //------------------------------------------------------------------------------
 // Level 3 BLAS and LAPACK auxiliary
 
@@ -182,6 +274,15 @@ void gemmC(
     scalar_t beta,  Matrix<scalar_t>& C,
     Options const& opts = Options());
 
+//-----------------------------------------
+// gemmStrassen()
+template <typename scalar_t>
+void gemmStrassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // hbmm()
 template <typename scalar_t>
@@ -271,6 +372,15 @@ void trmm(
                               Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+//-----------------------------------------
+// trtrmm()
+template <typename scalar_t>
+void trtrmm(
+    scalar_t alpha, TriangularMatrix<scalar_t>& A,
+                    TriangularMatrix<scalar_t>& B,
+                              Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // tbsm()
 template <typename scalar_t>
@@ -328,6 +438,15 @@ void trtrm(
     TriangularMatrix<scalar_t>& A,
     Options const& opts = Options());
 
+// LAPACK name for trtrm: U U^H for upper, L^H L for lower, in place.
+template <typename scalar_t>
+void lauum(
+    TriangularMatrix<scalar_t>& A,
+    Options const& opts = Options())
+{
+    trtrm( A, opts );
+}
+
 //-----------------------------------------
 // herk()
 template <typename scalar_t>
@@ -481,6 +600,16 @@ void gesv_nopiv(
     Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+//-----------------------------------------
+// gesv_multishift()
+template <typename scalar_t>
+void gesv_multishift(
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t> const& shifts,
+    Matrix<scalar_t>& B,
+    std::vector< Matrix<scalar_t> >& X,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // gesvMixed()
 template <typename scalar_t>
@@ -513,6 +642,31 @@ void getrf(
     Matrix<scalar_t>& A, Pivots& pivots,
     Options const& opts = Options());
 
+//-----------------------------------------
+// getrf_restart()
+template <typename scalar_t>
+void getrf_restart(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// getrf_ooc()
+template <typename scalar_t>
+void getrf_ooc(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts);
+
+//-----------------------------------------
+// getrf_multishift()
+template <typename scalar_t>
+void getrf_multishift(
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t> const& shifts,
+    std::vector<int64_t>& shift_index,
+    std::vector< Matrix<scalar_t> >& LU,
+    std::vector<Pivots>& pivots,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // getrf_nopiv()
 template <typename scalar_t>
@@ -543,6 +697,14 @@ void getrs(
     Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+//-----------------------------------------
+// getrs_ooc()
+template <typename scalar_t>
+void getrs_ooc(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts);
+
 //-----------------------------------------
 // getrs_nopiv()
 // todo: deprecate, use getrs( ..., { MethodLU: NoPiv } )
@@ -567,6 +729,19 @@ void getri(
     Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+//-----------------------------------------
+// gerfs()
+// Iterative refinement with extra-precise residuals.
+template <typename scalar_t, typename scalar_lo>
+int64_t gerfs(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_lo>& LU, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    std::vector< blas::real_type<scalar_t> >& ferr,
+    std::vector< blas::real_type<scalar_t> >& berr,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // Cholesky
 
@@ -645,6 +820,36 @@ void potrf(
     potrf(AH, opts);
 }
 
+//-----------------------------------------
+// potrf_restart()
+template <typename scalar_t>
+void potrf_restart(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// potrf_ooc()
+template <typename scalar_t>
+void potrf_ooc(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts);
+
+//-----------------------------------------
+// potrf_update()
+template <typename scalar_t>
+void potrf_update(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// potrf_downdate()
+template <typename scalar_t>
+void potrf_downdate(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // pbtrs()
 template <typename scalar_t>
@@ -674,6 +879,14 @@ void potrs(
     potrs(AH, B, opts);
 }
 
+//-----------------------------------------
+// potrs_ooc()
+template <typename scalar_t>
+void potrs_ooc(
+    HermitianMatrix<scalar_t>& A,
+             Matrix<scalar_t>& B,
+    Options const& opts);
+
 //-----------------------------------------
 // potri()
 template <typename scalar_t>
@@ -681,6 +894,19 @@ void potri(
     HermitianMatrix<scalar_t>& A,
     Options const& opts = Options());
 
+//-----------------------------------------
+// porfs()
+// Iterative refinement with extra-precise residuals.
+template <typename scalar_t, typename scalar_lo>
+int64_t porfs(
+    HermitianMatrix<scalar_t>& A,
+    HermitianMatrix<scalar_lo>& LLH,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    std::vector< blas::real_type<scalar_t> >& ferr,
+    std::vector< blas::real_type<scalar_t> >& berr,
+    Options const& opts = Options());
+
 // todo:
 // forward real-symmetric matrices to potrs;
 // disabled for complex
@@ -765,6 +991,20 @@ void sytrs(
     hetrs(AH, pivots, T, pivots2, B, opts);
 }
 
+//-----------------------------------------
+// herfs()
+// Iterative refinement with extra-precise residuals.
+template <typename scalar_t, typename scalar_lo>
+int64_t herfs(
+    HermitianMatrix<scalar_t>& A,
+    HermitianMatrix<scalar_lo>& LTL, Pivots& pivots,
+         BandMatrix<scalar_lo>& T,   Pivots& pivots2,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    std::vector< blas::real_type<scalar_t> >& ferr,
+    std::vector< blas::real_type<scalar_t> >& berr,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // QR
 
@@ -793,6 +1033,14 @@ void gels_cholqr(
     Matrix<scalar_t>& BX,
     Options const& opts = Options());
 
+// Using QR with column pivoting, for rank-deficient A
+template <typename scalar_t>
+int64_t gelsy(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& BX,
+    blas::real_type<scalar_t> rcond,
+    Options const& opts = Options());
+
 // Backward compatibility
 template <typename scalar_t>
 [[deprecated( "Use gels( A, BX[, opts] ) instead." )]]
@@ -811,6 +1059,27 @@ void gels(
     Matrix<scalar_t>& BX,
     Options const& opts = Options());
 
+//-----------------------------------------
+// gglse(), ggglm()
+// Equality-constrained least squares and general Gauss-Markov linear model
+template <typename scalar_t>
+void gglse(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& C,
+    Matrix<scalar_t>& D,
+    Matrix<scalar_t>& X,
+    Options const& opts = Options());
+
+template <typename scalar_t>
+void ggglm(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& D,
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& Y,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // QR
 
@@ -821,6 +1090,21 @@ void geqrf(
     Matrix<scalar_t>& A, TriangularFactors<scalar_t>& T,
     Options const& opts = Options());
 
+//-----------------------------------------
+// geqrf_restart()
+template <typename scalar_t>
+void geqrf_restart(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& T,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// geqp3()
+template <typename scalar_t>
+void geqp3(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& T,
+    Pivots& pivots,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // unmqr()
 template <typename scalar_t>
@@ -857,6 +1141,199 @@ void unmlq(
     Matrix<scalar_t>& C,
     Options const& opts = Options());
 
+//-----------------------------------------
+// RQ
+
+//-----------------------------------------
+// gerqf()
+template <typename scalar_t>
+void gerqf(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& T,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// unmrq()
+template <typename scalar_t>
+void unmrq(
+    Side side, Op op,
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& T,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// Generalized QR, LQ, and RQ
+
+//-----------------------------------------
+// ggqrf()
+template <typename scalar_t>
+void ggqrf(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& TA,
+    Matrix<scalar_t>& B, TriangularFactors<scalar_t>& TB,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// gglqf()
+template <typename scalar_t>
+void gglqf(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& TA,
+    Matrix<scalar_t>& B, TriangularFactors<scalar_t>& TB,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// ggrqf()
+template <typename scalar_t>
+void ggrqf(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& TA,
+    Matrix<scalar_t>& B, TriangularFactors<scalar_t>& TB,
+    Options const& opts = Options());
+
+//------------------------------------------------------------------------------
+// Non-symmetric eigenvalues
+
+template <typename scalar_t>
+void geev(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& V,
+    Options const& opts = Options());
+
+/// Without V, compute only eigenvalues.
+template <typename scalar_t>
+void geev(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Options const& opts = Options())
+{
+    Matrix<scalar_t> V;
+    geev( A, Lambda, V, opts );
+}
+
+//-----------------------------------------
+// gees()
+template <typename scalar_t>
+void gees(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// gehrd()
+template <typename scalar_t>
+void gehrd(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// unmhr()
+template <typename scalar_t>
+void unmhr(
+    Side side, Op op,
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// hseqr()
+template <typename scalar_t>
+void hseqr(
+    Matrix<scalar_t>& H,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts = Options());
+
+/// Without Z, compute only eigenvalues.
+template <typename scalar_t>
+void hseqr(
+    Matrix<scalar_t>& H,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// trevc()
+template <typename scalar_t>
+void trevc(
+    Matrix<scalar_t>& T,
+    Matrix<scalar_t>& X,
+    Options const& opts = Options());
+
+//------------------------------------------------------------------------------
+// Sylvester and Lyapunov equations
+
+//-----------------------------------------
+// gesyl()
+template <typename scalar_t>
+void gesyl(
+    int sign,
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// gelyap()
+template <typename scalar_t>
+void gelyap(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// gelyap_sign()
+template <typename scalar_t>
+void gelyap_sign(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// trsyl()
+template <typename scalar_t>
+void trsyl(
+    int sign,
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
+//------------------------------------------------------------------------------
+// Matrix functions
+
+//-----------------------------------------
+// expm()
+template <typename scalar_t>
+void expm(
+    Matrix<scalar_t>& A,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// sqrtm()
+template <typename scalar_t>
+void sqrtm(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& X,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// invsqrtm()
+template <typename scalar_t>
+void invsqrtm(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& X,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// hefunm()
+template <typename scalar_t>
+void hefunm(
+    typename std::common_type<
+        std::function< scalar_t (blas::real_type<scalar_t>) > >::type const& f,
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& F,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // SVD
 
@@ -897,6 +1374,20 @@ void bdsqr(
     Matrix<scalar_t>& VT,
     Options const& opts = Options());
 
+//-----------------------------------------
+// Generalized SVD
+// ggsvd()
+template <typename scalar_t>
+void ggsvd(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    std::vector< blas::real_type<scalar_t> >& alpha,
+    std::vector< blas::real_type<scalar_t> >& beta,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& X,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // Symmetric/Hermitian eigenvalues
 
@@ -26,7 +26,9 @@ namespace slate {
 /// - int
 /// - int64_t
 /// - double
-/// - Target enum
+/// - Target, TileReleaseStrategy, FileFormat, or Layout enum
+/// - const char* string, stored in s_. The string is not copied, so it
+///   must outlive the Options map and every routine called with it.
 /// @see Option
 ///
 class OptionValue {
@@ -49,9 +51,20 @@ public:
     OptionValue(TileReleaseStrategy t) : i_(int(t))
     {}
 
+    OptionValue(FileFormat f) : i_(int(f))
+    {}
+
+    OptionValue(Layout l) : i_(int(l))
+    {}
+
+    /// String options are not copied; the string must outlive the options.
+    OptionValue(const char* s) : s_(s)
+    {}
+
     union {
         int64_t i_;
         double d_;
+        const char* s_;
     };
 };
 
@@ -202,6 +215,22 @@ inline double get_option<double>( Options opts, Option option, double defval )
     return retval;
 }
 
+//----------------------------
+/// Specialization for strings.
+template <>
+inline const char* get_option<const char*>(
+    Options opts, Option option, const char* defval )
+{
+    const char* retval;
+    auto search = opts.find( option );
+    if (search != opts.end())
+        retval = search->second.s_;
+    else
+        retval = defval;
+
+    return retval;
+}
+
 //------------------------------------------------------------------------------
 // For %lld printf-style printing, cast to llong; guaranteed >= 64 bits.
 using llong = long long;
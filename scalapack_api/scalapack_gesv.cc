@@ -122,7 +122,9 @@ void slate_pgesv(int n, int nrhs, scalar_t* a, int ia, int ja, int* desca, int*
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
-        {slate::Option::InnerBlocking, inner_blocking}
+        {slate::Option::InnerBlocking, inner_blocking},
+        // Work directly on the ScaLAPACK data, without layout conversion.
+        {slate::Option::Layout, slate::Layout::ColMajor}
     });
 
     // Extract pivots from SLATE's global Pivots structure into ScaLAPACK local ipiv array
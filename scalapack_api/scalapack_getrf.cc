@@ -116,7 +116,9 @@ void slate_pgetrf(int m, int n, scalar_t* a, int ia, int ja, int* desca, int* ip
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
-        {slate::Option::InnerBlocking, ib}
+        {slate::Option::InnerBlocking, ib},
+        // Work directly on the ScaLAPACK data, without layout conversion.
+        {slate::Option::Layout, slate::Layout::ColMajor}
     });
 
     // Extract pivots from SLATE's global Pivots structure into ScaLAPACK local ipiv array
@@ -5,6 +5,15 @@
 
 #include "auxiliary/Debug.hh"
 #include "slate/internal/Memory.hh"
+#include "slate/Exception.hh"
+
+#include <cerrno>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace slate {
 
@@ -216,4 +225,57 @@ void Memory::freeDeviceMemory(int device, void* dev_mem, blas::Queue *queue)
     blas::device_free(dev_mem, *queue);
 }
 
+//------------------------------------------------------------------------------
+/// Opens the file, creating it if needed, extends it to size bytes if it
+/// is shorter, and maps it shared. Existing data in the file is kept;
+/// new space reads as zeros.
+///
+/// @param[in] filename
+///     File to map, e.g., on local disk, or in /dev/shm for shared memory.
+///
+/// @param[in] size
+///     Size of the mapping in bytes.
+///
+MappedRegion::MappedRegion(const char* filename, size_t size)
+    : data_(nullptr),
+      size_(size),
+      fd_(-1)
+{
+    fd_ = ::open(filename, O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0)
+        slate_error(std::string("cannot open ") + filename + ": "
+                    + std::strerror(errno));
+
+    struct stat st;
+    if (::fstat(fd_, &st) != 0 ||
+        (size_t(st.st_size) < size && ::ftruncate(fd_, size) != 0))
+    {
+        int err = errno;
+        ::close(fd_);
+        slate_error(std::string("cannot resize ") + filename + ": "
+                    + std::strerror(err));
+    }
+
+    // mmap of 0 bytes fails; a rank with no local tiles maps nothing.
+    if (size > 0) {
+        data_ = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       fd_, 0);
+        if (data_ == MAP_FAILED) {
+            int err = errno;
+            ::close(fd_);
+            slate_error(std::string("cannot map ") + filename + ": "
+                        + std::strerror(err));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Unmaps and closes the file. Modified pages are written back by the OS.
+MappedRegion::~MappedRegion()
+{
+    if (data_ != nullptr)
+        ::munmap(data_, size_);
+    ::close(fd_);
+}
+
 } // namespace slate
@@ -0,0 +1,411 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/compress.hh"
+#include "slate/Exception.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace slate {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Unsigned integer type with the bits of real_t, and its mantissa size.
+template <typename real_t>
+struct Bits;
+
+template <>
+struct Bits<float> {
+    using type = uint32_t;
+    static constexpr int mantissa = 23;
+    static constexpr uint32_t exponent_mask = 0x7f800000;
+};
+
+template <>
+struct Bits<double> {
+    using type = uint64_t;
+    static constexpr int mantissa = 52;
+    static constexpr uint64_t exponent_mask = 0x7ff0000000000000;
+};
+
+/// Flags in the first byte of the header.
+enum : uint8_t {
+    flag_encoded = 0x01,    ///< blocks are XOR-ed, byte shuffled, and encoded
+};
+
+/// Modes of each byte plane of an encoded block.
+enum : uint8_t {
+    plane_zero   = 0,   ///< all bytes are zero
+    plane_raw    = 1,   ///< bytes stored as is
+    plane_sparse = 2,   ///< bitmap of nonzero bytes, then those bytes
+};
+
+//------------------------------------------------------------------------------
+/// @return number of low mantissa bits to drop so that rounding has
+/// relative error at most tolerance, or 0 to keep all bits.
+///
+template <typename real_t>
+int dropped_bits( TileCompression compression, double tolerance )
+{
+    if (compression != TileCompression::Lossy)
+        return 0;
+
+    // Rounding to b mantissa bits has relative error at most 2^{-(b+1)}.
+    int b = std::max( 0, int( std::ceil( -std::log2( tolerance ) ) ) - 1 );
+    return std::max( 0, Bits<real_t>::mantissa - b );
+}
+
+//------------------------------------------------------------------------------
+/// Rounds the bits w of a real number to nearest, ties to even, dropping
+/// the low drop > 0 bits of its mantissa. Inf and NaN are kept as is.
+///
+template <typename real_t>
+inline typename Bits<real_t>::type round_mantissa(
+    typename Bits<real_t>::type w, int drop )
+{
+    using uint_t = typename Bits<real_t>::type;
+    const uint_t exponent_mask = Bits<real_t>::exponent_mask;
+    const uint_t low_mask = (uint_t( 1 ) << drop) - 1;
+
+    if ((w & exponent_mask) == exponent_mask)
+        return w;
+    uint_t r = (w + (low_mask >> 1) + ((w >> drop) & 1)) & ~low_mask;
+    // Rounding up the largest finite numbers gives Inf; truncate instead.
+    if ((r & exponent_mask) == exponent_mask)
+        r = w & ~low_mask;
+    return r;
+}
+
+//------------------------------------------------------------------------------
+/// @return byte mask with bit e set if byte e of w is nonzero.
+inline uint8_t nonzero_bytes( uint64_t w )
+{
+    const uint64_t low7 = 0x7f7f7f7f7f7f7f7f;
+    uint64_t t = (((w & low7) + low7) | w) & ~low7;
+    // Gather the high bit of each byte into the top byte.
+    return uint8_t( ((t >> 7) * 0x0102040810204080) >> 56 );
+}
+
+//------------------------------------------------------------------------------
+/// Encodes a byte plane of n <= packed_block_size bytes into dst:
+/// a mode byte, then nothing if the plane is zero, a bitmap of nonzero
+/// bytes followed by those bytes if that is smaller, else the plane as is.
+/// The plane is read 8 bytes at a time, so it must be padded to a
+/// multiple of 8 bytes, with zeros.
+///
+/// @return number of bytes written, at most 1 + n.
+///
+size_t encode_plane( uint8_t const* plane, size_t n, uint8_t* dst )
+{
+    size_t words = (n + 7) / 8;
+    uint8_t bitmap[ packed_block_size / 8 ];
+    size_t nnz = 0;
+    for (size_t w = 0; w < words; ++w) {
+        uint64_t word;
+        std::memcpy( &word, plane + 8*w, sizeof(word) );
+        bitmap[ w ] = nonzero_bytes( word );
+        nnz += __builtin_popcount( bitmap[ w ] );
+    }
+
+    if (nnz == 0) {
+        dst[ 0 ] = plane_zero;
+        return 1;
+    }
+    if (words + nnz >= n) {
+        dst[ 0 ] = plane_raw;
+        std::memcpy( dst + 1, plane, n );
+        return 1 + n;
+    }
+
+    dst[ 0 ] = plane_sparse;
+    std::memcpy( dst + 1, bitmap, words );
+    uint8_t* out = dst + 1 + words;
+    for (size_t w = 0; w < words; ++w) {
+        uint8_t bits = bitmap[ w ];
+        uint8_t const* pw = plane + 8*w;
+        if (bits == 0xff) {
+            std::memcpy( out, pw, 8 );
+            out += 8;
+        }
+        else if (bits != 0) {
+            for (int e = 0; e < 8; ++e) {
+                *out = pw[ e ];
+                out += (bits >> e) & 1;
+            }
+        }
+    }
+    return 1 + words + nnz;
+}
+
+//------------------------------------------------------------------------------
+/// Inverse of encode_plane; decodes n bytes.
+///
+/// @return number of bytes read.
+///
+size_t decode_plane( uint8_t const* src, size_t n, uint8_t* plane )
+{
+    switch (src[ 0 ]) {
+        case plane_zero:
+            std::memset( plane, 0, n );
+            return 1;
+
+        case plane_raw:
+            std::memcpy( plane, src + 1, n );
+            return 1 + n;
+
+        case plane_sparse: {
+            // Planes are decoded into a multiple of 8 bytes, so whole
+            // words of the bitmap are expanded.
+            size_t words = (n + 7) / 8;
+            uint8_t const* bitmap = src + 1;
+            uint8_t const* in = src + 1 + words;
+            for (size_t w = 0; w < words; ++w) {
+                uint8_t bits = bitmap[ w ];
+                uint8_t* pw = plane + 8*w;
+                if (bits == 0) {
+                    std::memset( pw, 0, 8 );
+                }
+                else if (bits == 0xff) {
+                    std::memcpy( pw, in, 8 );
+                    in += 8;
+                }
+                else {
+                    for (int e = 0; e < 8; ++e) {
+                        uint8_t bit = (bits >> e) & 1;
+                        pw[ e ] = bit ? *in : 0;
+                        in += bit;
+                    }
+                }
+            }
+            return in - src;
+        }
+
+        default:
+            slate_error( "corrupt packed tile" );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Packs one block of n <= packed_block_size numbers x into dst.
+/// The workspace is local, so the block is read and written once.
+/// Loops are over a compile-time element size, so they vectorize.
+///
+/// @return number of bytes written, at most (1 + n) sizeof(real_t).
+///
+template <typename real_t>
+size_t pack_block( real_t const* x, size_t n, int drop, uint8_t* dst )
+{
+    using uint_t = typename Bits<real_t>::type;
+    constexpr size_t elem_size = sizeof(uint_t);
+
+    uint_t words[ packed_block_size ];
+    std::memcpy( words, x, n*elem_size );
+    if (drop > 0) {
+        for (size_t e = 0; e < n; ++e)
+            words[ e ] = round_mantissa<real_t>( words[ e ], drop );
+    }
+
+    // XOR with the previous number, so slowly varying sign, exponent,
+    // and leading mantissa bits become zero, then group byte b of all
+    // numbers together, so those zeros form whole planes or sparse ones.
+    // Planes are padded with zeros to a multiple of 8 bytes.
+    size_t ld = (n + 7) / 8 * 8;
+    for (size_t e = n; e < ld; ++e)
+        words[ e ] = words[ n-1 ];
+    // Planes that are zero in every number, e.g., the dropped bits with
+    // Lossy, are found from the OR of all deltas, and not shuffled.
+    uint_t delta[ packed_block_size ];
+    delta[ 0 ] = words[ 0 ];
+    for (size_t e = 1; e < ld; ++e)
+        delta[ e ] = words[ e ] ^ words[ e-1 ];
+    uint_t nonzero = 0;
+    for (size_t e = 0; e < ld; ++e)
+        nonzero |= delta[ e ];
+
+    uint8_t plane[ packed_block_size ];
+    uint8_t* out = dst;
+    for (size_t b = 0; b < elem_size; ++b) {
+        if (uint8_t( nonzero >> 8*b ) == 0) {
+            *out++ = plane_zero;
+            continue;
+        }
+        for (size_t e = 0; e < ld; ++e)
+            plane[ e ] = uint8_t( delta[ e ] >> 8*b );
+        out += encode_plane( plane, n, out );
+    }
+    return out - dst;
+}
+
+//------------------------------------------------------------------------------
+/// Unpacks one block of n numbers x from src, packed by pack_block.
+///
+/// @return number of bytes read.
+///
+template <typename real_t>
+size_t unpack_block( uint8_t const* src, size_t n, real_t* x )
+{
+    using uint_t = typename Bits<real_t>::type;
+    constexpr size_t elem_size = sizeof(uint_t);
+
+    // Zero planes are skipped, so only nonzero planes are unshuffled.
+    uint_t words[ packed_block_size ];
+    for (size_t e = 0; e < n; ++e)
+        words[ e ] = 0;
+    uint8_t plane[ packed_block_size ];
+    uint8_t const* in = src;
+    for (size_t b = 0; b < elem_size; ++b) {
+        if (in[ 0 ] == plane_zero) {
+            ++in;
+            continue;
+        }
+        in += decode_plane( in, n, plane );
+        for (size_t e = 0; e < n; ++e)
+            words[ e ] |= uint_t( plane[ e ] ) << 8*b;
+    }
+    for (size_t e = 1; e < n; ++e)
+        words[ e ] ^= words[ e-1 ];
+    std::memcpy( x, words, n*elem_size );
+    return in - src;
+}
+
+//------------------------------------------------------------------------------
+template <typename real_t>
+void pack( real_t const* x, int64_t count, int64_t blocklength,
+           int64_t stride, TileCompression compression, double tolerance,
+           std::vector<uint8_t>& buffer )
+{
+    slate_assert( compression != TileCompression::Lossy || tolerance > 0 );
+
+    int drop = dropped_bits<real_t>( compression, tolerance );
+    bool encode = compression != TileCompression::None;
+
+    buffer.resize( packed_max_bytes( count, blocklength, sizeof(real_t) ) );
+    uint8_t* payload = buffer.data() + packed_header_bytes;
+    uint8_t* out = payload;
+    if (encode) {
+        // Encoding is several times slower than a copy, so after the
+        // first packed_sample_size numbers, or the whole tile if smaller,
+        // give up and store the tile raw unless the sample packed to at
+        // most packed_max_ratio of its size.
+        int64_t sampled = 0;
+        for (int64_t k = 0; k < count; ++k) {
+            real_t const* xk = x + k*stride;
+            for (int64_t i = 0; i < blocklength; i += packed_block_size) {
+                size_t n = std::min( size_t( blocklength - i ),
+                                     packed_block_size );
+                out += pack_block( xk + i, n, drop, out );
+            }
+            if (sampled >= 0) {
+                sampled += blocklength;
+                if (sampled >= int64_t( packed_sample_size )
+                    || k == count - 1) {
+                    double ratio = double( out - payload )
+                                 / (sampled * sizeof(real_t));
+                    if (ratio > packed_max_ratio) {
+                        encode = false;
+                        out = payload;
+                        break;
+                    }
+                    sampled = -1;
+                }
+            }
+        }
+    }
+    if (! encode) {
+        for (int64_t k = 0; k < count; ++k) {
+            std::memcpy( out, x + k*stride, blocklength*sizeof(real_t) );
+            out += blocklength*sizeof(real_t);
+        }
+    }
+
+    uint64_t payload_bytes = out - payload;
+    std::memset( buffer.data(), 0, packed_header_bytes );
+    buffer[ 0 ] = encode ? flag_encoded : 0;
+    std::memcpy( buffer.data() + 8, &payload_bytes, sizeof(payload_bytes) );
+    buffer.resize( packed_header_bytes + payload_bytes );
+}
+
+//------------------------------------------------------------------------------
+template <typename real_t>
+void unpack( uint8_t const* buffer, real_t* x, int64_t count,
+             int64_t blocklength, int64_t stride )
+{
+    bool encoded = buffer[ 0 ] & flag_encoded;
+    uint8_t const* in = buffer + packed_header_bytes;
+    for (int64_t k = 0; k < count; ++k) {
+        real_t* xk = x + k*stride;
+        if (encoded) {
+            for (int64_t i = 0; i < blocklength; i += packed_block_size) {
+                size_t n = std::min( size_t( blocklength - i ),
+                                     packed_block_size );
+                in += unpack_block( in, n, xk + i );
+            }
+        }
+        else {
+            std::memcpy( xk, in, blocklength*sizeof(real_t) );
+            in += blocklength*sizeof(real_t);
+        }
+    }
+    slate_assert( size_t( in - buffer ) == packed_bytes( buffer ) );
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Packs count columns of blocklength real numbers x, with leading
+/// dimension stride, into buffer, with the given compression.
+/// Complex numbers are packed as pairs of reals.
+///
+/// With TileCompression::Lossy, each normalized number x is rounded to
+/// $\tilde{x}$ with $|x - \tilde{x}| \le$ tolerance $|x|$, by dropping
+/// low mantissa bits. Inf and NaN are kept exactly.
+///
+/// Data that does not compress, judged from a sample, is stored raw,
+/// which also keeps it exact with TileCompression::Lossy.
+///
+void pack_reals(
+    float const* x, int64_t count, int64_t blocklength, int64_t stride,
+    TileCompression compression, double tolerance,
+    std::vector<uint8_t>& buffer )
+{
+    pack( x, count, blocklength, stride, compression, tolerance, buffer );
+}
+
+//------------------------------------------------------------------------------
+/// @see pack_reals
+void pack_reals(
+    double const* x, int64_t count, int64_t blocklength, int64_t stride,
+    TileCompression compression, double tolerance,
+    std::vector<uint8_t>& buffer )
+{
+    pack( x, count, blocklength, stride, compression, tolerance, buffer );
+}
+
+//------------------------------------------------------------------------------
+/// Unpacks count columns of blocklength real numbers x, with leading
+/// dimension stride, from buffer, packed by pack_reals.
+///
+void unpack_reals(
+    uint8_t const* buffer,
+    float* x, int64_t count, int64_t blocklength, int64_t stride )
+{
+    unpack( buffer, x, count, blocklength, stride );
+}
+
+//------------------------------------------------------------------------------
+/// @see unpack_reals
+void unpack_reals(
+    uint8_t const* buffer,
+    double* x, int64_t count, int64_t blocklength, int64_t stride )
+{
+    unpack( buffer, x, count, blocklength, stride );
+}
+
+} // namespace internal
+} // namespace slate
@@ -0,0 +1,171 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+#include <cmath>
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel matrix exponential.
+///
+/// Computes $\exp(A)$ by scaling and squaring with the [13/13] Pade
+/// approximant (Higham, SIAM J. Matrix Anal. Appl., 2005):
+/// $A$ is scaled by $2^{-s}$ so that $\|A\|_1 \le \theta_{13}$,
+/// the Pade approximant $r_{13} = (V - U)^{-1} (V + U)$ is formed with
+/// 6 gemm and one LU solve, then squared $s$ times.
+/// All the work is in gemm, getrf, and getrs.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n matrix $A$.
+///     On exit, overwritten by $\exp(A)$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::InnerBlocking:
+///       Inner blocking to use for panel. Default 16.
+///     - Option::MaxPanelThreads:
+///       Number of threads to use for panel. Default omp_get_max_threads()/2.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup matfun
+///
+template <typename scalar_t>
+void expm(
+    Matrix<scalar_t>& A,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    // Coefficients of the [13/13] Pade approximant, and the largest
+    // 1-norm for which it is accurate to double precision.
+    const double b[] = {
+        64764752532480000., 32382376266240000., 7771770303897600.,
+        1187353796428800.,  129060195264000.,   10559470521600.,
+        670442572800.,      33522128640.,       1323241920.,
+        40840800.,          960960.,            16380.,
+        182.,               1.
+    };
+    const double theta13 = 5.371920351148152;
+
+    slate_assert( A.m() == A.n() );
+    if (A.n() == 0)
+        return;
+
+    // Scale A by 2^{-s}.
+    real_t A_norm = norm( Norm::One, A, opts );
+    int s = 0;
+    if (A_norm > theta13)
+        s = int( std::ceil( std::log2( A_norm / theta13 ) ) );
+    if (s > 0)
+        scale( real_t( 1.0 ), real_t( std::ldexp( 1.0, s ) ), A, opts );
+
+    auto A2 = A.emptyLike();
+    auto A4 = A.emptyLike();
+    auto A6 = A.emptyLike();
+    auto U  = A.emptyLike();
+    auto V  = A.emptyLike();
+    auto W  = A.emptyLike();
+    A2.insertLocalTiles();
+    A4.insertLocalTiles();
+    A6.insertLocalTiles();
+    U.insertLocalTiles();
+    V.insertLocalTiles();
+    W.insertLocalTiles();
+
+    gemm( one, A,  A,  zero, A2, opts );
+    gemm( one, A2, A2, zero, A4, opts );
+    gemm( one, A4, A2, zero, A6, opts );
+
+    // U = A [ A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I ].
+    slate::copy( A6, W, opts );
+    scale( real_t( b[ 13 ] ), real_t( 1.0 ), W, opts );
+    add( scalar_t( b[ 11 ] ), A4, one, W, opts );
+    add( scalar_t( b[  9 ] ), A2, one, W, opts );
+    set( zero, scalar_t( b[ 1 ] ), V, opts );
+    add( scalar_t( b[ 7 ] ), A6, one, V, opts );
+    add( scalar_t( b[ 5 ] ), A4, one, V, opts );
+    add( scalar_t( b[ 3 ] ), A2, one, V, opts );
+    gemm( one, A6, W, one, V, opts );
+    gemm( one, A, V, zero, U, opts );
+
+    // V = A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I.
+    slate::copy( A6, W, opts );
+    scale( real_t( b[ 12 ] ), real_t( 1.0 ), W, opts );
+    add( scalar_t( b[ 10 ] ), A4, one, W, opts );
+    add( scalar_t( b[  8 ] ), A2, one, W, opts );
+    set( zero, scalar_t( b[ 0 ] ), V, opts );
+    add( scalar_t( b[ 6 ] ), A6, one, V, opts );
+    add( scalar_t( b[ 4 ] ), A4, one, V, opts );
+    add( scalar_t( b[ 2 ] ), A2, one, V, opts );
+    gemm( one, A6, W, one, V, opts );
+
+    A2.clear();
+    A4.clear();
+    A6.clear();
+
+    // Solve (V - U) R = (V + U), with R in U.
+    slate::copy( V, W, opts );
+    add( -one, U, one, W, opts );
+    add( one, V, one, U, opts );
+    V.clear();
+
+    Pivots pivots;
+    gesv( W, pivots, U, opts );
+
+    // Square s times, alternating between A and W so the last product
+    // is in A.
+    Matrix<scalar_t> R = U;
+    for (int i = 0; i < s; ++i) {
+        Matrix<scalar_t> R_next = ((s - i) % 2 == 1) ? A : W;
+        gemm( one, R, R, zero, R_next, opts );
+        R = R_next;
+    }
+    if (s == 0)
+        slate::copy( U, A, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void expm<float>(
+    Matrix<float>& A,
+    Options const& opts);
+
+template
+void expm<double>(
+    Matrix<double>& A,
+    Options const& opts);
+
+template
+void expm< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void expm< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Options const& opts);
+
+} // namespace slate
@@ -61,19 +61,18 @@ void ge2tb(
     auto TVreduce = TV[1];
     auto TVlocalT = A.emptyLike(nb, nb, Op::ConjTrans);
 
-    // workspace
-    auto W = A.emptyLike();
+    // workspace: one tile row of Wr and one tile col of Wc per MPI process,
+    // for the QR and LQ updates, respectively
+    auto Wr = internal::unmqr_workspace( Side::Left,  A );
+    auto Wc = internal::unmqr_workspace( Side::Right, A );
 
     if (target == Target::Devices) {
         A.allocateBatchArrays();
         A.reserveDeviceWorkspace();
-        W.allocateBatchArrays();
-        // todo: this is demanding too much device workspace memory
-        // only one tile-row and one tile-col of matrix W per MPI process
-        // is going to be used, but W with size of whole A is being allocated
-        // thus limiting the matrix size that can be processed
-        // For now, allocate workspace tiles 1-by-1.
-        //W.reserveDeviceWorkspace();
+        Wr.allocateBatchArrays();
+        Wr.reserveDeviceWorkspace();
+        Wc.allocateBatchArrays();
+        Wc.reserveDeviceWorkspace();
     }
 
     // Workspace for transposed panels needs one column of tiles.
@@ -191,7 +190,7 @@ void ge2tb(
                                 std::move(U_panel),
                                 std::move(TUl_panel),
                                 std::move(A_trail_j),
-                                W.sub(k, A_mt-1, j, A_nt-1));
+                                Wr.sub(0, 0, j, A_nt-1));
 
                 // Apply triangle-triangle reduction reflectors
                 // ttmqr handles the tile broadcasting internally
@@ -342,7 +341,7 @@ void ge2tb(
                                     std::move(V_panel),
                                     std::move(TVl_panel),
                                     std::move(A_trail_i),
-                                    W.sub(i, A_mt-1, k+1, A_nt-1));
+                                    Wc.sub(i, A_mt-1, 0, 0));
 
                     // Apply triangle-triangle reduction reflectors
                     // ttmlq handles the tile broadcasting internally
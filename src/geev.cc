@@ -0,0 +1,327 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Schur decomposition, $A = Z T Z^H$, and optionally
+/// eigenvectors. Shared by gees and geev.
+///
+/// @param[in] want_schur
+///     If true, $A$ is overwritten by the Schur form $T$.
+///
+/// @param[in] want_eigvec
+///     If true and Z is not empty, Z is overwritten by right eigenvectors;
+///     otherwise by Schur vectors.
+///
+/// @ingroup geev_impl
+///
+template <typename scalar_t>
+void gees(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& Z,
+    bool want_schur, bool want_eigvec,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    slate_assert( A.op() == Op::NoTrans );
+    slate_assert( A.m() == A.n() );
+
+    int64_t n = A.n();
+    bool wantz = (Z.mt() > 0);
+    want_eigvec = want_eigvec && wantz;
+
+    // 1. Reduce to Hessenberg form, A = Q H Q^H, and form Z = Q.
+    TriangularFactors<scalar_t> T;
+    gehrd( A, T, opts );
+    if (wantz) {
+        set( zero, one, Z, opts );
+        unmhr( Side::Left, Op::NoTrans, A, T, Z, opts );
+    }
+
+    // Zero the reflectors below the first subdiagonal, leaving H.
+    int64_t jj = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        int64_t ii = 0;
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            int64_t mb = A.tileMb( i );
+            if (A.tileIsLocal( i, j ) && ii + mb - 1 > jj + 1) {
+                A.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                auto Aij = A( i, j );
+                for (int64_t c = 0; c < Aij.nb(); ++c) {
+                    for (int64_t r = std::max( int64_t( 0 ), jj + c + 2 - ii );
+                         r < mb; ++r) {
+                        Aij.at( r, c ) = zero;
+                    }
+                }
+            }
+            ii += mb;
+        }
+        jj += A.tileNb( j );
+    }
+
+    // 2. Multishift Hessenberg QR with aggressive early deflation,
+    // H = Z2 T Z2^H, with Z = Q Z2.
+    if (want_schur || wantz)
+        hseqr( A, Lambda, Z, opts );
+    else
+        hseqr( A, Lambda, opts );
+
+    // 3. Eigenvectors X of T, back-transformed, Z = Q Z2 X,
+    // normalized to unit 2-norm.
+    if (want_eigvec) {
+        auto X = Z.emptyLike();
+        X.insertLocalTiles();
+        trevc( A, X, opts );
+
+        auto Z_copy = Z.emptyLike();
+        Z_copy.insertLocalTiles();
+        slate::copy( Z, Z_copy, opts );
+        gemm( one, Z_copy, X, zero, Z, opts );
+
+        // Column norms, from local sums of squares.
+        std::vector<real_t> local( n, 0.0 ), sumsq( n );
+        jj = 0;
+        for (int64_t j = 0; j < Z.nt(); ++j) {
+            for (int64_t i = 0; i < Z.mt(); ++i) {
+                if (Z.tileIsLocal( i, j )) {
+                    Z.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                    auto Zij = Z( i, j );
+                    for (int64_t c = 0; c < Zij.nb(); ++c) {
+                        for (int64_t r = 0; r < Zij.mb(); ++r)
+                            local[ jj + c ] += std::norm( Zij( r, c ) );
+                    }
+                }
+            }
+            jj += Z.tileNb( j );
+        }
+        slate_mpi_call(
+            MPI_Allreduce( local.data(), sumsq.data(), n,
+                           mpi_type<real_t>::value, MPI_SUM, Z.mpiComm() ) );
+
+        std::vector<real_t> col_scale( n );
+        for (int64_t j = 0; j < n; ++j) {
+            if (! is_complex<scalar_t>::value
+                && std::imag( Lambda[ j ] ) != 0) {
+                // Complex pair; columns j, j+1 are real and imag parts.
+                real_t s = 1 / std::sqrt( sumsq[ j ] + sumsq[ j+1 ] );
+                col_scale[ j ] = s;
+                col_scale[ j+1 ] = s;
+                ++j;
+            }
+            else {
+                col_scale[ j ] = 1 / std::sqrt( sumsq[ j ] );
+            }
+        }
+
+        jj = 0;
+        for (int64_t j = 0; j < Z.nt(); ++j) {
+            for (int64_t i = 0; i < Z.mt(); ++i) {
+                if (Z.tileIsLocal( i, j )) {
+                    Z.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                    auto Zij = Z( i, j );
+                    for (int64_t c = 0; c < Zij.nb(); ++c) {
+                        blas::scal( Zij.mb(), scalar_t( col_scale[ jj + c ] ),
+                                    &Zij.at( 0, c ), 1 );
+                    }
+                }
+            }
+            jj += Z.tileNb( j );
+        }
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Schur decomposition of a general matrix.
+///
+/// Computes the Schur form $T$, eigenvalues, and optionally the Schur
+/// vectors $Z$ of an n-by-n non-symmetric matrix $A$:
+/// \[
+///     A = Z T Z^H.
+/// \]
+/// For complex types, $T$ is upper triangular. For real types, $T$ is
+/// upper quasi-triangular, with 1-by-1 and 2-by-2 diagonal blocks; each
+/// 2-by-2 block holds a pair of complex conjugate eigenvalues.
+///
+/// $A$ is reduced to Hessenberg form by a distributed blocked reduction
+/// (see gehrd); then distributed multishift Hessenberg QR with aggressive
+/// early deflation computes $T$ (see hseqr).
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n matrix $A$.
+///     On exit, the Schur form $T$.
+///
+/// @param[out] Lambda
+///     The vector Lambda of length n.
+///     If successful, the eigenvalues, in the order of the diagonal of $T$.
+///     For real types, complex conjugate pairs appear consecutively,
+///     with positive imaginary part first.
+///
+/// @param[out] Z
+///     On entry, if Z is empty, does not compute Schur vectors.
+///     Otherwise, the n-by-n matrix $Z$ to store Schur vectors,
+///     with the same tile size as $A$.
+///     On exit, the unitary Schur vectors $Z$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// Throws an exception if Hessenberg QR fails to converge.
+///
+/// @ingroup geev
+///
+template <typename scalar_t>
+void gees(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts)
+{
+    impl::gees( A, Lambda, Z, true, false, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel eigen decomposition of a general matrix.
+///
+/// Computes all eigenvalues and, optionally, right eigenvectors $V$ of an
+/// n-by-n non-symmetric matrix $A$:
+/// \[
+///     A V = V \Lambda.
+/// \]
+/// The Schur decomposition $A = Z T Z^H$ is computed as in gees,
+/// then eigenvectors of $T$ are computed with recursive blocking (see
+/// trevc) and back-transformed by $Z$ with gemm.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n matrix $A$.
+///     On exit, contents are destroyed.
+///
+/// @param[out] Lambda
+///     The vector Lambda of length n.
+///     If successful, the eigenvalues. For real types, complex conjugate
+///     pairs appear consecutively, with positive imaginary part first.
+///
+/// @param[out] V
+///     On entry, if V is empty, does not compute eigenvectors.
+///     Otherwise, the n-by-n matrix $V$ to store eigenvectors,
+///     with the same tile size as $A$.
+///     On exit, the right eigenvectors, each with unit 2-norm,
+///     stored in the same order as Lambda.
+///     For real types, if Lambda(j), Lambda(j+1) are a complex conjugate
+///     pair, columns j and j+1 hold the real and imaginary parts of the
+///     eigenvector for Lambda(j), $v_j + i v_{j+1}$; the eigenvector for
+///     Lambda(j+1) is its conjugate.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// Throws an exception if Hessenberg QR fails to converge.
+///
+/// @ingroup geev
+///
+template <typename scalar_t>
+void geev(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& V,
+    Options const& opts)
+{
+    impl::gees( A, Lambda, V, false, true, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gees<float>(
+    Matrix<float>& A,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix<float>& Z,
+    Options const& opts);
+
+template
+void gees<double>(
+    Matrix<double>& A,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix<double>& Z,
+    Options const& opts);
+
+template
+void gees< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix< std::complex<float> >& Z,
+    Options const& opts);
+
+template
+void gees< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix< std::complex<double> >& Z,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void geev<float>(
+    Matrix<float>& A,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix<float>& V,
+    Options const& opts);
+
+template
+void geev<double>(
+    Matrix<double>& A,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix<double>& V,
+    Options const& opts);
+
+template
+void geev< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix< std::complex<float> >& V,
+    Options const& opts);
+
+template
+void geev< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix< std::complex<double> >& V,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,278 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_schur.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel reduction to upper Hessenberg form, for the
+/// non-symmetric eigenvalue problem.
+///
+/// Reduces an n-by-n matrix $A$ to upper Hessenberg form $H$ using unitary
+/// similarity transformations:
+/// \[
+///     A = Q H Q^H.
+/// \]
+/// Each block column k is a panel, as in LAPACK gehrd. The panel is
+/// gathered to the owner of tile (k, k), where each column is updated by
+/// the previous reflectors of the panel and a new reflector is generated.
+/// Its product with the trailing matrix is done by all ranks on their
+/// local tiles and reduced to the owner. After the panel, the trailing
+/// matrix is updated from the right, $A = A - Y V^H$ with $Y = A V T$,
+/// and from the left, $A = A - V T^H V^H A$, by distributed gemm.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n matrix $A$.
+///     On exit, the elements on and above the first subdiagonal represent
+///     the Hessenberg matrix $H$. The elements below the first subdiagonal,
+///     along with T, represent the unitary matrix $Q$ as a product of
+///     elementary reflectors.
+///
+/// @param[out] T
+///     On exit, triangular matrices of the block reflectors for Q.
+///     The one for panel k is stored in tile (k, k) of T[ 0 ].
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target for the trailing matrix update.
+///       Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///     Note a lookahead is not possible with gehrd due to dependencies from
+///     updating on both left and right sides.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void gehrd(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Options const& opts )
+{
+    using blas::conj;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const Layout col_major = Layout::ColMajor;
+
+    slate_assert( A.op() == Op::NoTrans );
+    slate_assert( A.m() == A.n() );
+
+    int64_t n = A.n();
+    int mpi_rank = A.mpiRank();
+    MPI_Comm comm = A.mpiComm();
+
+    T.clear();
+    T.push_back( A.emptyLike() );
+    auto Tlocal = T[ 0 ];
+
+    // Workspaces with the distribution of A, for the explicit reflectors V,
+    // Y = A V T, and W = V^H A.
+    auto V = A.emptyLike();
+    auto Y = A.emptyLike();
+    auto W = A.emptyLike();
+
+    int64_t k0 = 0;
+    for (int64_t k = 0; k < A.nt() && k0 < n-1; k0 += A.tileNb( k ), ++k) {
+        int64_t b  = std::min( A.tileNb( k ), n-1-k0 );
+        int64_t c0 = k0 + b;
+        int64_t mp = n-1-k0;
+        int root = A.tileRank( k, k );
+        bool is_root = (mpi_rank == root);
+
+        auto A_panel = A.slice( k0+1, n-1, k0, c0-1 );
+        auto A_trail = A.slice( k0+1, n-1, k0+1, n-1 );
+
+        //--------------------
+        // Panel, on root: P is the panel, with columns of V, Y, and T
+        // of the block reflector accumulated as they are generated.
+        std::vector<scalar_t> P, Vp, Yp, Tp;
+        if (is_root) {
+            P.resize( mp*b );
+            Vp.resize( mp*b, zero );
+            Yp.resize( mp*b, zero );
+            Tp.resize( b*b, zero );
+        }
+        internal::copy_block( A_panel, P.data(), mp, root, false );
+
+        // The trailing matrix is not modified during the panel.
+        A_trail.tileGetAllForReading( HostNum, LayoutConvert::ColMajor );
+        std::vector<int64_t> row_offset( A_trail.mt()+1, 0 );
+        std::vector<int64_t> col_offset( A_trail.nt()+1, 0 );
+        for (int64_t i = 0; i < A_trail.mt(); ++i)
+            row_offset[ i+1 ] = row_offset[ i ] + A_trail.tileMb( i );
+        for (int64_t j = 0; j < A_trail.nt(); ++j)
+            col_offset[ j+1 ] = col_offset[ j ] + A_trail.tileNb( j );
+
+        std::vector<scalar_t> v( mp ), y( mp ), y_local( mp ), w( b );
+        for (int64_t i = 0; i < b; ++i) {
+            scalar_t tau = zero;
+            if (is_root) {
+                scalar_t* a = &P[ i*mp ];
+                if (i > 0) {
+                    // Apply the previous reflectors of the panel to
+                    // column i: a = (I - V T^H V^H) (a - Y V(i-1, :)^H).
+                    for (int64_t c = 0; c < i; ++c) {
+                        blas::axpy( mp, -conj( Vp[ i-1 + c*mp ] ),
+                                    &Yp[ c*mp ], 1, a, 1 );
+                    }
+                    blas::gemv( col_major, Op::ConjTrans, mp, i,
+                                one, Vp.data(), mp, a, 1, zero, w.data(), 1 );
+                    blas::trmv( col_major, Uplo::Upper, Op::ConjTrans,
+                                Diag::NonUnit, i, Tp.data(), b, w.data(), 1 );
+                    blas::gemv( col_major, Op::NoTrans, mp, i,
+                                -one, Vp.data(), mp, w.data(), 1, one, a, 1 );
+                }
+                scalar_t alpha = a[ i ];
+                lapack::larfg( mp-i, &alpha, &a[ i+1 ], 1, &tau );
+                a[ i ] = alpha;
+
+                std::fill( v.begin(), v.begin() + i, zero );
+                v[ i ] = one;
+                std::copy( &a[ i+1 ], &a[ mp ], &v[ i+1 ] );
+                std::copy( v.begin(), v.end(), &Vp[ i*mp ] );
+            }
+            slate_mpi_call(
+                MPI_Bcast( v.data(), mp, mpi_type<scalar_t>::value,
+                           root, comm ) );
+
+            // y = A_trail v, on local tiles, summed on root.
+            // Tile columns left of row i of v are zero and skipped.
+            std::fill( y_local.begin(), y_local.end(), zero );
+            #pragma omp parallel for schedule( dynamic, 1 )
+            for (int64_t ti = 0; ti < A_trail.mt(); ++ti) {
+                for (int64_t tj = 0; tj < A_trail.nt(); ++tj) {
+                    if (A_trail.tileIsLocal( ti, tj )
+                        && col_offset[ tj+1 ] > i) {
+                        auto Aij = A_trail( ti, tj );
+                        blas::gemv( col_major, Op::NoTrans,
+                                    Aij.mb(), Aij.nb(),
+                                    one, Aij.data(), Aij.stride(),
+                                         &v[ col_offset[ tj ] ], 1,
+                                    one, &y_local[ row_offset[ ti ] ], 1 );
+                    }
+                }
+            }
+            slate_mpi_call(
+                MPI_Reduce( y_local.data(), y.data(), mp,
+                            mpi_type<scalar_t>::value, MPI_SUM, root, comm ) );
+
+            if (is_root) {
+                scalar_t* t = &Tp[ i*b ];
+                if (i > 0) {
+                    // t = V^H v; y = y - Y t; t = -tau T t.
+                    blas::gemv( col_major, Op::ConjTrans, mp, i,
+                                one, Vp.data(), mp, v.data(), 1, zero, t, 1 );
+                    blas::gemv( col_major, Op::NoTrans, mp, i,
+                                -one, Yp.data(), mp, t, 1, one, y.data(), 1 );
+                    blas::trmv( col_major, Uplo::Upper, Op::NoTrans,
+                                Diag::NonUnit, i, Tp.data(), b, t, 1 );
+                    blas::scal( i, -tau, t, 1 );
+                }
+                t[ i ] = tau;
+                for (int64_t r = 0; r < mp; ++r)
+                    Yp[ r + i*mp ] = tau * y[ r ];
+            }
+        }
+
+        //--------------------
+        // Scatter the panel, Y, and T; V is rebuilt from A locally.
+        internal::copy_block( A_panel, P.data(), mp, root, true );
+
+        auto V_panel = V.slice( k0+1, n-1, k0, c0-1 );
+        V_panel.insertLocalTiles();
+        internal::copy_reflectors( A_panel, V_panel );
+
+        auto Y_low = Y.slice( k0+1, n-1, k0, c0-1 );
+        Y_low.insertLocalTiles();
+        internal::copy_block( Y_low, Yp.data(), mp, root, true );
+
+        auto T_panel = Tlocal.slice( k0, c0-1, k0, c0-1 );
+        T_panel.insertLocalTiles();
+        internal::copy_block( T_panel, Tp.data(), b, root, true );
+        auto Tk = TriangularMatrix<scalar_t>(
+            Uplo::Upper, Diag::NonUnit, T_panel );
+
+        //--------------------
+        // Rows above the panel of Y = A V T, from the not yet updated A.
+        auto A_top = A.slice( 0, k0, k0+1, n-1 );
+        auto Y_top = Y.slice( 0, k0, k0, c0-1 );
+        Y_top.insertLocalTiles();
+        slate::gemm( one, A_top, V_panel, zero, Y_top, opts );
+        slate::trmm( Side::Right, one, Tk, Y_top, opts );
+
+        //--------------------
+        // Update from the right, A = A - Y V^H, on the columns right of
+        // the panel, and on the rows above the panel in its columns;
+        // the panel's own rows were updated during the panel.
+        // Since b <= n-1-k0, there is at least one column right of it.
+        auto Y_all = Y.slice( 0, n-1, k0, c0-1 );
+        auto V_bot = V.slice( c0, n-1, k0, c0-1 );
+        auto VH_bot = conj_transpose( V_bot );
+        auto A_right = A.slice( 0, n-1, c0, n-1 );
+        slate::gemm( -one, Y_all, VH_bot, one, A_right, opts );
+
+        if (b > 1) {
+            auto V_top = V.slice( k0+1, c0-1, k0, c0-1 );
+            auto VH_top = conj_transpose( V_top );
+            auto A_mid = A.slice( 0, k0, k0+1, c0-1 );
+            slate::gemm( -one, Y_top, VH_top, one, A_mid, opts );
+        }
+
+        //--------------------
+        // Update from the left, A = A - V T^H V^H A, on the trailing matrix.
+        auto VH = conj_transpose( V_panel );
+        auto TkH = conj_transpose( Tk );
+        auto A_br = A.slice( k0+1, n-1, c0, n-1 );
+        auto W_panel = W.slice( k0, c0-1, c0, n-1 );
+        W_panel.insertLocalTiles();
+        slate::gemm( one, VH, A_br, zero, W_panel, opts );
+        slate::trmm( Side::Left, one, TkH, W_panel, opts );
+        slate::gemm( -one, V_panel, W_panel, one, A_br, opts );
+    }
+
+    A.tileUpdateAllOrigin();
+    A.releaseWorkspace();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gehrd<float>(
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Options const& opts);
+
+template
+void gehrd<double>(
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Options const& opts);
+
+template
+void gehrd< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Options const& opts);
+
+template
+void gehrd< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Options const& opts);
+
+} // namespace slate
@@ -58,8 +58,8 @@ void gelqf(
     auto Treduce = T[1];
     auto TlocalT = A.emptyLike(nb, nb, Op::ConjTrans);
 
-    // workspace
-    auto W = A.emptyLike();
+    // workspace: one tile col of W per MPI process
+    auto W = internal::unmqr_workspace( Side::Right, A );
 
     int64_t num_devices  = A.num_devices();
     int     panel_device = -1;
@@ -72,12 +72,7 @@ void gelqf(
         A.allocateBatchArrays();
         A.reserveDeviceWorkspace();
         W.allocateBatchArrays();
-        // todo: this is demanding too much device workspace memory
-        // only one tile-row of matrix W per MPI process is going to be used,
-        // but W with size of whole A is being allocated
-        // thus limiting the matrix size that can be processed
-        // For now, allocate workspace tiles 1-by-1.
-        //W.reserveDeviceWorkspace();
+        W.reserveDeviceWorkspace();
 
         // Needed for calling internal::geqrf on device.
         int64_t mlocal = 0;
@@ -273,7 +268,7 @@ void gelqf(
                                     std::move(A_panel),
                                     std::move(Tl_panel),
                                     std::move(A_trail_i),
-                                    W.sub(i, i, k, A_nt-1));
+                                    W.sub(i, i, 0, 0));
 
                     // Apply triangle-triangle reduction reflectors
                     // ttmlq handles the tile broadcasting internally
@@ -301,7 +296,7 @@ void gelqf(
                                     std::move(A_panel),
                                     std::move(Tl_panel),
                                     std::move(A_trail_i),
-                                    W.sub(i, A_mt-1, k, A_nt-1));
+                                    W.sub(i, A_mt-1, 0, 0));
 
                     // Apply triangle-triangle reduction reflectors
                     // ttmlq handles the tile broadcasting internally
@@ -0,0 +1,202 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "slate/TrapezoidMatrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel rank-revealing least squares solve via QR
+/// factorization with column pivoting.
+///
+/// Computes the minimum norm solution to a linear least squares problem
+/// \[
+///     \min_X \norm{ A X - B }_2,
+/// \]
+/// where the m-by-n matrix $A$ may be rank-deficient, as LAPACK gelsy.
+///
+/// First, $A$ is factored with column pivoting by geqp3, $A P = Q R$.
+/// The effective rank r is the number of leading diagonal entries of $R$
+/// with $|R(i,i)| > rcond |R(0,0)|$, so the trailing
+/// (min(m,n) - r)-by-(n - r) block of $R$ is treated as zero.
+/// Then the leading r rows of $R$, $[ R_{11}, R_{12} ]$, are factored by
+/// gelqf as $L Z$, and the minimum norm solution is
+/// \[
+///     X = P Z^H \begin{bmatrix} L^{-1} (Q^H B)_{1:r} \\ 0 \end{bmatrix}.
+/// \]
+/// If r = n, the LQ factorization is skipped, as in gels.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$, not transposed.
+///     On exit, $A$ is overwritten by its QR factorization with column
+///     pivoting, as returned by geqp3.
+///
+/// @param[in,out] BX
+///     Matrix of size max(m,n)-by-nrhs, with the same tile size as $A$.
+///     On entry, the m-by-nrhs right hand side matrix $B$.
+///     On exit, the n-by-nrhs minimum norm solution matrix $X$.
+///
+/// @param[in] rcond
+///     Used to determine the effective rank of $A$, which is the largest
+///     leading triangle of $R$ with condition number less than 1/rcond.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///     - Other options are passed to geqp3, gelqf, unmqr, unmlq, and trsm.
+///
+/// @return the effective rank r of $A$.
+///
+/// @ingroup gels
+///
+template <typename scalar_t>
+int64_t gelsy(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& BX,
+    blas::real_type<scalar_t> rcond,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t one  = 1.0;
+    const scalar_t zero = 0.0;
+
+    slate_assert( A.op() == Op::NoTrans );
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t nrhs = BX.n();
+    int64_t min_mn = std::min( m, n );
+    int64_t A_mt = A.mt();
+    int64_t A_nt = A.nt();
+
+    // A P = Q R
+    TriangularFactors<scalar_t> T;
+    Pivots pivots;
+    geqp3( A, T, pivots, opts );
+
+    // Gather |R(i, i)| from the tiles owning the diagonal.
+    std::vector<real_t> local_diag( min_mn, 0.0 ), diag( min_mn );
+    int64_t ii = 0;
+    for (int64_t i = 0; i < A_mt; ++i) {
+        int64_t jj = 0;
+        for (int64_t j = 0; j < A_nt; ++j) {
+            int64_t d_begin = std::max( ii, jj );
+            int64_t d_end   = std::min( ii + A.tileMb( i ), jj + A.tileNb( j ) );
+            if (d_begin < d_end && A.tileIsLocal( i, j )) {
+                A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                auto Aij = A( i, j );
+                for (int64_t d = d_begin; d < d_end; ++d)
+                    local_diag[ d ] = std::abs( Aij( d - ii, d - jj ) );
+            }
+            jj += A.tileNb( j );
+        }
+        ii += A.tileMb( i );
+    }
+    slate_mpi_call(
+        MPI_Allreduce( local_diag.data(), diag.data(), min_mn,
+                       mpi_type<real_t>::value, MPI_MAX, A.mpiComm() ) );
+
+    // Effective rank. The diagonal is roughly decreasing due to pivoting.
+    int64_t rank = 0;
+    while (rank < min_mn && diag[ rank ] > rcond * diag[ 0 ])
+        ++rank;
+
+    auto X = BX.slice( 0, n-1, 0, nrhs-1 );
+    if (rank == 0) {
+        set( zero, X, opts );
+        return rank;
+    }
+
+    // Y = Q^H B, with B the first m rows of BX.
+    auto B = BX.slice( 0, m-1, 0, nrhs-1 );
+    unmqr( Side::Left, Op::ConjTrans, A, T, B, opts );
+
+    auto Y1 = BX.slice( 0, rank-1, 0, nrhs-1 );
+    if (rank == n) {
+        // Full rank, X = R^{-1} Y.
+        auto R_ = A.slice( 0, n-1, 0, n-1 );
+        auto R = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, R_ );
+        trsm( Side::Left, one, R, Y1, opts );
+    }
+    else {
+        // [ R11, R12 ] = L Z, in a copy of the leading rank rows of R.
+        auto R_ = A.slice( 0, rank-1, 0, n-1 );
+        auto Z = R_.emptyLike();
+        Z.insertLocalTiles();
+        set( zero, Z, opts );
+        auto Ru = TrapezoidMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, R_ );
+        auto Zu = TrapezoidMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, Z );
+        slate::copy( Ru, Zu, opts );
+
+        TriangularFactors<scalar_t> TZ;
+        gelqf( Z, TZ, opts );
+
+        // Y1 = L^{-1} Y1
+        auto L_ = Z.slice( 0, rank-1, 0, rank-1 );
+        auto L = TriangularMatrix<scalar_t>( Uplo::Lower, Diag::NonUnit, L_ );
+        trsm( Side::Left, one, L, Y1, opts );
+
+        // X = Z^H [ Y1; 0 ]
+        auto Y2 = BX.slice( rank, n-1, 0, nrhs-1 );
+        set( zero, Y2, opts );
+        unmlq( Side::Left, Op::ConjTrans, Z, TZ, X, opts );
+    }
+
+    // X = P X, undoing the column swaps in reverse order.
+    for (int64_t k = int64_t( pivots.size() ) - 1; k >= 0; --k) {
+        internal::permuteRows<Target::HostTask>(
+            Direction::Backward, X.sub( k, X.mt()-1, 0, X.nt()-1 ),
+            pivots.at( k ), Layout::ColMajor, 0, k );
+    }
+
+    return rank;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gelsy<float>(
+    Matrix<float>& A,
+    Matrix<float>& BX,
+    float rcond,
+    Options const& opts);
+
+template
+int64_t gelsy<double>(
+    Matrix<double>& A,
+    Matrix<double>& BX,
+    double rcond,
+    Options const& opts);
+
+template
+int64_t gelsy< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& BX,
+    float rcond,
+    Options const& opts);
+
+template
+int64_t gelsy< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& BX,
+    double rcond,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,245 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+#include <cmath>
+#include <limits>
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Lyapunov equation solve.
+///
+/// Solves
+/// \[
+///     A X + X A^H = C,
+/// \]
+/// by the Bartels-Stewart method: reduce $A = Z T Z^H$ to Schur form
+/// with gees, transform $C = Z^H C Z$, solve the triangular equation
+/// $T X + X T^H = C$ with trsyl, and transform back $X = Z X Z^H$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n matrix $A$.
+///     On exit, overwritten by its Schur form $T$.
+///
+/// @param[in,out] C
+///     On entry, the n-by-n matrix $C$.
+///     On exit, overwritten by the solution $X$.
+///     $A$ and $C$ must have the same square tile size.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// The equation has a unique solution if no two eigenvalues of $A$
+/// satisfy $\lambda_i + \bar{\lambda}_j = 0$.
+///
+/// @ingroup geev
+///
+template <typename scalar_t>
+void gelyap(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    // Schur form A = Z T Z^H.
+    std::vector< std::complex<real_t> > Lambda( A.n() );
+    auto Z = A.emptyLike();
+    Z.insertLocalTiles();
+    gees( A, Lambda, Z, opts );
+
+    auto ZH = conj_transpose( Z );
+    auto AH = conj_transpose( A );
+
+    // C = Z^H C Z.
+    auto W = C.emptyLike();
+    W.insertLocalTiles();
+    gemm( one, ZH, C, zero, W, opts );
+    gemm( one, W, Z, zero, C, opts );
+
+    trsyl( 1, A, AH, C, opts );
+
+    // X = Z X Z^H.
+    gemm( one, Z, C, zero, W, opts );
+    gemm( one, W, ZH, zero, C, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Lyapunov equation solve for stable $A$,
+/// using the matrix sign function.
+///
+/// Solves
+/// \[
+///     A X + X A^H = C,
+/// \]
+/// where all eigenvalues of $A$ have negative real part, by the scaled
+/// Newton iteration for sign(A) = -I:
+/// \[
+///     A_{k+1} = \frac{1}{2} (\mu_k A_k + \mu_k^{-1} A_k^{-1}),
+///     \quad
+///     C_{k+1} = \frac{1}{2} (\mu_k C_k + \mu_k^{-1} A_k^{-1} C_k A_k^{-H}),
+/// \]
+/// with $\mu_k = \sqrt{ \|A_k^{-1}\|_F / \|A_k\|_F }$.
+/// Then $X = -C_{\infty} / 2$. Each iteration is an LU inverse with
+/// getrf and getri and two gemm, so it is all Level 3 BLAS.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n stable matrix $A$.
+///     On exit, destroyed (approximately $-I$).
+///
+/// @param[in,out] C
+///     On entry, the n-by-n matrix $C$.
+///     On exit, overwritten by the solution $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Tolerance:
+///       Iteration stops after $\|A_k + I\|_1 \le tol$, plus one more
+///       iteration, since convergence is quadratic. Default sqrt(epsilon).
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @throws slate::Exception if the iteration does not converge,
+///     e.g., if $A$ is not stable.
+///
+/// @ingroup geev
+///
+template <typename scalar_t>
+void gelyap_sign(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const int itermax = 50;
+
+    real_t tol = get_option<double>(
+        opts, Option::Tolerance,
+        std::sqrt( std::numeric_limits<real_t>::epsilon() ) );
+
+    slate_assert( A.m() == A.n() );
+    slate_assert( C.m() == A.m() && C.n() == A.n() );
+
+    auto Ainv = A.emptyLike();
+    Ainv.insertLocalTiles();
+    auto W = C.emptyLike();
+    W.insertLocalTiles();
+    auto AinvH = conj_transpose( Ainv );
+    Pivots pivots;
+
+    bool converged = false;
+    for (int iter = 0; iter < itermax; ++iter) {
+        slate::copy( A, Ainv, opts );
+        getrf( Ainv, pivots, opts );
+        getri( Ainv, pivots, opts );
+
+        real_t mu = std::sqrt( norm( Norm::Fro, Ainv, opts )
+                             / norm( Norm::Fro, A, opts ) );
+        scalar_t half_mu     = mu / 2;
+        scalar_t half_inv_mu = 1 / (2*mu);
+
+        // C = mu/2 C + 1/(2 mu) Ainv C Ainv^H.
+        gemm( one, Ainv, C, zero, W, opts );
+        gemm( half_inv_mu, W, AinvH, half_mu, C, opts );
+
+        // A = mu/2 A + 1/(2 mu) Ainv.
+        add( half_inv_mu, Ainv, half_mu, A, opts );
+
+        if (converged)
+            break;
+
+        // Ainv = A + I, as workspace.
+        set( zero, one, Ainv, opts );
+        add( one, A, one, Ainv, opts );
+        converged = norm( Norm::One, Ainv, opts ) <= tol;
+    }
+    if (! converged)
+        slate_error( "gelyap_sign did not converge; A must be stable" );
+
+    // X = -C / 2.
+    scale( -1.0, 2.0, C, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gelyap<float>(
+    Matrix<float>& A,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void gelyap<double>(
+    Matrix<double>& A,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void gelyap< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void gelyap< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+//--------------------
+template
+void gelyap_sign<float>(
+    Matrix<float>& A,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void gelyap_sign<double>(
+    Matrix<double>& A,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void gelyap_sign< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void gelyap_sign< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
@@ -53,6 +53,7 @@ namespace slate {
 ///           - Auto: let the routine decides [default]
 ///           - gemmA: select gemmA routine
 ///           - gemmC: select gemmC routine
+///           - Strassen: select gemmStrassen routine, for large products
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -84,6 +85,9 @@ void gemm(scalar_t alpha, Matrix<scalar_t>& A,
         case MethodGemm::GemmC:
             gemmC( alpha, A, B, beta, C, tuned_opts );
             break;
+        case MethodGemm::Strassen:
+            gemmStrassen( alpha, A, B, beta, C, tuned_opts );
+            break;
     }
 }
 
@@ -0,0 +1,287 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+
+#include <algorithm>
+#include <string>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Returns true if the m-by-n matrix X splits at tile (mt/2, nt/2) into
+/// 2x2 quadrants that have the same tile sizes and the same distribution,
+/// so add can combine quadrants tile-by-tile without communication.
+///
+/// @ingroup gemm_specialization
+///
+template <typename scalar_t>
+bool strassen_quadrants_conform( Matrix<scalar_t>& X )
+{
+    int64_t mt = X.mt();
+    int64_t nt = X.nt();
+    if (mt % 2 != 0 || nt % 2 != 0)
+        return false;
+
+    int64_t mt2 = mt / 2;
+    int64_t nt2 = nt / 2;
+    for (int64_t i = 0; i < mt2; ++i) {
+        if (X.tileMb( i ) != X.tileMb( i + mt2 ))
+            return false;
+    }
+    for (int64_t j = 0; j < nt2; ++j) {
+        if (X.tileNb( j ) != X.tileNb( j + nt2 ))
+            return false;
+    }
+    for (int64_t j = 0; j < nt2; ++j) {
+        for (int64_t i = 0; i < mt2; ++i) {
+            int rank = X.tileRank( i, j );
+            if (X.tileRank( i + mt2, j       ) != rank
+                || X.tileRank( i,       j + nt2 ) != rank
+                || X.tileRank( i + mt2, j + nt2 ) != rank)
+                return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// One level of the Strassen-Winograd recursion, C = alpha A B + beta C,
+/// with 7 products of quadrants and 15 quadrant additions.
+/// Uses 3 quadrant-size workspaces, S, T, and P, per level, and accumulates
+/// into the quadrants of C. Falls back to gemmC when a dimension is below
+/// crossover or, noted in the trace, when the quadrants do not conform.
+///
+/// @ingroup gemm_specialization
+///
+template <typename scalar_t>
+void gemmStrassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    int64_t crossover,
+    Options const& opts )
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t m = C.m();
+    int64_t n = C.n();
+    int64_t k = A.n();
+
+    if (std::min( { m, n, k } ) < crossover) {
+        gemmC( alpha, A, B, beta, C, opts );
+        return;
+    }
+    // Above crossover, a level that cannot split is a lost saving,
+    // so note it in the trace rather than fall back silently.
+    if (A.op() != Op::NoTrans
+        || B.op() != Op::NoTrans
+        || ! strassen_quadrants_conform( A )
+        || ! strassen_quadrants_conform( B )
+        || ! strassen_quadrants_conform( C )) {
+        trace::Trace::comment(
+            "gemmStrassen: calling gemmC for "
+            + std::to_string( C.mt() ) + " x " + std::to_string( C.nt() )
+            + " x " + std::to_string( A.nt() )
+            + " tiles, which do not split into conforming quadrants\n" );
+        gemmC( alpha, A, B, beta, C, opts );
+        return;
+    }
+
+    // With beta = 0, C may hold NaN, which add would propagate;
+    // zero C so the updates below can use beta = 1.
+    if (beta == zero) {
+        set( zero, zero, C, opts );
+        beta = one;
+    }
+
+    int64_t mt2 = C.mt() / 2;
+    int64_t nt2 = C.nt() / 2;
+    int64_t kt2 = A.nt() / 2;
+
+    auto A11 = A.sub( 0,   mt2-1,     0,   kt2-1     );
+    auto A12 = A.sub( 0,   mt2-1,     kt2, A.nt()-1  );
+    auto A21 = A.sub( mt2, A.mt()-1,  0,   kt2-1     );
+    auto A22 = A.sub( mt2, A.mt()-1,  kt2, A.nt()-1  );
+
+    auto B11 = B.sub( 0,   kt2-1,     0,   nt2-1     );
+    auto B12 = B.sub( 0,   kt2-1,     nt2, B.nt()-1  );
+    auto B21 = B.sub( kt2, B.mt()-1,  0,   nt2-1     );
+    auto B22 = B.sub( kt2, B.mt()-1,  nt2, B.nt()-1  );
+
+    auto C11 = C.sub( 0,   mt2-1,     0,   nt2-1     );
+    auto C12 = C.sub( 0,   mt2-1,     nt2, C.nt()-1  );
+    auto C21 = C.sub( mt2, C.mt()-1,  0,   nt2-1     );
+    auto C22 = C.sub( mt2, C.mt()-1,  nt2, C.nt()-1  );
+
+    // Workspaces, distributed like A11, B11, C11.
+    auto S = A11.emptyLike();
+    auto T = B11.emptyLike();
+    auto P = C11.emptyLike();
+    S.insertLocalTiles();
+    T.insertLocalTiles();
+    P.insertLocalTiles();
+
+    // P = alpha (A11 - A21) (B22 - B12) = alpha M7;
+    // C21 = beta C21 + P; C22 = beta C22 + P.
+    slate::copy( A11, S, opts );
+    add( -one, A21, one, S, opts );
+    slate::copy( B22, T, opts );
+    add( -one, B12, one, T, opts );
+    gemmStrassen( alpha, S, T, zero, P, crossover, opts );
+    add( one, P, beta, C21, opts );
+    add( one, P, beta, C22, opts );
+
+    // P = alpha (A21 + A22) (B12 - B11) = alpha M5;
+    // C22 += P; C12 = beta C12 + P.
+    slate::copy( A21, S, opts );
+    add( one, A22, one, S, opts );
+    slate::copy( B12, T, opts );
+    add( -one, B11, one, T, opts );
+    gemmStrassen( alpha, S, T, zero, P, crossover, opts );
+    add( one, P, one, C22, opts );
+    add( one, P, beta, C12, opts );
+
+    // P = alpha A11 B11 = alpha M1; C11 = beta C11 + P.
+    // S = S - A11; T = B22 - T;
+    // P += alpha S T, so P = alpha (M1 + M6).
+    gemmStrassen( alpha, A11, B11, zero, P, crossover, opts );
+    add( one, P, beta, C11, opts );
+    add( -one, A11, one, S, opts );
+    add( one, B22, -one, T, opts );
+    gemmStrassen( alpha, S, T, one, P, crossover, opts );
+    add( one, P, one, C12, opts );
+    add( one, P, one, C21, opts );
+    add( one, P, one, C22, opts );
+
+    // C12 += alpha (A12 - S) B22 = alpha M3.
+    add( one, A12, -one, S, opts );
+    gemmStrassen( alpha, S, B22, one, C12, crossover, opts );
+
+    // C21 -= alpha A22 (T - B21) = alpha M4.
+    add( -one, B21, one, T, opts );
+    gemmStrassen( -alpha, A22, T, one, C21, crossover, opts );
+
+    // C11 += alpha A12 B21 = alpha M2.
+    gemmStrassen( alpha, A12, B21, one, C11, crossover, opts );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel general matrix-matrix multiplication using the
+/// Strassen-Winograd algorithm.
+/// Performs the matrix-matrix operation
+/// \[
+///     C = \alpha A B + \beta C,
+/// \]
+/// where alpha and beta are scalars, and $A$, $B$, and $C$ are matrices, with
+/// $A$ an m-by-k matrix, $B$ a k-by-n matrix, and $C$ an m-by-n matrix.
+///
+/// Each level of recursion splits the matrices at the middle tile into
+/// quadrants, and replaces 8 products of quadrants with 7, at the cost of
+/// 15 quadrant additions, saving 12.5% of flops per level. It recurses
+/// while all dimensions are at least Option::StrassenCrossover, then calls
+/// gemmC. A level requires that $A$, $B$, and $C$ are not transposed and
+/// each has an even number of block rows and block columns, with quadrants
+/// of the same tile sizes and distribution; for a p-by-q 2D block cyclic
+/// distribution, this means p | mt/2 and q | nt/2. Otherwise, gemmC is
+/// called directly, and a comment is added to the trace.
+///
+/// Each level allocates 3 quadrant-size workspaces, of
+/// (m/2)(k/2) + (k/2)(n/2) + (m/2)(n/2) elements, live during the
+/// recursion below it. Summed over levels, the extra memory is at most
+/// $(mk + kn + mn)/3$ elements, distributed like $A$, $B$, and $C$;
+/// e.g., for square matrices, as much as one more copy of $C$.
+///
+/// The error bound is somewhat weaker than for standard gemm, growing
+/// with the number of recursion levels, so this is used only when selected
+/// by Option::MethodGemm = MethodGemm::Strassen.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] alpha
+///         The scalar alpha.
+///
+/// @param[in] A
+///         The m-by-k matrix A.
+///
+/// @param[in] B
+///         The k-by-n matrix B.
+///
+/// @param[in] beta
+///         The scalar beta.
+///
+/// @param[in,out] C
+///         On entry, the m-by-n matrix C.
+///         On exit, overwritten by the result $\alpha A B + \beta C$.
+///
+/// @param[in] opts
+///         Additional options, as map of name = value pairs. Possible options:
+///         - Option::StrassenCrossover:
+///           Smallest dimension at which to recurse. Default 8192.
+///         - Option::Lookahead:
+///           Number of blocks to overlap communication and computation,
+///           in gemmC. lookahead >= 0. Default 1.
+///         - Option::Target:
+///           Implementation to target. Possible values:
+///           - HostTask:  OpenMP tasks on CPU host [default].
+///           - HostNest:  nested OpenMP parallel for loop on CPU host.
+///           - HostBatch: batched BLAS on CPU host.
+///           - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup gemm
+///
+template <typename scalar_t>
+void gemmStrassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    int64_t crossover = get_option<int64_t>(
+        opts, Option::StrassenCrossover, 8192 );
+    slate_assert( crossover >= 1 );
+
+    impl::gemmStrassen( alpha, A, B, beta, C, crossover, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gemmStrassen<float>(
+    float alpha, Matrix<float>& A,
+                 Matrix<float>& B,
+    float beta,  Matrix<float>& C,
+    Options const& opts);
+
+template
+void gemmStrassen<double>(
+    double alpha, Matrix<double>& A,
+                  Matrix<double>& B,
+    double beta,  Matrix<double>& C,
+    Options const& opts);
+
+template
+void gemmStrassen< std::complex<float> >(
+    std::complex<float> alpha, Matrix< std::complex<float> >& A,
+                               Matrix< std::complex<float> >& B,
+    std::complex<float> beta,  Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void gemmStrassen< std::complex<double> >(
+    std::complex<double> alpha, Matrix< std::complex<double> >& A,
+                                Matrix< std::complex<double> >& B,
+    std::complex<double> beta,  Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
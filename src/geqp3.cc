@@ -0,0 +1,587 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// An auxiliary routine to compute the sketch $Y = \Omega A$ of the
+/// trailing matrix, where $\Omega$ is an l-by-m Gaussian random matrix,
+/// replicated on all ranks.
+///
+/// Each block of rows $\Omega_i$ is generated from the seed and the block
+/// row index i, so every rank owning a tile in block row i generates the
+/// same $\Omega_i$ without communication. Each rank multiplies its local
+/// tiles, then the l-by-n partial sketches are summed, for a
+/// total of O( l n ) words communicated.
+///
+/// @param[in] A
+///     The m-by-n trailing matrix.
+///
+/// @param[in] l
+///     Number of rows of the sketch.
+///
+/// @param[in] seed
+///     Seed for $\Omega$, in [0, 4096).
+///
+/// @param[out] Y
+///     The l-by-n sketch, with leading dimension l.
+///
+/// @ingroup geqrf_impl
+///
+template <typename scalar_t>
+void geqp3_sketch(
+    Matrix<scalar_t>& A, int64_t l, int64_t seed,
+    std::vector<scalar_t>& Y )
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const int64_t idist_normal = 3;
+
+    int64_t A_mt = A.mt();
+    int64_t A_nt = A.nt();
+    int64_t n = A.n();
+
+    // Generate Omega_i for block rows with any local tile.
+    std::vector< std::vector<scalar_t> > Omega( A_mt );
+    for (int64_t i = 0; i < A_mt; ++i) {
+        for (int64_t j = 0; j < A_nt; ++j) {
+            if (A.tileIsLocal( i, j )) {
+                int64_t iseed[4] = { seed, i % 4096, (i / 4096) % 4096, 1 };
+                Omega[ i ].resize( l * A.tileMb( i ) );
+                lapack::larnv( idist_normal, iseed,
+                               Omega[ i ].size(), Omega[ i ].data() );
+                break;
+            }
+        }
+    }
+
+    std::vector<scalar_t> Y_local( l * n, zero );
+
+    int64_t jj = 0;
+    for (int64_t j = 0; j < A_nt; ++j) {
+        scalar_t* Yj = &Y_local[ jj*l ];
+        #pragma omp task shared( A, Omega ) firstprivate( j, Yj )
+        {
+            for (int64_t i = 0; i < A_mt; ++i) {
+                if (A.tileIsLocal( i, j )) {
+                    A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                    auto T = A( i, j );
+                    blas::gemm(
+                        Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        l, T.nb(), T.mb(),
+                        one, Omega[ i ].data(), l,
+                             T.data(), T.stride(),
+                        one, Yj, l );
+                }
+            }
+        }
+        jj += A.tileNb( j );
+    }
+    #pragma omp taskwait
+
+    Y.resize( l * n );
+    slate_mpi_call(
+        MPI_Allreduce( Y_local.data(), Y.data(), l * n,
+                       mpi_type<scalar_t>::value, MPI_SUM, A.mpiComm() ) );
+}
+
+//------------------------------------------------------------------------------
+/// An auxiliary routine to downdate the sketch after panel k is factored
+/// and block row k of the trailing matrix is updated, instead of forming
+/// a new sketch.
+///
+/// With the panel columns of Y first, the sketch of the remaining
+/// trailing matrix is
+/// \[
+///     Y_2 - Y_1 R_{11}^{-1} R_{12} = (\Omega Q)_2 R_{22},
+/// \]
+/// a sketch of $R_{22}$ by the rows of the rotated $\Omega$ that are not
+/// eliminated, as in HQRRP (Martinsson et al., 2017). The rank owning
+/// $R_{11}$ solves with it and broadcasts $Y_1 R_{11}^{-1}$; each rank
+/// multiplies by its tiles of $R_{12}$, then the updates are summed.
+/// This costs O( l nb n ) flops per panel, versus O( l m n ) to form
+/// a new sketch.
+///
+/// @param[in] A
+///     The whole matrix, with panel k factored and block row k updated.
+///
+/// @param[in] k
+///     Index of the panel.
+///
+/// @param[in] l
+///     Number of rows of the sketch.
+///
+/// @param[in,out] Y
+///     On entry, the l-by-n sketch of A(k:mt-1, k:nt-1), with its columns
+///     swapped as the columns of A. On successful exit, the sketch of
+///     A(k+1:mt-1, k+1:nt-1).
+///
+/// @return false if $R_{11}$ is singular or not square, in which case
+///     Y is unchanged and a new sketch must be formed.
+///
+/// @ingroup geqrf_impl
+///
+template <typename scalar_t>
+bool geqp3_downdate(
+    Matrix<scalar_t>& A, int64_t k, int64_t l,
+    std::vector<scalar_t>& Y )
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t A_nt = A.nt();
+    int64_t kb = A.tileNb( k );
+    int64_t n_rest = Y.size() / l - kb;
+    int root = A.tileRank( k, k );
+
+    // Z = Y_1 R_11^{-1}, followed by a flag that R_11 is nonsingular.
+    std::vector<scalar_t> Z( l*kb + 1, zero );
+    if (A.mpiRank() == root) {
+        A.tileGetForReading( k, k, LayoutConvert::ColMajor );
+        auto R11 = A( k, k );
+        bool nonsingular = R11.mb() >= kb;
+        for (int64_t c = 0; nonsingular && c < kb; ++c)
+            nonsingular = R11( c, c ) != zero;
+
+        if (nonsingular) {
+            std::copy( Y.begin(), Y.begin() + l*kb, Z.begin() );
+            blas::trsm(
+                Layout::ColMajor, Side::Right, Uplo::Upper,
+                Op::NoTrans, Diag::NonUnit,
+                l, kb,
+                one, R11.data(), R11.stride(),
+                     Z.data(), l );
+            Z[ l*kb ] = one;
+        }
+    }
+    slate_mpi_call(
+        MPI_Bcast( Z.data(), Z.size(), mpi_type<scalar_t>::value,
+                   root, A.mpiComm() ) );
+    if (Z[ l*kb ] == zero)
+        return false;
+
+    // Each rank subtracts Z R_12 for its tiles of block row k.
+    std::vector<scalar_t> D_local( l * n_rest, zero );
+    int64_t jj = 0;
+    for (int64_t j = k+1; j < A_nt; ++j) {
+        if (A.tileIsLocal( k, j )) {
+            A.tileGetForReading( k, j, LayoutConvert::ColMajor );
+            auto R12 = A( k, j );
+            blas::gemm(
+                Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                l, R12.nb(), kb,
+                -one, Z.data(), l,
+                      R12.data(), R12.stride(),
+                one,  &D_local[ jj*l ], l );
+        }
+        jj += A.tileNb( j );
+    }
+
+    std::vector<scalar_t> D( l * n_rest );
+    slate_mpi_call(
+        MPI_Allreduce( D_local.data(), D.data(), l * n_rest,
+                       mpi_type<scalar_t>::value, MPI_SUM, A.mpiComm() ) );
+
+    for (int64_t i = 0; i < l * n_rest; ++i)
+        D[ i ] += Y[ l*kb + i ];
+    Y.swap( D );
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel QR factorization with column pivoting.
+/// Generic implementation for any target.
+/// Pivot selection and panel computed on host.
+///
+/// ColMajor layout is assumed
+///
+/// @ingroup geqrf_impl
+///
+template <Target target, typename scalar_t>
+void geqp3(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Pivots& pivots,
+    Options const& opts )
+{
+    using BcastList = typename Matrix<scalar_t>::BcastList;
+
+    // Assumes column major
+    const Layout layout = Layout::ColMajor;
+
+    // Extra rows in the sketch, beyond the panel width.
+    const int64_t oversample = 8;
+    const int64_t l = A.tileNb(0) + oversample;
+
+    // Options
+    int64_t ib = get_option<int64_t>( opts, Option::InnerBlocking, 16 );
+    int64_t max_panel_threads  = std::max(omp_get_max_threads()/2, 1);
+    max_panel_threads = get_option<int64_t>( opts, Option::MaxPanelThreads,
+                                             max_panel_threads );
+
+    int64_t A_mt = A.mt();
+    int64_t A_nt = A.nt();
+    int64_t A_min_mtnt = std::min(A_mt, A_nt);
+
+    T.clear();
+    T.push_back(A.emptyLike());
+    T.push_back(A.emptyLike(ib, 0));
+    auto Tlocal  = T[0];
+    auto Treduce = T[1];
+
+    pivots.resize(A_min_mtnt);
+
+    // workspace: one tile row of W per MPI process
+    auto W = internal::unmqr_workspace( Side::Left, A );
+
+    if (target == Target::Devices) {
+        A.allocateBatchArrays();
+        A.reserveDeviceWorkspace();
+        W.allocateBatchArrays();
+        W.reserveDeviceWorkspace();
+    }
+
+    // Pivots for panel k depend on the whole trailing matrix, so no
+    // lookahead is possible -- just execute tasks in order.
+
+    // Sketch of the trailing matrix, replicated on all ranks.
+    std::vector<scalar_t> Y;
+    bool sketch_valid = false;
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int64_t k = 0; k < A_min_mtnt; ++k) {
+            auto A_trail = A.sub(k, A_mt-1, k, A_nt-1);
+            int64_t kb = A.tileNb(k);
+            int64_t n_trail = A_trail.n();
+            int root = A.tileRank(k, k);
+
+            //--------------------
+            // Select kb pivot columns from the trailing matrix, using
+            // LAPACK geqp3 on its sketch. Pivot c swaps column c of the
+            // panel with trailing column pos, as (tile, offset) in A_trail.
+            // The sketch is formed for the first panel, then downdated.
+            std::vector<int64_t> piv_buf(2*kb);
+            if (! sketch_valid) {
+                geqp3_sketch(A_trail, l, k % 4096, Y);
+                sketch_valid = true;
+            }
+
+            if (A.mpiRank() == root) {
+                // geqp3 overwrites its input, so use a copy of Y.
+                std::vector<scalar_t> Yk(Y);
+                std::vector<int64_t> jpvt(n_trail, 0);
+                std::vector<scalar_t> tau(std::min(l, n_trail));
+                lapack::geqp3(l, n_trail, Yk.data(), l, jpvt.data(), tau.data());
+
+                // Convert the selection to a sequence of swaps.
+                std::vector<int64_t> perm(n_trail), where(n_trail);
+                for (int64_t c = 0; c < n_trail; ++c) {
+                    perm[c] = c;
+                    where[c] = c;
+                }
+                for (int64_t c = 0; c < kb; ++c) {
+                    int64_t pos = where[jpvt[c] - 1];
+                    std::swap(perm[c], perm[pos]);
+                    where[perm[c]] = c;
+                    where[perm[pos]] = pos;
+
+                    int64_t tile = 0;
+                    while (pos >= A_trail.tileNb(tile)) {
+                        pos -= A_trail.tileNb(tile);
+                        ++tile;
+                    }
+                    piv_buf[2*c]   = tile;
+                    piv_buf[2*c+1] = pos;
+                }
+            }
+            slate_mpi_call(
+                MPI_Bcast(piv_buf.data(), 2*kb, MPI_INT64_T, root,
+                          A.mpiComm()));
+
+            // Swap the columns of the sketch as the columns of A.
+            pivots.at(k).resize(kb);
+            for (int64_t c = 0; c < kb; ++c) {
+                pivots.at(k)[c] = Pivot(piv_buf[2*c], piv_buf[2*c+1]);
+
+                int64_t pos = piv_buf[2*c+1];
+                for (int64_t tile = 0; tile < piv_buf[2*c]; ++tile)
+                    pos += A_trail.tileNb(tile);
+                if (pos != c) {
+                    std::swap_ranges(&Y[c*l], &Y[c*l] + l, &Y[pos*l]);
+                }
+            }
+
+            // Swap whole columns of A, as rows of A^T.
+            auto A_cols = A.sub(0, A_mt-1, k, A_nt-1);
+            auto A_colsT = transpose(A_cols);
+            internal::permuteRows<Target::HostTask>(
+                Direction::Forward, std::move(A_colsT), pivots.at(k),
+                layout, 0, k);
+
+            //--------------------
+            // QR of panel, as in geqrf.
+            auto  A_panel =       A.sub(k, A_mt-1, k, k);
+            auto Tl_panel =  Tlocal.sub(k, A_mt-1, k, k);
+            auto Tr_panel = Treduce.sub(k, A_mt-1, k, k);
+
+            // Find ranks in this column.
+            std::set<int> ranks_set;
+            A_panel.getRanks(&ranks_set);
+            assert(ranks_set.size() > 0);
+
+            // Find each rank's first (top-most) row in this panel,
+            // where the triangular tile resulting from local geqrf panel
+            // will reside.
+            std::vector< int64_t > first_indices;
+            first_indices.reserve(ranks_set.size());
+            for (int r: ranks_set) {
+                for (int64_t i = 0; i < A_panel.mt(); ++i) {
+                    if (A_panel.tileRank(i, 0) == r) {
+                        first_indices.push_back(i+k);
+                        break;
+                    }
+                }
+            }
+
+            // local panel factorization
+            internal::geqrf<Target::HostTask>(
+                            std::move(A_panel),
+                            std::move(Tl_panel),
+                            ib, max_panel_threads);
+
+            // triangle-triangle reductions
+            // ttqrt handles tile transfers internally
+            internal::ttqrt<Target::HostTask>(
+                            std::move(A_panel),
+                            std::move(Tr_panel));
+
+            // if a trailing matrix exists
+            if (k < A_nt-1) {
+
+                // bcast V across row for trailing matrix update
+                if (k < A_mt) {
+                    BcastList bcast_list_V_first;
+                    BcastList bcast_list_V;
+                    for (int64_t i = k; i < A_mt; ++i) {
+                        // send A(i, k) across row A(i, k+1:nt-1)
+                        // Vs in first_indices (except main diagonal one)
+                        // need three lives.
+                        if ((std::find(first_indices.begin(), first_indices.end(), i) != first_indices.end()) && (i > k)) {
+                            bcast_list_V_first.push_back(
+                                {i, k, {A.sub(i, i, k+1, A_nt-1)}});
+                        }
+                        else {
+                            bcast_list_V.push_back(
+                                {i, k, {A.sub(i, i, k+1, A_nt-1)}});
+                        }
+                    }
+                    A.template listBcast(bcast_list_V_first, layout, 0, 3);
+                    A.template listBcast(bcast_list_V, layout, 0, 2);
+                }
+
+                // bcast Tlocal across row for trailing matrix update
+                if (first_indices.size() > 0) {
+                    BcastList bcast_list_T;
+                    for (int64_t row : first_indices) {
+                        bcast_list_T.push_back(
+                            {row, k, {Tlocal.sub(row, row, k+1, A_nt-1)}});
+                    }
+                    Tlocal.template listBcast(bcast_list_T, layout);
+                }
+
+                // bcast Treduce across row for trailing matrix update
+                if (first_indices.size() > 1) {
+                    BcastList bcast_list_T;
+                    for (int64_t row : first_indices) {
+                        // Exclude first row of this panel,
+                        // which doesn't have Treduce tile.
+                        if (row > k) {
+                            bcast_list_T.push_back(
+                                {row, k, {Treduce.sub(row, row, k+1, A_nt-1)}});
+                        }
+                    }
+                    Treduce.template listBcast(bcast_list_T, layout);
+                }
+            }
+
+            //--------------------
+            // QR update trailing submatrix.
+            if (k+1 < A_nt) {
+                int64_t j = k+1;
+                auto A_trail_j = A.sub(k, A_mt-1, j, A_nt-1);
+
+                // Apply local reflectors
+                internal::unmqr<target>(
+                                Side::Left, Op::ConjTrans,
+                                std::move(A_panel),
+                                std::move(Tl_panel),
+                                std::move(A_trail_j),
+                                W.sub(0, 0, j, A_nt-1));
+
+                // Apply triangle-triangle reduction reflectors
+                // ttmqr handles the tile broadcasting internally
+                internal::ttmqr<Target::HostTask>(
+                                Side::Left, Op::ConjTrans,
+                                std::move(A_panel),
+                                std::move(Tr_panel),
+                                std::move(A_trail_j),
+                                j);
+            }
+
+            //--------------------
+            // Downdate the sketch for the next panel, using the
+            // updated block row k.
+            if (k+1 < A_min_mtnt) {
+                #pragma omp taskwait
+                sketch_valid = geqp3_downdate(A, k, l, Y);
+            }
+        }
+
+        #pragma omp taskwait
+        A.tileUpdateAllOrigin();
+    }
+
+    A.releaseWorkspace();
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel QR factorization with column pivoting.
+///
+/// Computes a QR factorization of an m-by-n matrix $A$,
+/// with column interchanges,
+/// \[
+///     A P = Q R,
+/// \]
+/// where $P$ is a permutation matrix, $Q$ is unitary, and $R$ is upper
+/// trapezoidal, with diagonal entries of roughly decreasing magnitude,
+/// suitable to reveal the numerical rank of $A$, e.g., in gelsy.
+///
+/// Pivots are chosen a panel at a time by randomized sampling:
+/// the matrix is compressed once to a sketch $Y = \Omega A$ of (nb + 8)
+/// rows, with $\Omega$ Gaussian random, and for each panel LAPACK geqp3
+/// on the small sketch selects the nb columns for the panel. Columns are
+/// swapped, then the panel is factored and the trailing matrix updated
+/// as in geqrf. The sketch is then downdated to the next trailing matrix
+/// at O( nb^2 n ) flops per panel, so pivoting adds O( nb m n ) flops
+/// in total, a small fraction of the factorization.
+/// It is formed again only if a diagonal block of $R$ is exactly singular.
+/// The factorization is Level 3 BLAS,
+/// unlike the Level 2 ScaLAPACK pxgeqpf. The pivoting is not identical to
+/// classic column pivoting on norms, but the diagonal of $R$ reveals the
+/// rank similarly in practice.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$.
+///     On exit, the elements on and above the diagonal of the array contain
+///     the min(m,n)-by-n upper trapezoidal matrix $R$ (upper triangular
+///     if m >= n); the elements below the diagonal represent the unitary
+///     matrix $Q$ as a product of elementary reflectors, as in geqrf.
+///
+/// @param[out] T
+///     On exit, triangular matrices of the block reflectors,
+///     for use in unmqr.
+///
+/// @param[out] pivots
+///     The column pivot indices, in the same format as the row pivots
+///     of getrf: for panel k, pivots[k][i] gives the (tile, offset),
+///     relative to block column k, of the column swapped with
+///     column i of block column k. Swaps are applied in order.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::InnerBlocking:
+///       Inner blocking to use for panel. Default 16.
+///     - Option::MaxPanelThreads:
+///       Number of threads to use for panel. Default omp_get_max_threads()/2.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///     Note a lookahead is not possible with geqp3, since pivot selection
+///     depends on the whole trailing matrix.
+///
+/// @ingroup geqrf_computational
+///
+template <typename scalar_t>
+void geqp3(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Pivots& pivots,
+    Options const& opts )
+{
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+            impl::geqp3<Target::HostTask>( A, T, pivots, opts );
+            break;
+
+        case Target::HostNest:
+            impl::geqp3<Target::HostNest>( A, T, pivots, opts );
+            break;
+
+        case Target::HostBatch:
+            impl::geqp3<Target::HostBatch>( A, T, pivots, opts );
+            break;
+
+        case Target::Devices:
+            impl::geqp3<Target::Devices>( A, T, pivots, opts );
+            break;
+    }
+    // todo: return value for errors?
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void geqp3<float>(
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Pivots& pivots,
+    Options const& opts);
+
+template
+void geqp3<double>(
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Pivots& pivots,
+    Options const& opts);
+
+template
+void geqp3< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Pivots& pivots,
+    Options const& opts);
+
+template
+void geqp3< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Pivots& pivots,
+    Options const& opts);
+
+} // namespace slate
@@ -7,6 +7,7 @@
 #include "auxiliary/Debug.hh"
 #include "slate/Matrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_checkpoint.hh"
 
 namespace slate {
 
@@ -63,7 +64,7 @@ void geqrf_compute_first_indices(
 template <Target target, typename scalar_t>
 void geqrf(
     Matrix<scalar_t>& A,
-    TriangularFactors<scalar_t>& T,
+    TriangularFactors<scalar_t>& T, int64_t k_start,
     Options const& opts )
 {
     using BcastList = typename Matrix<scalar_t>::BcastList;
@@ -90,14 +91,17 @@ void geqrf(
     int64_t A_nt = A.nt();
     int64_t A_min_mtnt = std::min(A_mt, A_nt);
 
-    T.clear();
-    T.push_back(A.emptyLike());
-    T.push_back(A.emptyLike(ib, 0));
+    // When restarted, T holds the factors of panels 0:k_start-1.
+    if (k_start == 0) {
+        T.clear();
+        T.push_back(A.emptyLike());
+        T.push_back(A.emptyLike(ib, 0));
+    }
     auto Tlocal  = T[0];
     auto Treduce = T[1];
 
-    // workspace
-    auto W = A.emptyLike();
+    // workspace: one tile row of W per MPI process
+    auto W = internal::unmqr_workspace( Side::Left, A );
 
     // setting up dummy variables for case the when target == host
     int64_t num_devices  = A.num_devices();
@@ -112,12 +116,7 @@ void geqrf(
         A.allocateBatchArrays( batch_size_default, num_queues );
         A.reserveDeviceWorkspace();
         W.allocateBatchArrays( batch_size_default, num_queues );
-        // todo: this is demanding too much device workspace memory
-        // only one tile-row of matrix W per MPI process is going to be used,
-        // but W with size of whole A is being allocated
-        // thus limiting the matrix size that can be processed
-        // For now, allocate workspace tiles 1-by-1.
-        //W.reserveDeviceWorkspace();
+        W.reserveDeviceWorkspace();
 
         // Find largest panel size and device for copying to
         // contiguous memory within internal geqrf routine
@@ -173,13 +172,23 @@ void geqrf(
     std::vector< uint8_t > block_vector(A_nt);
     uint8_t* block = block_vector.data();
 
+    // Checkpoint every CheckpointInterval panels, if enabled.
+    internal::Checkpoint<scalar_t> checkpoint(
+        "geqrf", opts, k_start, A.mpiComm() );
+
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
 
     #pragma omp parallel
     #pragma omp master
     {
-        for (int64_t k = 0; k < A_min_mtnt; ++k) {
+        for (int64_t k = k_start; k < A_min_mtnt; ++k) {
+            // Save A and T after panels 0:k-1 and their updates are complete.
+            if (checkpoint.due( k )) {
+                #pragma omp taskwait
+                checkpoint.save( k, A, nullptr, &T );
+            }
+
             auto  A_panel =       A.sub(k, A_mt-1, k, k);
             auto Tl_panel =  Tlocal.sub(k, A_mt-1, k, k);
             auto Tr_panel = Treduce.sub(k, A_mt-1, k, k);
@@ -267,7 +276,7 @@ void geqrf(
                                     std::move(A_panel),
                                     std::move(Tl_panel),
                                     std::move(A_trail_j),
-                                    W.sub(k, A_mt-1, j, j),
+                                    W.sub(0, 0, j, j),
                                     priority_1, queue_jk1 );
 
                     // Apply triangle-triangle reduction reflectors
@@ -298,7 +307,7 @@ void geqrf(
                                     std::move(A_panel),
                                     std::move(Tl_panel),
                                     std::move(A_trail_j),
-                                    W.sub(k, A_mt-1, j, A_nt-1),
+                                    W.sub(0, 0, j, A_nt-1),
                                     priority_0, queue_jk1 );
 
                     // Apply triangle-triangle reduction reflectors.
@@ -364,6 +373,7 @@ void geqrf(
         #pragma omp taskwait
         A.tileUpdateAllOrigin();
     }
+    checkpoint.finish();
 
     A.releaseWorkspace();
 
@@ -376,6 +386,39 @@ void geqrf(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Distributed parallel QR factorization, starting from panel k_start.
+/// Dispatches to target implementations.
+/// @ingroup geqrf_impl
+///
+template <typename scalar_t>
+void geqrf(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T, int64_t k_start,
+    Options const& opts )
+{
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+            geqrf<Target::HostTask>( A, T, k_start, opts );
+            break;
+
+        case Target::HostNest:
+            geqrf<Target::HostNest>( A, T, k_start, opts );
+            break;
+
+        case Target::HostBatch:
+            geqrf<Target::HostBatch>( A, T, k_start, opts );
+            break;
+
+        case Target::Devices:
+            geqrf<Target::Devices>( A, T, k_start, opts );
+            break;
+    }
+}
+
 } // namespace impl
 
 //------------------------------------------------------------------------------
@@ -423,6 +466,14 @@ void geqrf(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::CheckpointInterval:
+///       Save a checkpoint of $A$ and $T$ every interval panels, to restart
+///       with geqrf_restart() after a failure. The checkpoint is written
+///       asynchronously using MPI-IO, while the factorization continues;
+///       it needs host memory equal to the local part of $A$ and $T$.
+///       interval >= 0. Default 0, no checkpoints.
+///     - Option::CheckpointFile:
+///       Prefix of the checkpoint file names. Default "slate_checkpoint".
 ///
 /// @ingroup geqrf_computational
 ///
@@ -432,27 +483,68 @@ void geqrf(
     TriangularFactors<scalar_t>& T,
     Options const& opts )
 {
-    Target target = get_option( opts, Option::Target, Target::HostTask );
-
-    switch (target) {
-        case Target::Host:
-        case Target::HostTask:
-            impl::geqrf<Target::HostTask>( A, T, opts );
-            break;
+    impl::geqrf( A, T, 0, opts );
+    // todo: return value for errors?
+}
 
-        case Target::HostNest:
-            impl::geqrf<Target::HostNest>( A, T, opts );
-            break;
+//------------------------------------------------------------------------------
+/// Restarts a QR factorization from its last checkpoint,
+/// saved by geqrf() with Option::CheckpointInterval.
+/// The factorization resumes from the last completed block column.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, a matrix with the same dimensions, tile size, and
+///     distribution as the matrix passed to geqrf(). Its values are ignored.
+///     On exit, $R$ and the Householder vectors, as for geqrf().
+///
+/// @param[out] T
+///     On exit, triangular matrices of the block reflectors.
+///
+/// @param[in] opts
+///     Additional options, as for geqrf().
+///     Option::CheckpointFile and Option::InnerBlocking must match the
+///     ones passed to geqrf().
+///     If Option::CheckpointInterval is set, checkpoints continue to be saved.
+///
+/// @ingroup geqrf_computational
+///
+template <typename scalar_t>
+void geqrf_restart(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Options const& opts )
+{
+    int64_t ib = get_option<int64_t>( opts, Option::InnerBlocking, 16 );
+    int64_t A_mt = A.mt();
 
-        case Target::HostBatch:
-            impl::geqrf<Target::HostBatch>( A, T, opts );
-            break;
+    int64_t k_start = internal::Checkpoint<scalar_t>::restart_column(
+        "geqrf", opts, A.mpiComm() );
 
-        case Target::Devices:
-            impl::geqrf<Target::Devices>( A, T, opts );
-            break;
+    // Insert the T tiles of the completed panels, where geqrf created them:
+    // Tlocal on each rank's first row in the panel, Treduce on those rows
+    // except the panel's first row.
+    T.clear();
+    T.push_back( A.emptyLike() );
+    T.push_back( A.emptyLike( ib, 0 ) );
+    for (int64_t k = 0; k < k_start; ++k) {
+        auto A_panel = A.sub( k, A_mt-1, k, k );
+        std::vector< int64_t > first_indices;
+        impl::geqrf_compute_first_indices( A_panel, k, first_indices );
+        for (int64_t row : first_indices) {
+            if (T[0].tileIsLocal( row, k )) {
+                T[0].tileInsert( row, k );
+                if (row > k)
+                    T[1].tileInsert( row, k );
+            }
+        }
     }
-    // todo: return value for errors?
+
+    internal::Checkpoint<scalar_t>::restore( "geqrf", opts, A, nullptr, &T );
+    impl::geqrf( A, T, k_start, opts );
 }
 
 //------------------------------------------------------------------------------
@@ -481,4 +573,29 @@ void geqrf< std::complex<double> >(
     TriangularFactors< std::complex<double> >& T,
     Options const& opts);
 
+//------------------------------------------------------------------------------
+template
+void geqrf_restart<float>(
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Options const& opts);
+
+template
+void geqrf_restart<double>(
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Options const& opts);
+
+template
+void geqrf_restart< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Options const& opts);
+
+template
+void geqrf_restart< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Options const& opts);
+
 } // namespace slate
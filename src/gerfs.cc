@@ -0,0 +1,707 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "internal/internal.hh"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Sets each entry of A to its absolute value.
+///
+/// @ingroup gesv_impl
+///
+template <typename scalar_t>
+void rfs_abs( Matrix<scalar_t>& A )
+{
+    #pragma omp parallel
+    #pragma omp master
+    #pragma omp taskgroup
+    for (int64_t i = 0; i < A.mt(); ++i) {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            if (A.tileIsLocal( i, j )) {
+                #pragma omp task slate_omp_default_none \
+                    shared( A ) firstprivate( i, j )
+                {
+                    A.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                    auto Aij = A( i, j );
+                    for (int64_t jj = 0; jj < Aij.nb(); ++jj)
+                        for (int64_t ii = 0; ii < Aij.mb(); ++ii)
+                            Aij.at( ii, jj ) = std::abs( Aij( ii, jj ) );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes the residual $R = B - A X$, accumulated in about twice the
+/// working precision, and $R_{abs} = |A| |X| + |B|$.
+/// A is either a general or a Hermitian matrix; for Hermitian A, each
+/// block column is assembled from the stored triangle, as in hemmC.
+/// Runs on the host.
+///
+/// @ingroup gesv_impl
+///
+template <typename matrix_t, typename scalar_t>
+void rfs_residual(
+    matrix_t& A,
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& R,
+    Matrix<scalar_t>& R_abs,
+    Options const& opts)
+{
+    using BcastListTag = typename Matrix<scalar_t>::BcastListTag;
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    constexpr bool hermitian
+        = std::is_same< matrix_t, HermitianMatrix<scalar_t> >::value;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const Layout layout = Layout::ColMajor;
+
+    // R + R_lo = B; R_abs = |B|.
+    slate::copy( B, R, opts );
+    slate::copy( B, R_abs, opts );
+    rfs_abs( R_abs );
+    auto R_lo = R.emptyLike();
+    R_lo.insertLocalTiles();
+    set( zero, R_lo, opts );
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int64_t k = 0; k < A.nt(); ++k) {
+            // broadcast A(i, k), or A(k, i) outside the stored triangle,
+            // to ranks owning block row R(i, :)
+            BcastListTag bcast_list_A;
+            std::set<ij_tuple> tile_set;
+            for (int64_t i = 0; i < A.mt(); ++i) {
+                int64_t ti = i, tk = k;
+                if (hermitian && i != k
+                    && (A.uplo() == Uplo::Lower) != (i > k)) {
+                    std::swap( ti, tk );
+                }
+                bcast_list_A.push_back(
+                    {ti, tk, {R.sub( i, i, 0, R.nt()-1 )}, i} );
+                tile_set.insert( {ti, tk} );
+            }
+            A.template listBcastMT<Target::HostTask>( bcast_list_A, layout );
+
+            // broadcast X(k, j) to ranks owning block col R(:, j)
+            BcastListTag bcast_list_X;
+            for (int64_t j = 0; j < X.nt(); ++j) {
+                bcast_list_X.push_back(
+                    {k, j, {R.sub( 0, R.mt()-1, j, j )}, j} );
+            }
+            X.template listBcastMT<Target::HostTask>( bcast_list_X, layout );
+
+            // R + R_lo -= A(:, k) X(k, :); R_abs += |A(:, k)| |X(k, :)|
+            auto X_rowblock = X.sub( k, k, 0, X.nt()-1 );
+            if constexpr (hermitian) {
+                internal::hemm_compensated<Target::HostTask>(
+                    -one, A.sub( 0, A.nt()-1 ),
+                    k,    std::move( X_rowblock ),
+                          std::move( R ),
+                          std::move( R_lo ),
+                          std::move( R_abs ) );
+            }
+            else {
+                internal::gemm_compensated<Target::HostTask>(
+                    -one, A.sub( 0, A.mt()-1, k, k ),
+                          std::move( X_rowblock ),
+                          std::move( R ),
+                          std::move( R_lo ),
+                          std::move( R_abs ) );
+            }
+
+            A.eraseRemoteWorkspace( tile_set );
+            X_rowblock.eraseRemoteWorkspace();
+        }
+    }
+
+    // R = R + R_lo, rounded to working precision.
+    add( one, R_lo, one, R, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Componentwise backward error of each column,
+///     $berr_j = \max_i |R_{ij}| / (|A| |X| + |B|)_{ij}$,
+/// skipping entries where the denominator is zero.
+///
+/// @ingroup gesv_impl
+///
+template <typename scalar_t>
+void rfs_berr(
+    Matrix<scalar_t>& R,
+    Matrix<scalar_t>& R_abs,
+    std::vector< blas::real_type<scalar_t> >& berr)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    int64_t nrhs = R.n();
+    std::vector<real_t> local_berr( nrhs, 0.0 );
+    int64_t jj = 0;
+    for (int64_t j = 0; j < R.nt(); ++j) {
+        for (int64_t i = 0; i < R.mt(); ++i) {
+            if (R.tileIsLocal( i, j )) {
+                R.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                R_abs.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                auto Rij = R( i, j );
+                auto Wij = R_abs( i, j );
+                for (int64_t jt = 0; jt < Rij.nb(); ++jt) {
+                    for (int64_t it = 0; it < Rij.mb(); ++it) {
+                        real_t w = std::real( Wij( it, jt ) );
+                        if (w > 0) {
+                            local_berr[ jj + jt ] = std::max(
+                                local_berr[ jj + jt ],
+                                std::abs( Rij( it, jt ) ) / w );
+                        }
+                    }
+                }
+            }
+        }
+        jj += R.tileNb( j );
+    }
+    berr.resize( nrhs );
+    slate_mpi_call(
+        MPI_Allreduce( local_berr.data(), berr.data(), nrhs,
+                       mpi_type<real_t>::value, MPI_MAX, R.mpiComm() ) );
+}
+
+//------------------------------------------------------------------------------
+/// Iterative refinement with extra-precise residuals.
+/// solve( Y ) overwrites Y with $A^{-1} Y$ using an existing factorization.
+/// Returns the number of refinement steps applied to X.
+///
+/// @ingroup gesv_impl
+///
+template <typename matrix_t, typename scalar_t, typename solve_t>
+int64_t rfs(
+    matrix_t& A,
+    solve_t& solve,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    std::vector< blas::real_type<scalar_t> >& ferr,
+    std::vector< blas::real_type<scalar_t> >& berr,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t one = 1.0;
+    const int itermax = 30;
+
+    real_t tol = get_option<double>(
+        opts, Option::Tolerance, std::numeric_limits<real_t>::epsilon() );
+
+    int64_t nrhs = X.n();
+    auto R = X.emptyLike();
+    R.insertLocalTiles();
+    auto R_abs = X.emptyLike();
+    R_abs.insertLocalTiles();
+    std::vector<real_t> colnorms_X( nrhs ), colnorms_dX( nrhs );
+    ferr.resize( nrhs );
+
+    // As in LAPACK's xGERFS, stop when the backward error is small or
+    // no longer halves. The last correction is not applied, but
+    // estimates the forward error of X.
+    real_t berr_last = 3.0;
+    int64_t iter = 0;
+    while (true) {
+        rfs_residual( A, X, B, R, R_abs, opts );
+        rfs_berr( R, R_abs, berr );
+        real_t berr_max = *std::max_element( berr.begin(), berr.end() );
+
+        // R = A^{-1} R, the correction dX.
+        solve( R );
+
+        colNorms( Norm::Max, X, colnorms_X.data(), opts );
+        colNorms( Norm::Max, R, colnorms_dX.data(), opts );
+        for (int64_t j = 0; j < nrhs; ++j) {
+            if (colnorms_X[ j ] > 0)
+                ferr[ j ] = colnorms_dX[ j ] / colnorms_X[ j ];
+            else
+                ferr[ j ] = colnorms_dX[ j ] > 0
+                          ? std::numeric_limits<real_t>::infinity() : 0;
+        }
+
+        if (berr_max > tol && berr_max <= berr_last / 2 && iter < itermax) {
+            add( one, R, one, X, opts );
+            berr_last = berr_max;
+            ++iter;
+        }
+        else {
+            break;
+        }
+    }
+    return iter;
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel iterative refinement of the solution to a general
+/// system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// using an existing LU factorization from getrf, and residuals
+/// $R = B - A X$ accumulated in about twice the working precision by a
+/// compensated (double-word) tile gemm kernel.
+/// The factorization may be in lower precision than $A$, e.g., single
+/// precision factors to solve a double precision system; refinement then
+/// gives a solution comparable to a double precision solve.
+///
+/// Each step costs one residual, similar to a gemm with nrhs columns,
+/// and one getrs. Refinement stops when the componentwise backward error
+/// is below the tolerance, stops halving, or after 30 steps.
+/// The residual computation runs on the host.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+///
+/// @tparam scalar_lo
+///     Precision of the factors, either scalar_t or, for double precision
+///     scalar_t, the corresponding single precision.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The original n-by-n matrix $A$.
+///
+/// @param[in] LU
+///     The factors $L$ and $U$ from the factorization $A = P L U$,
+///     as computed by getrf.
+///
+/// @param[in] pivots
+///     The pivot indices from getrf.
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix $B$.
+///
+/// @param[in,out] X
+///     On entry, the n-by-nrhs solution matrix $X$, e.g., from getrs.
+///     On exit, the refined solution.
+///
+/// @param[out] ferr
+///     Estimated relative forward error of each column of $X$,
+///     $\|x_j - x^{true}_j\|_{\infty} / \|x_j\|_{\infty}$, taken from one
+///     more correction step that is not applied. It is reliable when
+///     refinement converged, i.e., the factorization is accurate enough.
+///
+/// @param[out] berr
+///     Componentwise relative backward error of each column of $X$,
+///     $\max_i |b - A x|_i / (|A| |x| + |b|)_i$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Tolerance:
+///       Refinement stops when the backward error $\le tol$.
+///       Default epsilon.
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target for getrs. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @return the number of refinement steps applied.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_t, typename scalar_lo>
+int64_t gerfs(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_lo>& LU, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    std::vector< blas::real_type<scalar_t> >& ferr,
+    std::vector< blas::real_type<scalar_t> >& berr,
+    Options const& opts)
+{
+    slate_assert( A.m() == A.n() );
+    slate_assert( LU.m() == A.m() && LU.n() == A.n() );
+    slate_assert( B.m() == A.m() && X.m() == A.n() && X.n() == B.n() );
+
+    auto X_lo = X.template emptyLike<scalar_lo>();
+    auto solve = [&]( Matrix<scalar_t>& Y ) {
+        if constexpr (std::is_same<scalar_lo, scalar_t>::value) {
+            getrs( LU, pivots, Y, opts );
+        }
+        else {
+            copy( Y, X_lo, opts );
+            getrs( LU, pivots, X_lo, opts );
+            copy( X_lo, Y, opts );
+        }
+    };
+    if (! std::is_same<scalar_lo, scalar_t>::value)
+        X_lo.insertLocalTiles();
+
+    return impl::rfs( A, solve, B, X, ferr, berr, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel iterative refinement of the solution to a Hermitian
+/// positive definite system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// using an existing Cholesky factorization from potrf, and residuals
+/// accumulated in about twice the working precision.
+/// See gerfs for details.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+///
+/// @tparam scalar_lo
+///     Precision of the factor, either scalar_t or, for double precision
+///     scalar_t, the corresponding single precision.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The original n-by-n Hermitian positive definite matrix $A$.
+///
+/// @param[in] LLH
+///     The Cholesky factor of $A$, as computed by potrf.
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix $B$.
+///
+/// @param[in,out] X
+///     On entry, the n-by-nrhs solution matrix $X$, e.g., from potrs.
+///     On exit, the refined solution.
+///
+/// @param[out] ferr
+///     Estimated relative forward error of each column of $X$; see gerfs.
+///
+/// @param[out] berr
+///     Componentwise relative backward error of each column of $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs; see gerfs.
+///
+/// @return the number of refinement steps applied.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t, typename scalar_lo>
+int64_t porfs(
+    HermitianMatrix<scalar_t>& A,
+    HermitianMatrix<scalar_lo>& LLH,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    std::vector< blas::real_type<scalar_t> >& ferr,
+    std::vector< blas::real_type<scalar_t> >& berr,
+    Options const& opts)
+{
+    slate_assert( LLH.n() == A.n() );
+    slate_assert( B.m() == A.n() && X.m() == A.n() && X.n() == B.n() );
+
+    auto X_lo = X.template emptyLike<scalar_lo>();
+    auto solve = [&]( Matrix<scalar_t>& Y ) {
+        if constexpr (std::is_same<scalar_lo, scalar_t>::value) {
+            potrs( LLH, Y, opts );
+        }
+        else {
+            copy( Y, X_lo, opts );
+            potrs( LLH, X_lo, opts );
+            copy( X_lo, Y, opts );
+        }
+    };
+    if (! std::is_same<scalar_lo, scalar_t>::value)
+        X_lo.insertLocalTiles();
+
+    return impl::rfs( A, solve, B, X, ferr, berr, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel iterative refinement of the solution to a Hermitian
+/// indefinite system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// using an existing Aasen's factorization from hetrf, and residuals
+/// accumulated in about twice the working precision.
+/// See gerfs for details.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+///
+/// @tparam scalar_lo
+///     Precision of the factors, either scalar_t or, for double precision
+///     scalar_t, the corresponding single precision.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The original n-by-n Hermitian matrix $A$.
+///
+/// @param[in] LTL
+///     The factor $L$ from hetrf.
+///
+/// @param[in] pivots
+///     The pivot indices from hetrf.
+///
+/// @param[in] T
+///     The band matrix $T$ from hetrf.
+///
+/// @param[in] pivots2
+///     The pivot indices of the LU factorization of $T$ from hetrf.
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix $B$.
+///
+/// @param[in,out] X
+///     On entry, the n-by-nrhs solution matrix $X$, e.g., from hetrs.
+///     On exit, the refined solution.
+///
+/// @param[out] ferr
+///     Estimated relative forward error of each column of $X$; see gerfs.
+///
+/// @param[out] berr
+///     Componentwise relative backward error of each column of $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs; see gerfs.
+///
+/// @return the number of refinement steps applied.
+///
+/// @ingroup hesv_computational
+///
+template <typename scalar_t, typename scalar_lo>
+int64_t herfs(
+    HermitianMatrix<scalar_t>& A,
+    HermitianMatrix<scalar_lo>& LTL, Pivots& pivots,
+         BandMatrix<scalar_lo>& T,   Pivots& pivots2,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    std::vector< blas::real_type<scalar_t> >& ferr,
+    std::vector< blas::real_type<scalar_t> >& berr,
+    Options const& opts)
+{
+    slate_assert( LTL.n() == A.n() );
+    slate_assert( B.m() == A.n() && X.m() == A.n() && X.n() == B.n() );
+
+    auto X_lo = X.template emptyLike<scalar_lo>();
+    auto solve = [&]( Matrix<scalar_t>& Y ) {
+        if constexpr (std::is_same<scalar_lo, scalar_t>::value) {
+            hetrs( LTL, pivots, T, pivots2, Y, opts );
+        }
+        else {
+            copy( Y, X_lo, opts );
+            hetrs( LTL, pivots, T, pivots2, X_lo, opts );
+            copy( X_lo, Y, opts );
+        }
+    };
+    if (! std::is_same<scalar_lo, scalar_t>::value)
+        X_lo.insertLocalTiles();
+
+    return impl::rfs( A, solve, B, X, ferr, berr, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gerfs<float, float>(
+    Matrix<float>& A,
+    Matrix<float>& LU, Pivots& pivots,
+    Matrix<float>& B,
+    Matrix<float>& X,
+    std::vector<float>& ferr,
+    std::vector<float>& berr,
+    Options const& opts);
+
+template
+int64_t gerfs<double, double>(
+    Matrix<double>& A,
+    Matrix<double>& LU, Pivots& pivots,
+    Matrix<double>& B,
+    Matrix<double>& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t gerfs<double, float>(
+    Matrix<double>& A,
+    Matrix<float>& LU, Pivots& pivots,
+    Matrix<double>& B,
+    Matrix<double>& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t gerfs< std::complex<float>, std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& LU, Pivots& pivots,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& X,
+    std::vector<float>& ferr,
+    std::vector<float>& berr,
+    Options const& opts);
+
+template
+int64_t gerfs< std::complex<double>, std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& LU, Pivots& pivots,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t gerfs< std::complex<double>, std::complex<float> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<float> >& LU, Pivots& pivots,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+int64_t porfs<float, float>(
+    HermitianMatrix<float>& A,
+    HermitianMatrix<float>& LLH,
+    Matrix<float>& B,
+    Matrix<float>& X,
+    std::vector<float>& ferr,
+    std::vector<float>& berr,
+    Options const& opts);
+
+template
+int64_t porfs<double, double>(
+    HermitianMatrix<double>& A,
+    HermitianMatrix<double>& LLH,
+    Matrix<double>& B,
+    Matrix<double>& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t porfs<double, float>(
+    HermitianMatrix<double>& A,
+    HermitianMatrix<float>& LLH,
+    Matrix<double>& B,
+    Matrix<double>& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t porfs< std::complex<float>, std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    HermitianMatrix< std::complex<float> >& LLH,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& X,
+    std::vector<float>& ferr,
+    std::vector<float>& berr,
+    Options const& opts);
+
+template
+int64_t porfs< std::complex<double>, std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    HermitianMatrix< std::complex<double> >& LLH,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t porfs< std::complex<double>, std::complex<float> >(
+    HermitianMatrix< std::complex<double> >& A,
+    HermitianMatrix< std::complex<float> >& LLH,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+int64_t herfs<float, float>(
+    HermitianMatrix<float>& A,
+    HermitianMatrix<float>& LTL, Pivots& pivots,
+         BandMatrix<float>& T,   Pivots& pivots2,
+    Matrix<float>& B,
+    Matrix<float>& X,
+    std::vector<float>& ferr,
+    std::vector<float>& berr,
+    Options const& opts);
+
+template
+int64_t herfs<double, double>(
+    HermitianMatrix<double>& A,
+    HermitianMatrix<double>& LTL, Pivots& pivots,
+         BandMatrix<double>& T,   Pivots& pivots2,
+    Matrix<double>& B,
+    Matrix<double>& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t herfs<double, float>(
+    HermitianMatrix<double>& A,
+    HermitianMatrix<float>& LTL, Pivots& pivots,
+         BandMatrix<float>& T,   Pivots& pivots2,
+    Matrix<double>& B,
+    Matrix<double>& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t herfs< std::complex<float>, std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    HermitianMatrix< std::complex<float> >& LTL, Pivots& pivots,
+         BandMatrix< std::complex<float> >& T,   Pivots& pivots2,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& X,
+    std::vector<float>& ferr,
+    std::vector<float>& berr,
+    Options const& opts);
+
+template
+int64_t herfs< std::complex<double>, std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    HermitianMatrix< std::complex<double> >& LTL, Pivots& pivots,
+         BandMatrix< std::complex<double> >& T,   Pivots& pivots2,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+template
+int64_t herfs< std::complex<double>, std::complex<float> >(
+    HermitianMatrix< std::complex<double> >& A,
+    HermitianMatrix< std::complex<float> >& LTL, Pivots& pivots,
+         BandMatrix< std::complex<float> >& T,   Pivots& pivots2,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& X,
+    std::vector<double>& ferr,
+    std::vector<double>& berr,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,94 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_reverse.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel RQ factorization.
+///
+/// Computes a RQ factorization of an m-by-n matrix $A$.
+/// The factorization has the form
+/// \[
+///     A = RQ,
+/// \]
+/// where $Q$ is a matrix with orthonormal rows and $R$ is upper triangular
+/// (or upper trapezoidal if m > n).
+///
+/// With the exchange matrix $J$ that reverses the order of rows or
+/// columns, the LQ factorization $J A J = L Z$ gives $A = R Q$ with
+/// $R = J L J$ and $Q = J Z J$. So the RQ factorization is computed by
+/// gelqf on a reversed copy of $A$, which is then reversed back into $A$.
+/// Reversing the matrix takes two all-to-all exchanges each way, and a
+/// workspace the size of $A$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$.
+///     On exit, if m <= n, the upper triangle of the trailing m-by-m
+///     submatrix $A( 0:m-1, n-m:n-1 )$ contains the upper triangular
+///     matrix $R$; if m > n, the elements on and above the (m-n)-th
+///     subdiagonal contain the m-by-n upper trapezoidal matrix $R$.
+///     The remaining elements represent the unitary matrix $Q$ as a
+///     product of elementary reflectors, in the reversed layout of gelqf,
+///     to be used with unmrq.
+///
+/// @param[out] T
+///     On exit, triangular matrices of the block reflectors.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to gelqf.
+///
+/// @ingroup gerqf_computational
+///
+template <typename scalar_t>
+void gerqf(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Options const& opts )
+{
+    auto Ar = A.emptyLike();
+    Ar.insertLocalTiles();
+    internal::reverse_copy( A, Ar );
+
+    gelqf( Ar, T, opts );
+
+    internal::reverse_copy( Ar, A );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gerqf<float>(
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Options const& opts);
+
+template
+void gerqf<double>(
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Options const& opts);
+
+template
+void gerqf< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Options const& opts);
+
+template
+void gerqf< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,455 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Process groups for multi-shift solves. Group g is the contiguous ranks
+/// [ first[ g ], first[ g+1 ] ) of the parent communicator, arranged as a
+/// p[ g ]-by-q[ g ] column-major grid, as close to square as possible.
+/// The shifts are assigned round-robin: shift i to group i % ngroups.
+///
+/// @ingroup gesv_impl
+///
+class MultishiftGroups {
+public:
+    MultishiftGroups( MPI_Comm comm, int ngroups )
+        : ngroups_( ngroups ),
+          first_( ngroups + 1 ),
+          p_( ngroups ),
+          q_( ngroups )
+    {
+        int mpi_size, mpi_rank;
+        slate_mpi_call(
+            MPI_Comm_size( comm, &mpi_size ));
+        slate_mpi_call(
+            MPI_Comm_rank( comm, &mpi_rank ));
+
+        // first[ g ] = ceil( g * size / ngroups ).
+        for (int g = 0; g <= ngroups; ++g)
+            first_[ g ] = int( (int64_t( g ) * mpi_size + ngroups - 1) / ngroups );
+
+        for (int g = 0; g < ngroups; ++g) {
+            int size = first_[ g+1 ] - first_[ g ];
+            int p = int( std::sqrt( double( size ) ) );
+            while (size % p != 0)
+                --p;
+            p_[ g ] = p;
+            q_[ g ] = size / p;
+            if (first_[ g ] <= mpi_rank && mpi_rank < first_[ g+1 ])
+                my_group_ = g;
+        }
+
+        slate_mpi_call(
+            MPI_Comm_split( comm, my_group_, mpi_rank, &group_comm_ ));
+    }
+
+    int ngroups() const { return ngroups_; }
+    int my_group() const { return my_group_; }
+    int first( int g ) const { return first_[ g ]; }
+    int p( int g ) const { return p_[ g ]; }
+    int q( int g ) const { return q_[ g ]; }
+
+    /// Communicator of this rank's group. Not freed by the destructor,
+    /// since matrices returned to the caller may use it.
+    MPI_Comm group_comm() const { return group_comm_; }
+
+private:
+    int ngroups_;
+    int my_group_ = 0;
+    std::vector<int> first_, p_, q_;
+    MPI_Comm group_comm_;
+};
+
+//------------------------------------------------------------------------------
+/// Returns an m-by-n matrix on the parent communicator with the same tiling
+/// and tile to rank mapping as a p-by-q block cyclic matrix on group g, so
+/// redistribute on the parent communicator can move data to and from the
+/// group. On ranks of group g, its tiles are views of the local tiles of
+/// X_group, a matrix on the group communicator.
+///
+/// @ingroup gesv_impl
+///
+template <typename scalar_t>
+Matrix<scalar_t> multishift_mirror(
+    int64_t m, int64_t n, int64_t nb,
+    MultishiftGroups const& groups, int g, MPI_Comm comm,
+    Matrix<scalar_t>* X_group )
+{
+    using ij_tuple = typename Matrix<scalar_t>::ij_tuple;
+
+    int first = groups.first( g );
+    int p = groups.p( g );
+    int q = groups.q( g );
+
+    std::function<int64_t (int64_t)> tileMb = [m, nb]( int64_t i ) {
+        return (i + 1)*nb > m ? m%nb : nb;
+    };
+    std::function<int64_t (int64_t)> tileNb = [n, nb]( int64_t j ) {
+        return (j + 1)*nb > n ? n%nb : nb;
+    };
+    std::function<int (ij_tuple)> tileRank = [first, p, q]( ij_tuple ij ) {
+        int64_t i = std::get<0>( ij );
+        int64_t j = std::get<1>( ij );
+        return first + int( (i%p) + (j%q)*p );
+    };
+    std::function<int (ij_tuple)> tileDevice = []( ij_tuple ij ) {
+        return HostNum;
+    };
+
+    Matrix<scalar_t> M( m, n, tileMb, tileNb, tileRank, tileDevice, comm );
+    if (X_group != nullptr) {
+        auto& X = *X_group;
+        X.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+        for (int64_t j = 0; j < X.nt(); ++j) {
+            for (int64_t i = 0; i < X.mt(); ++i) {
+                if (X.tileIsLocal( i, j )) {
+                    auto T = X( i, j );
+                    M.tileInsert( i, j, HostNum, T.data(), T.stride() );
+                }
+            }
+        }
+    }
+    return M;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the parent-communicator matrix A to a new block cyclic matrix on
+/// this rank's group. Every rank takes part in one redistribute per group.
+///
+/// @ingroup gesv_impl
+///
+template <typename scalar_t>
+Matrix<scalar_t> multishift_scatter(
+    Matrix<scalar_t>& A, int64_t nb, MultishiftGroups const& groups )
+{
+    int my_group = groups.my_group();
+    Matrix<scalar_t> A_group(
+        A.m(), A.n(), nb, groups.p( my_group ), groups.q( my_group ),
+        groups.group_comm() );
+    A_group.insertLocalTiles();
+
+    for (int g = 0; g < groups.ngroups(); ++g) {
+        auto A_mirror = multishift_mirror(
+            A.m(), A.n(), nb, groups, g, A.mpiComm(),
+            g == my_group ? &A_group : nullptr );
+        redistribute( A, A_mirror );
+    }
+    return A_group;
+}
+
+//------------------------------------------------------------------------------
+/// Factors A - shifts[ i ] I for the shifts assigned to this rank's group.
+/// A is sent to each group once, then copied locally for each of its shifts.
+///
+/// @ingroup gesv_impl
+///
+template <typename scalar_t>
+void getrf_multishift(
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t> const& shifts,
+    MultishiftGroups const& groups,
+    int64_t nb,
+    std::vector<int64_t>& shift_index,
+    std::vector< Matrix<scalar_t> >& LU,
+    std::vector<Pivots>& pivots,
+    Options const& opts )
+{
+    int64_t nshifts = shifts.size();
+    int ngroups = groups.ngroups();
+    int my_group = groups.my_group();
+
+    auto A_group = multishift_scatter( A, nb, groups );
+
+    shift_index.clear();
+    LU.clear();
+    pivots.clear();
+    for (int64_t s = my_group; s < nshifts; s += ngroups) {
+        auto LUs = A_group.emptyLike();
+        LUs.insertLocalTiles();
+        slate::copy( A_group, LUs, opts );
+
+        // LUs -= shifts[ s ] I, on local diagonal tiles.
+        for (int64_t k = 0; k < std::min( LUs.mt(), LUs.nt() ); ++k) {
+            if (LUs.tileIsLocal( k, k )) {
+                LUs.tileGetForWriting( k, k, LayoutConvert::ColMajor );
+                auto T = LUs( k, k );
+                for (int64_t ii = 0; ii < std::min( T.mb(), T.nb() ); ++ii)
+                    T.at( ii, ii ) -= shifts[ s ];
+            }
+        }
+
+        Pivots piv;
+        getrf( LUs, piv, opts );
+
+        shift_index.push_back( s );
+        LU.push_back( LUs );
+        pivots.push_back( std::move( piv ) );
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel LU factorization of multiple shifted matrices,
+/// \[
+///     A - \sigma_i I = P_i L_i U_i,
+/// \]
+/// for shifts $\sigma_i$, as needed by contour-integral eigensolvers and
+/// rational Krylov methods.
+///
+/// The ranks of A's communicator are split into Option::ShiftGroups
+/// groups of contiguous ranks, each with its own communicator and a
+/// near-square process grid. Shift i is factored by group
+/// i % ShiftGroups; groups factor their shifts concurrently. A is sent to
+/// each group once, with one redistribute per group, and copied locally
+/// for each shift the group handles.
+///
+/// On exit, each rank holds the factors for its own group's shifts.
+/// Each LU[ k ] can be passed with pivots[ k ] to getrs, with a right hand
+/// side on the same communicator, LU[ k ].mpiComm(). That communicator is
+/// created by this routine; the caller frees it with MPI_Comm_free once
+/// the factors are no longer needed.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-n matrix $A$. Not modified. Must not be transposed.
+///
+/// @param[in] shifts
+///     The shifts $\sigma_i$. Must be the same on all ranks.
+///
+/// @param[out] shift_index
+///     Indices into shifts of the shifts factored by this rank's group,
+///     in increasing order.
+///
+/// @param[out] LU
+///     LU[ k ] is the factorization of $A - \sigma_{s} I$ with
+///     s = shift_index[ k ], distributed over this rank's group,
+///     with the same tile size as A.
+///
+/// @param[out] pivots
+///     pivots[ k ] are the pivot indices of LU[ k ].
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::ShiftGroups:
+///       Number of process groups, 1 <= ShiftGroups <= min( number of
+///       shifts, number of ranks ). Default min( number of shifts,
+///       number of ranks ).
+///     - Other options are passed to getrf.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrf_multishift(
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t> const& shifts,
+    std::vector<int64_t>& shift_index,
+    std::vector< Matrix<scalar_t> >& LU,
+    std::vector<Pivots>& pivots,
+    Options const& opts)
+{
+    slate_assert( A.m() == A.n() );  // square
+    slate_assert( A.op() == Op::NoTrans );
+    slate_assert( shifts.size() > 0 );
+
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( A.mpiComm(), &mpi_size ));
+    int64_t max_groups = std::min( int64_t( shifts.size() ), int64_t( mpi_size ) );
+    int64_t ngroups = get_option<int64_t>( opts, Option::ShiftGroups, max_groups );
+    slate_error_if( ngroups < 1 || ngroups > max_groups );
+
+    impl::MultishiftGroups groups( A.mpiComm(), int( ngroups ) );
+    impl::getrf_multishift( A, shifts, groups, A.tileNb( 0 ),
+                            shift_index, LU, pivots, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel solve of multiple shifted systems,
+/// \[
+///     (A - \sigma_i I) X_i = B,
+/// \]
+/// for shifts $\sigma_i$. Factors the shifted matrices concurrently on
+/// process groups, as in getrf_multishift, solves each with getrs on its
+/// group, and returns each $X_i$ distributed like B.
+/// This scales better than calling gesv for each shift on all ranks,
+/// since each factorization uses a smaller grid with less communication.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-n matrix $A$. Not modified. Must not be transposed.
+///
+/// @param[in] shifts
+///     The shifts $\sigma_i$. Must be the same on all ranks.
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix $B$, on the same
+///     communicator as A. Not modified. Must not be transposed.
+///
+/// @param[out] X
+///     X[ i ] is the n-by-nrhs solution for shifts[ i ],
+///     allocated with the same distribution as B.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::ShiftGroups:
+///       Number of process groups. Default min( number of shifts,
+///       number of ranks ).
+///     - Other options are passed to getrf and getrs.
+///
+/// @ingroup gesv
+///
+template <typename scalar_t>
+void gesv_multishift(
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t> const& shifts,
+    Matrix<scalar_t>& B,
+    std::vector< Matrix<scalar_t> >& X,
+    Options const& opts)
+{
+    slate_assert( A.m() == A.n() );  // square
+    slate_assert( A.op() == Op::NoTrans && B.op() == Op::NoTrans );
+    slate_assert( B.m() == A.m() );
+    slate_assert( shifts.size() > 0 );
+
+    MPI_Comm comm = A.mpiComm();
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ));
+    int64_t nshifts = shifts.size();
+    int64_t max_groups = std::min( nshifts, int64_t( mpi_size ) );
+    int64_t ngroups = get_option<int64_t>( opts, Option::ShiftGroups, max_groups );
+    slate_error_if( ngroups < 1 || ngroups > max_groups );
+
+    impl::MultishiftGroups groups( comm, int( ngroups ) );
+    int my_group = groups.my_group();
+    int64_t nb = A.tileNb( 0 );
+
+    {
+        std::vector<int64_t> shift_index;
+        std::vector< Matrix<scalar_t> > LU;
+        std::vector<Pivots> pivots;
+        impl::getrf_multishift( A, shifts, groups, nb,
+                                shift_index, LU, pivots, opts );
+
+        // Solve on the groups.
+        auto B_group = impl::multishift_scatter( B, nb, groups );
+        std::vector< Matrix<scalar_t> > X_group( LU.size() );
+        for (size_t k = 0; k < LU.size(); ++k) {
+            X_group[ k ] = B_group.emptyLike();
+            X_group[ k ].insertLocalTiles();
+            slate::copy( B_group, X_group[ k ], opts );
+            getrs( LU[ k ], pivots[ k ], X_group[ k ], opts );
+        }
+
+        // Bring each solution back to B's distribution. Every rank takes
+        // part in each redistribute, in the same order.
+        X.resize( nshifts );
+        for (int64_t s = 0; s < nshifts; ++s) {
+            int g = int( s % ngroups );
+            X[ s ] = B.emptyLike();
+            X[ s ].insertLocalTiles();
+            auto X_mirror = impl::multishift_mirror(
+                B.m(), B.n(), nb, groups, g, comm,
+                g == my_group ? &X_group[ s / ngroups ] : nullptr );
+            redistribute( X_mirror, X[ s ] );
+        }
+    }
+
+    // Group matrices are out of scope, so the group communicator is unused.
+    MPI_Comm group_comm = groups.group_comm();
+    slate_mpi_call(
+        MPI_Comm_free( &group_comm ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrf_multishift<float>(
+    Matrix<float>& A,
+    std::vector<float> const& shifts,
+    std::vector<int64_t>& shift_index,
+    std::vector< Matrix<float> >& LU,
+    std::vector<Pivots>& pivots,
+    Options const& opts);
+
+template
+void getrf_multishift<double>(
+    Matrix<double>& A,
+    std::vector<double> const& shifts,
+    std::vector<int64_t>& shift_index,
+    std::vector< Matrix<double> >& LU,
+    std::vector<Pivots>& pivots,
+    Options const& opts);
+
+template
+void getrf_multishift< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    std::vector< std::complex<float> > const& shifts,
+    std::vector<int64_t>& shift_index,
+    std::vector< Matrix< std::complex<float> > >& LU,
+    std::vector<Pivots>& pivots,
+    Options const& opts);
+
+template
+void getrf_multishift< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    std::vector< std::complex<double> > const& shifts,
+    std::vector<int64_t>& shift_index,
+    std::vector< Matrix< std::complex<double> > >& LU,
+    std::vector<Pivots>& pivots,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void gesv_multishift<float>(
+    Matrix<float>& A,
+    std::vector<float> const& shifts,
+    Matrix<float>& B,
+    std::vector< Matrix<float> >& X,
+    Options const& opts);
+
+template
+void gesv_multishift<double>(
+    Matrix<double>& A,
+    std::vector<double> const& shifts,
+    Matrix<double>& B,
+    std::vector< Matrix<double> >& X,
+    Options const& opts);
+
+template
+void gesv_multishift< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    std::vector< std::complex<float> > const& shifts,
+    Matrix< std::complex<float> >& B,
+    std::vector< Matrix< std::complex<float> > >& X,
+    Options const& opts);
+
+template
+void gesv_multishift< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    std::vector< std::complex<double> > const& shifts,
+    Matrix< std::complex<double> >& B,
+    std::vector< Matrix< std::complex<double> > >& X,
+    Options const& opts);
+
+} // namespace slate
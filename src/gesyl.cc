@@ -0,0 +1,133 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Sylvester equation solve.
+///
+/// Solves
+/// \[
+///     A X + sign X B = C,
+/// \]
+/// by the Bartels-Stewart method: reduce $A = Z_A T_A Z_A^H$ and
+/// $B = Z_B T_B Z_B^H$ to Schur form with gees, transform
+/// $C = Z_A^H C Z_B$, solve the triangular equation with trsyl,
+/// and transform back $X = Z_A X Z_B^H$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] sign
+///     +1 or -1, the sign in the equation.
+///
+/// @param[in,out] A
+///     On entry, the m-by-m matrix $A$.
+///     On exit, overwritten by its Schur form $T_A$.
+///
+/// @param[in,out] B
+///     On entry, the n-by-n matrix $B$.
+///     On exit, overwritten by its Schur form $T_B$.
+///
+/// @param[in,out] C
+///     On entry, the m-by-n matrix $C$.
+///     On exit, overwritten by the solution $X$.
+///     $A$, $B$, and $C$ must have the same square tile size.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// The equation has a unique solution if $A$ and $-sign B$ have no common
+/// eigenvalues.
+///
+/// @ingroup geev
+///
+template <typename scalar_t>
+void gesyl(
+    int sign,
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    // Schur forms A = ZA TA ZA^H, B = ZB TB ZB^H.
+    std::vector< std::complex<real_t> > Lambda_A( A.n() );
+    auto ZA = A.emptyLike();
+    ZA.insertLocalTiles();
+    gees( A, Lambda_A, ZA, opts );
+
+    std::vector< std::complex<real_t> > Lambda_B( B.n() );
+    auto ZB = B.emptyLike();
+    ZB.insertLocalTiles();
+    gees( B, Lambda_B, ZB, opts );
+
+    auto ZAH = conj_transpose( ZA );
+    auto ZBH = conj_transpose( ZB );
+
+    // C = ZA^H C ZB.
+    auto W = C.emptyLike();
+    W.insertLocalTiles();
+    gemm( one, ZAH, C, zero, W, opts );
+    gemm( one, W, ZB, zero, C, opts );
+
+    trsyl( sign, A, B, C, opts );
+
+    // X = ZA X ZB^H.
+    gemm( one, ZA, C, zero, W, opts );
+    gemm( one, W, ZBH, zero, C, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gesyl<float>(
+    int sign,
+    Matrix<float>& A,
+    Matrix<float>& B,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void gesyl<double>(
+    int sign,
+    Matrix<double>& A,
+    Matrix<double>& B,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void gesyl< std::complex<float> >(
+    int sign,
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void gesyl< std::complex<double> >(
+    int sign,
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
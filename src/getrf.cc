@@ -9,6 +9,7 @@
 #include "slate/Tile_blas.hh"
 #include "slate/TriangularMatrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_checkpoint.hh"
 
 namespace slate {
 
@@ -22,7 +23,7 @@ namespace impl {
 ///
 template <Target target, typename scalar_t>
 void getrf(
-    Matrix<scalar_t>& A, Pivots& pivots,
+    Matrix<scalar_t>& A, Pivots& pivots, int64_t k_start,
     Options const& opts )
 {
     using real_t = blas::real_type<scalar_t>;
@@ -53,9 +54,14 @@ void getrf(
     //       ScaLAPACK
     Layout host_layout = Layout::ColMajor;
     Layout target_layout = Layout::ColMajor;
-    // GPU Devices use RowMajor for efficient row swapping.
-    if (target == Target::Devices)
-        target_layout = Layout::RowMajor;
+    // GPU Devices use RowMajor for efficient row swapping, unless
+    // Option::Layout requests ColMajor, e.g., to work directly on
+    // ScaLAPACK data without layout conversion and extra buffers.
+    if (target == Target::Devices) {
+        target_layout = get_option( opts, Option::Layout, Layout::RowMajor );
+        slate_assert( target_layout == Layout::RowMajor
+                      || target_layout == Layout::ColMajor );
+    }
 
     int64_t A_nt = A.nt();
     int64_t A_mt = A.mt();
@@ -78,13 +84,23 @@ void getrf(
         A.reserveDeviceWorkspace();
     }
 
+    // Checkpoint every CheckpointInterval panels, if enabled.
+    internal::Checkpoint<scalar_t> checkpoint(
+        "getrf", opts, k_start, A.mpiComm() );
+
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
 
     #pragma omp parallel
     #pragma omp master
     {
-        for (int64_t k = 0; k < min_mt_nt; ++k) {
+        for (int64_t k = k_start; k < min_mt_nt; ++k) {
+            // Save A and pivots after panels 0:k-1, their updates,
+            // and their row swaps to the left are complete.
+            if (checkpoint.due( k )) {
+                #pragma omp taskwait
+                checkpoint.save( k, A, &pivots );
+            }
 
             int64_t diag_len = std::min(A.tileMb(k), A.tileNb(k));
             pivots.at(k).resize(diag_len);
@@ -229,9 +245,125 @@ void getrf(
 
         A.tileLayoutReset();
     }
+    checkpoint.finish();
+
     A.clearWorkspace();
 }
 
+//------------------------------------------------------------------------------
+/// Distributed parallel LU factorization with partial pivoting,
+/// starting from panel k_start. Dispatches to target implementations.
+/// @ingroup gesv_impl
+///
+template <typename scalar_t>
+void getrf(
+    Matrix<scalar_t>& A, Pivots& pivots, int64_t k_start,
+    Options const& opts )
+{
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+            getrf<Target::HostTask>( A, pivots, k_start, opts );
+            break;
+
+        case Target::HostNest:
+            getrf<Target::HostNest>( A, pivots, k_start, opts );
+            break;
+
+        case Target::HostBatch:
+            getrf<Target::HostBatch>( A, pivots, k_start, opts );
+            break;
+
+        case Target::Devices:
+            getrf<Target::Devices>( A, pivots, k_start, opts );
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel LU factorization, batching row interchanges.
+/// Panels are factored in blocks of pivot_batch panels, swapping rows
+/// within the block as usual. The pivots of a block's panels are composed
+/// into one permutation, applied once to the trailing columns before the
+/// block's rank-(pivot_batch nb) update. Row swaps to the left of each block
+/// are deferred to the end, where each block column is permuted once by the
+/// composition of the pivots of all later panels.
+/// @ingroup gesv_impl
+///
+template <typename scalar_t>
+void getrf_pivot_batch(
+    Matrix<scalar_t>& A, Pivots& pivots, int64_t pivot_batch,
+    Options const& opts )
+{
+    // Constants
+    const scalar_t one = 1.0;
+    const int priority_0 = 0;
+    const int tag_0 = 0;
+
+    // Checkpoints of the blocks would not restart the whole factorization.
+    Options opts_block = opts;
+    opts_block[ Option::CheckpointInterval ] = int64_t( 0 );
+
+    int64_t A_nt = A.nt();
+    int64_t A_mt = A.mt();
+    int64_t min_mt_nt = std::min(A.mt(), A.nt());
+    pivots.resize(min_mt_nt);
+
+    for (int64_t k0 = 0; k0 < min_mt_nt; k0 += pivot_batch) {
+        int64_t k1 = std::min( k0 + pivot_batch, min_mt_nt );
+
+        // factor A(k0:mt-1, k0:k1-1)
+        // Pivots are relative to each panel, so they carry over unchanged.
+        Pivots pivots_k;
+        auto Ak = A.sub(k0, A_mt-1, k0, k1-1);
+        getrf( Ak, pivots_k, 0, opts_block );
+        std::move( pivots_k.begin(), pivots_k.end(), pivots.begin() + k0 );
+
+        if (k1 < A_nt) {
+            // swap rows in A(k0:mt-1, k1:nt-1), each row at most once
+            std::map<Pivot, Pivot> pivot_map;
+            for (int64_t k = k0; k < k1; ++k)
+                internal::composeParallelPivot( k - k0, pivots[ k ], pivot_map );
+            #pragma omp parallel
+            #pragma omp master
+            internal::permuteRowsMap<Target::HostTask>(
+                pivot_map, A.sub(k0, A_mt-1, k1, A_nt-1),
+                Layout::ColMajor, priority_0, tag_0 );
+
+            // solve A(k0:k1-1, k0:k1-1) U = A(k0:k1-1, k1:nt-1)
+            auto Akk = A.sub(k0, k1-1, k0, k1-1);
+            auto Lkk = TriangularMatrix<scalar_t>( Uplo::Lower, Diag::Unit, Akk );
+            auto Ukj = A.sub(k0, k1-1, k1, A_nt-1);
+            slate::trsm( Side::Left, one, Lkk, Ukj, opts );
+
+            // A(k1:mt-1, k1:nt-1) -= A(k1:mt-1, k0:k1-1) * A(k0:k1-1, k1:nt-1)
+            if (k1 < A_mt) {
+                auto Lik = A.sub(k1, A_mt-1, k0, k1-1);
+                auto Aij = A.sub(k1, A_mt-1, k1, A_nt-1);
+                slate::gemm( -one, Lik, Ukj, one, Aij, opts );
+            }
+        }
+    }
+
+    // Deferred swaps to the left: swap rows in A(k1:mt-1, k0:k1-1),
+    // each row at most once, by the pivots of panels k1, ..., min_mt_nt-1.
+    for (int64_t k0 = 0; k0 < min_mt_nt; k0 += pivot_batch) {
+        int64_t k1 = std::min( k0 + pivot_batch, min_mt_nt );
+        if (k1 < min_mt_nt) {
+            std::map<Pivot, Pivot> pivot_map;
+            for (int64_t k = k1; k < min_mt_nt; ++k)
+                internal::composeParallelPivot( k - k1, pivots[ k ], pivot_map );
+            #pragma omp parallel
+            #pragma omp master
+            internal::permuteRowsMap<Target::HostTask>(
+                pivot_map, A.sub(k1, A_mt-1, k0, k1-1),
+                Layout::ColMajor, priority_0, tag_0 );
+        }
+    }
+}
+
 } // namespace impl
 
 //------------------------------------------------------------------------------
@@ -286,6 +418,13 @@ void getrf(
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
 ///
+///     - Option::Layout:
+///       Tile layout used on GPU devices. Possible values:
+///       - RowMajor:  rows are contiguous for fast row swaps [default].
+///       - ColMajor:  no layout conversion. For a matrix from
+///         fromScaLAPACK, this avoids extended tile buffers and the
+///         conversion back to the ScaLAPACK layout at the end.
+///
 ///    - Option::PivotThreshold:
 ///      Strictness of the pivot selection.  Between 0 and 1 with 1 giving
 ///      partial pivoting and 0 giving no pivoting.  Default 1.
@@ -297,6 +436,28 @@ void getrf(
 ///       - MethodLU::NoPiv: no pivoting.
 ///         Note pivots vector is currently ignored for NoPiv.
 ///
+///    - Option::PivotBatch:
+///      For MethodLU::PartialPiv, number of panels whose row interchanges
+///      are applied together. If > 1, panels are factored in blocks of
+///      this many panels; each block's pivots are applied to the trailing
+///      matrix as one permutation, followed by one block update, and row
+///      interchanges to the left of the panels are deferred to the end.
+///      Each row then moves at most once per block of columns.
+///      Lookahead applies within a block, but not across blocks.
+///      Ignored for Target::Devices, which applies interchanges after
+///      each panel.
+///      pivot_batch >= 1. Default 1, interchanges applied after each panel.
+///
+///    - Option::CheckpointInterval:
+///      For MethodLU::PartialPiv with PivotBatch = 1, save a checkpoint of $A$ and the pivots
+///      every interval panels, to restart with getrf_restart() after a
+///      failure. The checkpoint is written asynchronously using MPI-IO,
+///      while the factorization continues; it needs host memory equal to
+///      the local part of $A$. interval >= 0. Default 0, no checkpoints.
+///
+///    - Option::CheckpointFile:
+///      Prefix of the checkpoint file names. Default "slate_checkpoint".
+///
 /// TODO: return value
 /// @retval 0 successful exit
 /// @retval >0 for return value = $i$, $U(i,i)$ is exactly zero. The
@@ -321,26 +482,14 @@ void getrf(
         getrf_nopiv( A, opts );
     }
     else if (method == MethodLU::PartialPiv) {
+        int64_t pivot_batch = get_option<int64_t>( opts, Option::PivotBatch, 1 );
         Target target = get_option( opts, Option::Target, Target::HostTask );
-
-        switch (target) {
-            case Target::Host:
-            case Target::HostTask:
-                impl::getrf<Target::HostTask>( A, pivots, opts );
-                break;
-
-            case Target::HostNest:
-                impl::getrf<Target::HostNest>( A, pivots, opts );
-                break;
-
-            case Target::HostBatch:
-                impl::getrf<Target::HostBatch>( A, pivots, opts );
-                break;
-
-            case Target::Devices:
-                impl::getrf<Target::Devices>( A, pivots, opts );
-                break;
-        }
+        // permuteRowsMap is host only; on devices it would move the
+        // trailing matrix to the host every block.
+        if (pivot_batch > 1 && target != Target::Devices)
+            impl::getrf_pivot_batch( A, pivots, pivot_batch, opts );
+        else
+            impl::getrf( A, pivots, 0, opts );
     }
     else {
         throw Exception( "unknown value for MethodLU" );
@@ -348,6 +497,45 @@ void getrf(
     // todo: return value for errors?
 }
 
+//------------------------------------------------------------------------------
+/// Restarts an LU factorization with partial pivoting from its last
+/// checkpoint, saved by getrf() with Option::CheckpointInterval.
+/// The factorization resumes from the last completed block column.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, a matrix with the same dimensions and tile size as the
+///     matrix passed to getrf(); its distribution may differ.
+///     Its values are ignored.
+///     On exit, the factors $L$ and $U$, as for getrf().
+///
+/// @param[out] pivots
+///     The pivot indices that define the permutation matrix $P$.
+///
+/// @param[in] opts
+///     Additional options, as for getrf().
+///     Option::CheckpointFile must match the one passed to getrf().
+///     If Option::CheckpointInterval is set, checkpoints continue to be saved.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrf_restart(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts )
+{
+    Method method = get_option( opts, Option::MethodLU, MethodLU::PartialPiv );
+    if (method != MethodLU::PartialPiv)
+        slate_not_implemented( "getrf_restart requires MethodLU::PartialPiv" );
+
+    int64_t k_start = internal::Checkpoint<scalar_t>::restore(
+        "getrf", opts, A, &pivots );
+    impl::getrf( A, pivots, k_start, opts );
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
@@ -370,4 +558,25 @@ void getrf< std::complex<double> >(
     Matrix< std::complex<double> >& A, Pivots& pivots,
     Options const& opts);
 
+//------------------------------------------------------------------------------
+template
+void getrf_restart<float>(
+    Matrix<float>& A, Pivots& pivots,
+    Options const& opts);
+
+template
+void getrf_restart<double>(
+    Matrix<double>& A, Pivots& pivots,
+    Options const& opts);
+
+template
+void getrf_restart< std::complex<float> >(
+    Matrix< std::complex<float> >& A, Pivots& pivots,
+    Options const& opts);
+
+template
+void getrf_restart< std::complex<double> >(
+    Matrix< std::complex<double> >& A, Pivots& pivots,
+    Options const& opts);
+
 } // namespace slate
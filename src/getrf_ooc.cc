@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_ooc.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel out-of-core LU factorization with partial
+/// pivoting, for matrices larger than the aggregate memory of the ranks.
+///
+/// Computes the factorization $A = P L U$ of a general m-by-n matrix $A$,
+/// where the local tiles of $A$ are held in a per-rank file
+/// (see Option::OutOfCoreFile) rather than in memory.
+///
+/// This is a left-looking algorithm over super-panels of block columns,
+/// sized so a super-panel fits in Option::OutOfCoreMemory. For each
+/// super-panel, the previously factored block columns are streamed
+/// through memory, applying their row swaps and updates to the
+/// super-panel, with the next block column read while the current one is
+/// applied. Then the super-panel is factored in memory with getrf, and
+/// written back while the next super-panel is read.
+///
+/// The row swaps of later panels are applied to the $L$ factor of earlier
+/// super-panels in a final pass, so the result matches getrf.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$, not transposed. Its local tiles are
+///     in the tile file, e.g., written by ooc_store; no tiles need to be in
+///     memory.
+///     On exit, the tile file holds the factors $L$ and $U$, and no tiles
+///     of $A$ are in memory.
+///
+/// @param[out] pivots
+///     The pivot indices that define the permutation matrix $P$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::OutOfCoreFile:
+///       Prefix of the tile file names, `<prefix>.<rank>`. Required.
+///     - Option::OutOfCoreMemory:
+///       Host memory per rank for tiles of A, in bytes. Default 0,
+///       giving super-panels of one block column.
+///     - Other options, e.g., Option::Target, are passed to getrf, trsm,
+///       and gemm, which do the computation on each super-panel.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrf_ooc(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts)
+{
+    // Constants
+    const scalar_t one = 1.0;
+
+    // Options
+    int64_t budget = get_option<int64_t>( opts, Option::OutOfCoreMemory, 0 );
+
+    internal::TileFile<scalar_t> file( A, opts );
+
+    int64_t A_mt = A.mt();
+    int64_t A_nt = A.nt();
+    int64_t min_mt_nt = std::min( A_mt, A_nt );
+    pivots.resize( min_mt_nt );
+
+    // First block column of each super-panel.
+    std::vector<int64_t> panels;
+
+    int64_t k1;
+    for (int64_t k0 = 0; k0 < A_nt; k0 = k1) {
+        k1 = k0 + file.panel_width( k0, 0, budget );
+        panels.push_back( k0 );
+
+        // Read super-panel A(0:mt-1, k0:k1-1).
+        file.read( 0, A_mt-1, k0, k1-1 ).get();
+
+        // Stream L(j:mt-1, j) for j = 0, ..., k0-1, reading the next
+        // block column while applying the current one.
+        int64_t j_end = std::min( k0, min_mt_nt );
+        std::future<void> next;
+        if (j_end > 0)
+            next = file.read( 0, A_mt-1, 0, 0 );
+        for (int64_t j = 0; j < j_end; ++j) {
+            next.get();
+            if (j+1 < j_end)
+                next = file.read( j+1, A_mt-1, j+1, j+1 );
+
+            // swap rows in A(j:mt-1, k0:k1-1)
+            internal::permuteRows<Target::HostTask>(
+                Direction::Forward, A.sub( j, A_mt-1, k0, k1-1 ),
+                pivots.at( j ), Layout::ColMajor );
+
+            // solve L(j, j) U(j, k0:k1-1) = A(j, k0:k1-1)
+            auto Ajj = A.sub( j, j, j, j );
+            auto Ljj = TriangularMatrix<scalar_t>( Uplo::Lower, Diag::Unit, Ajj );
+            auto Uj = A.sub( j, j, k0, k1-1 );
+            trsm( Side::Left, one, Ljj, Uj, opts );
+
+            // A(j+1:mt-1, k0:k1-1) -= L(j+1:mt-1, j) U(j, k0:k1-1)
+            if (j+1 < A_mt) {
+                auto Lij = A.sub( j+1, A_mt-1, j, j );
+                auto Ai = A.sub( j+1, A_mt-1, k0, k1-1 );
+                gemm( -one, Lij, Uj, one, Ai, opts );
+            }
+
+            file.release( j, A_mt-1, j, j );
+        }
+
+        // Factor the super-panel in memory. Its panels' pivots are
+        // relative to the same rows as the pivots of the full matrix.
+        if (k0 < A_mt) {
+            auto Apanel = A.sub( k0, A_mt-1, k0, k1-1 );
+            Pivots panel_pivots;
+            getrf( Apanel, panel_pivots, opts );
+            for (size_t k = 0; k < panel_pivots.size(); ++k)
+                pivots.at( k0 + k ) = std::move( panel_pivots[ k ] );
+        }
+
+        // Write back, overlapped with reading the next super-panel.
+        file.write( 0, A_mt-1, k0, k1-1 );
+    }
+
+    // Apply the row swaps of later panels to L of each super-panel.
+    panels.push_back( A_nt );
+    for (size_t s = 0; s+1 < panels.size(); ++s) {
+        int64_t k0 = panels[ s ];
+        k1 = panels[ s+1 ];
+        if (k1 >= min_mt_nt)
+            break;
+
+        file.read( k1, A_mt-1, k0, k1-1 ).get();
+        for (int64_t k = k1; k < min_mt_nt; ++k) {
+            // swap rows in A(k:mt-1, k0:k1-1)
+            internal::permuteRows<Target::HostTask>(
+                Direction::Forward, A.sub( k, A_mt-1, k0, k1-1 ),
+                pivots.at( k ), Layout::ColMajor );
+        }
+        file.write( k1, A_mt-1, k0, k1-1 );
+    }
+    file.flush();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrf_ooc<float>(
+    Matrix<float>& A, Pivots& pivots,
+    Options const& opts);
+
+template
+void getrf_ooc<double>(
+    Matrix<double>& A, Pivots& pivots,
+    Options const& opts);
+
+template
+void getrf_ooc< std::complex<float> >(
+    Matrix< std::complex<float> >& A, Pivots& pivots,
+    Options const& opts);
+
+template
+void getrf_ooc< std::complex<double> >(
+    Matrix< std::complex<double> >& A, Pivots& pivots,
+    Options const& opts);
+
+} // namespace slate
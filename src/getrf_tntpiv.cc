@@ -53,9 +53,14 @@ void getrf_tntpiv(
     //       ScaLAPACK
     Layout host_layout = Layout::ColMajor;
     Layout target_layout = Layout::ColMajor;
-    // GPU Devices use RowMajor for efficient row swapping.
-    if (target == Target::Devices)
-        target_layout = Layout::RowMajor;
+    // GPU Devices use RowMajor for efficient row swapping, unless
+    // Option::Layout requests ColMajor, e.g., to work directly on
+    // ScaLAPACK data without layout conversion and extra buffers.
+    if (target == Target::Devices) {
+        target_layout = get_option( opts, Option::Layout, Layout::RowMajor );
+        slate_assert( target_layout == Layout::RowMajor
+                      || target_layout == Layout::ColMajor );
+    }
 
     int64_t A_nt = A.nt();
     int64_t A_mt = A.mt();
@@ -393,6 +398,13 @@ void getrf_tntpiv(
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
 ///
+///     - Option::Layout:
+///       Tile layout used on GPU devices. Possible values:
+///       - RowMajor:  rows are contiguous for fast row swaps [default].
+///       - ColMajor:  no layout conversion. For a matrix from
+///         fromScaLAPACK, this avoids extended tile buffers and the
+///         conversion back to the ScaLAPACK layout at the end.
+///
 /// TODO: return value
 /// @retval 0 successful exit
 /// @retval >0 for return value = $i$, $U(i,i)$ is exactly zero. The
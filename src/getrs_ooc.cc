@@ -0,0 +1,146 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_ooc.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel out-of-core LU solve.
+///
+/// Solves a system of linear equations
+/// \[
+///     A X = B
+/// \]
+/// using the LU factorization $A = P L U$ computed by getrf_ooc, held in
+/// the per-rank tile file. Each block column of the factors is read once
+/// for the forward substitution and once for the backward substitution,
+/// with the next block column read while the current one is applied.
+/// $B$ is in memory.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The factors $L$ and $U$ from the factorization $A = P L U$
+///     computed by getrf_ooc, in the tile file. Not transposed.
+///     No tiles of $A$ are in memory on exit.
+///
+/// @param[in] pivots
+///     The pivot indices that define the permutation matrix $P$.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$.
+///     On exit, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::OutOfCoreFile:
+///       Prefix of the tile file names, `<prefix>.<rank>`. Required.
+///     - Other options, e.g., Option::Target, are passed to trsm and gemm.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrs_ooc(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    // Constants
+    const scalar_t one = 1.0;
+
+    assert(A.mt() == A.nt());
+    assert(B.mt() == A.mt());
+
+    internal::TileFile<scalar_t> file( A, opts );
+
+    int64_t A_nt = A.nt();
+    int64_t B_mt = B.mt();
+    int64_t B_nt = B.nt();
+
+    // Pivot the right hand side matrix.
+    for (int64_t k = 0; k < B_mt; ++k) {
+        // swap rows in B(k:mt-1, 0:nt-1)
+        internal::permuteRows<Target::HostTask>(
+            Direction::Forward, B.sub( k, B_mt-1, 0, B_nt-1 ),
+            pivots.at( k ), Layout::ColMajor );
+    }
+
+    // Forward substitution, Y = L^{-1} P B, with L(j:nt-1, j) for j = 0, ...
+    std::future<void> next = file.read( 0, A_nt-1, 0, 0 );
+    for (int64_t j = 0; j < A_nt; ++j) {
+        next.get();
+        if (j+1 < A_nt)
+            next = file.read( j+1, A_nt-1, j+1, j+1 );
+
+        auto Ajj = A.sub( j, j, j, j );
+        auto Ljj = TriangularMatrix<scalar_t>( Uplo::Lower, Diag::Unit, Ajj );
+        auto Bj = B.sub( j, j, 0, B_nt-1 );
+        trsm( Side::Left, one, Ljj, Bj, opts );
+
+        if (j+1 < A_nt) {
+            auto Lij = A.sub( j+1, A_nt-1, j, j );
+            auto Bi = B.sub( j+1, A_nt-1, 0, B_nt-1 );
+            gemm( -one, Lij, Bj, one, Bi, opts );
+        }
+
+        file.release( j, A_nt-1, j, j );
+    }
+
+    // Backward substitution, X = U^{-1} Y, with U(0:j, j) for j = nt-1, ...
+    next = file.read( 0, A_nt-1, A_nt-1, A_nt-1 );
+    for (int64_t j = A_nt-1; j >= 0; --j) {
+        next.get();
+        if (j > 0)
+            next = file.read( 0, j-1, j-1, j-1 );
+
+        auto Ajj = A.sub( j, j, j, j );
+        auto Ujj = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, Ajj );
+        auto Bj = B.sub( j, j, 0, B_nt-1 );
+        trsm( Side::Left, one, Ujj, Bj, opts );
+
+        if (j > 0) {
+            auto Uij = A.sub( 0, j-1, j, j );
+            auto Bi = B.sub( 0, j-1, 0, B_nt-1 );
+            gemm( -one, Uij, Bj, one, Bi, opts );
+        }
+
+        file.release( 0, j, j, j );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrs_ooc<float>(
+    Matrix<float>& A, Pivots& pivots,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+void getrs_ooc<double>(
+    Matrix<double>& A, Pivots& pivots,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+void getrs_ooc< std::complex<float> >(
+    Matrix< std::complex<float> >& A, Pivots& pivots,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+void getrs_ooc< std::complex<double> >(
+    Matrix< std::complex<double> >& A, Pivots& pivots,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
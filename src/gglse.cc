@@ -0,0 +1,320 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Returns a new m-by-n matrix, with local tiles allocated, on the same
+/// process grid and with the same tile size as A. Used to copy sub-blocks
+/// that do not start on a tile boundary into matrices that do.
+///
+/// @ingroup gglse
+///
+template <typename scalar_t>
+Matrix<scalar_t> gglse_workspace(
+    Matrix<scalar_t>& A, int64_t m, int64_t n )
+{
+    GridOrder grid_order;
+    int p, q, myrow, mycol;
+    A.gridinfo( &grid_order, &p, &q, &myrow, &mycol );
+    slate_assert( grid_order != GridOrder::Unknown );
+
+    int64_t nb = A.tileNb( 0 );
+    Matrix<scalar_t> W( m, n, nb, nb, grid_order, p, q, A.mpiComm() );
+    W.insertLocalTiles();
+    return W;
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel linear equality-constrained least squares (LSE).
+///
+/// Solves
+/// \[
+///     \min_x \| c - A x \|_2 \quad\text{subject to}\quad B x = d,
+/// \]
+/// where $A$ is m-by-n, $B$ is p-by-n, with $1 \le p \le n \le m + p$,
+/// $B$ has full row rank p, and $\begin{bmatrix} A \\ B \end{bmatrix}$
+/// has full column rank n. Then the solution is unique.
+/// Several right hand sides $c$, $d$ can be solved at once as columns of
+/// $C$ and $D$.
+///
+/// Uses the LQ factorization $B = [L \; 0] Z$. With $y = Z x$ and
+/// $A Z^H = [A_1 \; A_2]$, the constraint gives $y_1 = L^{-1} d$, and
+/// $y_2$ solves the least squares problem
+/// $\min \| (c - A_1 y_1) - A_2 y_2 \|$ by gels. Then $x = Z^H y$.
+/// LAPACK's xGGLSE instead uses the RQ factorization of $B$; this is the
+/// same method with the constrained components of $y$ first.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$.
+///     On exit, destroyed.
+///
+/// @param[in,out] B
+///     On entry, the p-by-n matrix $B$.
+///     On exit, the LQ factorization of $B$, as returned by gelqf.
+///
+/// @param[in,out] C
+///     On entry, the m-by-nrhs matrix $C$.
+///     On exit, destroyed.
+///
+/// @param[in,out] D
+///     On entry, the p-by-nrhs matrix $D$.
+///     On exit, destroyed.
+///
+/// @param[out] X
+///     The n-by-nrhs solution $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to gelqf,
+///     unmlq, trsm, gemm, and gels. Possible options:
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup gglse
+///
+template <typename scalar_t>
+void gglse(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& C,
+    Matrix<scalar_t>& D,
+    Matrix<scalar_t>& X,
+    Options const& opts)
+{
+    const scalar_t one = 1.0;
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t p = B.m();
+    int64_t nrhs = C.n();
+
+    slate_assert( A.op() == Op::NoTrans && B.op() == Op::NoTrans );
+    slate_assert( B.n() == n );
+    slate_assert( 1 <= p && p <= n && n <= m + p );
+    slate_assert( C.m() == m );
+    slate_assert( D.m() == p && D.n() == nrhs );
+    slate_assert( X.m() == n && X.n() == nrhs );
+
+    // B = [ L 0 ] Z; A = A Z^H = [ A1 A2 ].
+    TriangularFactors<scalar_t> TB;
+    gelqf( B, TB, opts );
+    unmlq( Side::Right, Op::ConjTrans, B, TB, A, opts );
+
+    // Y1 = L^{-1} D, stored in the first p rows of X.
+    auto B11 = B.slice( 0, p-1, 0, p-1 );
+    auto L = TriangularMatrix<scalar_t>( Uplo::Lower, Diag::NonUnit, B11 );
+    trsm( Side::Left, one, L, D, opts );
+    auto X1 = X.slice( 0, p-1, 0, nrhs-1 );
+    redistribute( D, X1, opts );
+
+    if (p < n) {
+        // C = C - A1 Y1.
+        auto A1 = A.slice( 0, m-1, 0, p-1 );
+        gemm( -one, A1, D, one, C, opts );
+
+        // Y2 = argmin || C - A2 Y2 ||, stored in the last n-p rows of X.
+        // A2 is copied so the QR factorization starts on a tile boundary.
+        auto A2 = A.slice( 0, m-1, p, n-1 );
+        auto A2_copy = impl::gglse_workspace( A, m, n-p );
+        redistribute( A2, A2_copy, opts );
+        gels( A2_copy, C, opts );
+
+        auto C1 = C.slice( 0, n-p-1, 0, nrhs-1 );
+        auto X2 = X.slice( p, n-1, 0, nrhs-1 );
+        redistribute( C1, X2, opts );
+    }
+
+    // X = Z^H Y.
+    unmlq( Side::Left, Op::ConjTrans, B, TB, X, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel general Gauss-Markov linear model (GLM).
+///
+/// Solves
+/// \[
+///     \min_{x, y} \| y \|_2 \quad\text{subject to}\quad d = A x + B y,
+/// \]
+/// where $A$ is n-by-m, $B$ is n-by-p, with $m \le n \le m + p$,
+/// $A$ has full column rank m, and $[A \; B]$ has full row rank n.
+/// Then the solution is unique.
+///
+/// This is the LSE problem
+/// \[
+///     \min \left\| [I \; 0] \begin{bmatrix} y \\ x \end{bmatrix} \right\|
+///     \quad\text{subject to}\quad
+///     [B \; A] \begin{bmatrix} y \\ x \end{bmatrix} = d,
+/// \]
+/// which is solved by gglse. This factors the n-by-(p + m) matrix
+/// $[B \; A]$ at once, rather than $A$ and $Q^H B$ separately as in
+/// LAPACK's xGGGLM, for a similar flop count.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-m matrix $A$. Not modified.
+///
+/// @param[in] B
+///     The n-by-p matrix $B$. Not modified.
+///
+/// @param[in,out] D
+///     On entry, the n-by-nrhs matrix $D$.
+///     On exit, destroyed.
+///
+/// @param[out] X
+///     The m-by-nrhs solution $X$.
+///
+/// @param[out] Y
+///     The p-by-nrhs solution $Y$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to gglse.
+///
+/// @ingroup gglse
+///
+template <typename scalar_t>
+void ggglm(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& D,
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& Y,
+    Options const& opts)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t n = A.m();
+    int64_t m = A.n();
+    int64_t p = B.n();
+    int64_t nrhs = D.n();
+
+    slate_assert( A.op() == Op::NoTrans && B.op() == Op::NoTrans );
+    slate_assert( B.m() == n );
+    slate_assert( m <= n && n <= m + p );
+    slate_assert( D.m() == n );
+    slate_assert( X.m() == m && X.n() == nrhs );
+    slate_assert( Y.m() == p && Y.n() == nrhs );
+
+    // Constraint [ B A ], objective [ I 0 ] with zero right hand side.
+    auto BA = impl::gglse_workspace( A, n, p + m );
+    auto BA_1 = BA.slice( 0, n-1, 0, p-1 );
+    auto BA_2 = BA.slice( 0, n-1, p, p+m-1 );
+    redistribute( B, BA_1, opts );
+    redistribute( A, BA_2, opts );
+
+    auto I0 = impl::gglse_workspace( A, p, p + m );
+    set( zero, one, I0, opts );
+
+    auto Z = impl::gglse_workspace( A, p, nrhs );
+    set( zero, Z, opts );
+
+    auto YX = impl::gglse_workspace( A, p + m, nrhs );
+    gglse( I0, BA, Z, D, YX, opts );
+
+    auto YX_1 = YX.slice( 0, p-1, 0, nrhs-1 );
+    auto YX_2 = YX.slice( p, p+m-1, 0, nrhs-1 );
+    redistribute( YX_1, Y, opts );
+    redistribute( YX_2, X, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gglse<float>(
+    Matrix<float>& A,
+    Matrix<float>& B,
+    Matrix<float>& C,
+    Matrix<float>& D,
+    Matrix<float>& X,
+    Options const& opts);
+
+template
+void gglse<double>(
+    Matrix<double>& A,
+    Matrix<double>& B,
+    Matrix<double>& C,
+    Matrix<double>& D,
+    Matrix<double>& X,
+    Options const& opts);
+
+template
+void gglse< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& C,
+    Matrix< std::complex<float> >& D,
+    Matrix< std::complex<float> >& X,
+    Options const& opts);
+
+template
+void gglse< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& C,
+    Matrix< std::complex<double> >& D,
+    Matrix< std::complex<double> >& X,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void ggglm<float>(
+    Matrix<float>& A,
+    Matrix<float>& B,
+    Matrix<float>& D,
+    Matrix<float>& X,
+    Matrix<float>& Y,
+    Options const& opts);
+
+template
+void ggglm<double>(
+    Matrix<double>& A,
+    Matrix<double>& B,
+    Matrix<double>& D,
+    Matrix<double>& X,
+    Matrix<double>& Y,
+    Options const& opts);
+
+template
+void ggglm< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& D,
+    Matrix< std::complex<float> >& X,
+    Matrix< std::complex<float> >& Y,
+    Options const& opts);
+
+template
+void ggglm< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& D,
+    Matrix< std::complex<double> >& X,
+    Matrix< std::complex<double> >& Y,
+    Options const& opts);
+
+} // namespace slate
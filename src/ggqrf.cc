@@ -0,0 +1,254 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel generalized QR factorization of an n-by-m matrix
+/// $A$ and an n-by-p matrix $B$:
+/// \[
+///     A = Q R,
+///     \quad
+///     B = Q T Z,
+/// \]
+/// where $Q$ (n-by-n) and $Z$ (p-by-p) are unitary, $R$ is upper
+/// trapezoidal, and $T$ is lower trapezoidal.
+/// Computed as the QR factorization $A = Q R$, followed by the LQ
+/// factorization $Q^H B = T Z$.
+///
+/// This differs from LAPACK's xGGQRF, which uses an RQ factorization of
+/// $Q^H B$ with upper trapezoidal $T$. With the LQ factorization the
+/// generalized QR factorization serves the same purpose, with the
+/// triangle of $T$ in its leading rather than trailing columns.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-m matrix $A$.
+///     On exit, the QR factorization of $A$, as returned by geqrf.
+///
+/// @param[out] TA
+///     Triangular matrices of the block reflectors of $Q$, as returned
+///     by geqrf.
+///
+/// @param[in,out] B
+///     On entry, the n-by-p matrix $B$.
+///     On exit, the LQ factorization of $Q^H B$, as returned by gelqf.
+///
+/// @param[out] TB
+///     Triangular matrices of the block reflectors of $Z$, as returned
+///     by gelqf.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to geqrf,
+///     unmqr, and gelqf.
+///
+/// @ingroup ggqrf_computational
+///
+template <typename scalar_t>
+void ggqrf(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& TA,
+    Matrix<scalar_t>& B, TriangularFactors<scalar_t>& TB,
+    Options const& opts)
+{
+    slate_assert( A.m() == B.m() );
+
+    geqrf( A, TA, opts );
+    unmqr( Side::Left, Op::ConjTrans, A, TA, B, opts );
+    gelqf( B, TB, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel generalized LQ factorization of an m-by-n matrix
+/// $A$ and a p-by-n matrix $B$:
+/// \[
+///     A = L Z,
+///     \quad
+///     B = Q T Z,
+/// \]
+/// where $Z$ (n-by-n) and $Q$ (p-by-p) are unitary, $L$ is lower
+/// trapezoidal, and $T$ is upper trapezoidal.
+/// Computed as the LQ factorization $A = L Z$, followed by the QR
+/// factorization $B Z^H = Q T$.
+///
+/// This is the counterpart of LAPACK's generalized RQ factorization,
+/// xGGRQF, with an LQ factorization of $A$ in place of the RQ
+/// factorization. It avoids the reversals of the matrices that gerqf and
+/// unmrq need; see ggrqf for the generalized RQ factorization itself.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$.
+///     On exit, the LQ factorization of $A$, as returned by gelqf.
+///
+/// @param[out] TA
+///     Triangular matrices of the block reflectors of $Z$, as returned
+///     by gelqf.
+///
+/// @param[in,out] B
+///     On entry, the p-by-n matrix $B$.
+///     On exit, the QR factorization of $B Z^H$, as returned by geqrf.
+///
+/// @param[out] TB
+///     Triangular matrices of the block reflectors of $Q$, as returned
+///     by geqrf.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to gelqf,
+///     unmlq, and geqrf.
+///
+/// @ingroup ggqrf_computational
+///
+template <typename scalar_t>
+void gglqf(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& TA,
+    Matrix<scalar_t>& B, TriangularFactors<scalar_t>& TB,
+    Options const& opts)
+{
+    slate_assert( A.n() == B.n() );
+
+    gelqf( A, TA, opts );
+    unmlq( Side::Right, Op::ConjTrans, A, TA, B, opts );
+    geqrf( B, TB, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel generalized RQ factorization of an m-by-n matrix
+/// $A$ and a p-by-n matrix $B$:
+/// \[
+///     A = R Q,
+///     \quad
+///     B = Z T Q,
+/// \]
+/// where $Q$ (n-by-n) and $Z$ (p-by-p) are unitary, and $R$ and $T$ are
+/// upper trapezoidal, as in LAPACK's xGGRQF.
+/// Computed as the RQ factorization $A = R Q$, followed by the QR
+/// factorization $B Q^H = Z T$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$.
+///     On exit, the RQ factorization of $A$, as returned by gerqf.
+///
+/// @param[out] TA
+///     Triangular matrices of the block reflectors of $Q$, as returned
+///     by gerqf.
+///
+/// @param[in,out] B
+///     On entry, the p-by-n matrix $B$.
+///     On exit, the QR factorization of $B Q^H$, as returned by geqrf.
+///
+/// @param[out] TB
+///     Triangular matrices of the block reflectors of $Z$, as returned
+///     by geqrf.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to gerqf,
+///     unmrq, and geqrf.
+///
+/// @ingroup ggqrf_computational
+///
+template <typename scalar_t>
+void ggrqf(
+    Matrix<scalar_t>& A, TriangularFactors<scalar_t>& TA,
+    Matrix<scalar_t>& B, TriangularFactors<scalar_t>& TB,
+    Options const& opts)
+{
+    slate_assert( A.n() == B.n() );
+
+    gerqf( A, TA, opts );
+    unmrq( Side::Right, Op::ConjTrans, A, TA, B, opts );
+    geqrf( B, TB, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ggqrf<float>(
+    Matrix<float>& A, TriangularFactors<float>& TA,
+    Matrix<float>& B, TriangularFactors<float>& TB,
+    Options const& opts);
+
+template
+void ggqrf<double>(
+    Matrix<double>& A, TriangularFactors<double>& TA,
+    Matrix<double>& B, TriangularFactors<double>& TB,
+    Options const& opts);
+
+template
+void ggqrf< std::complex<float> >(
+    Matrix< std::complex<float> >& A, TriangularFactors< std::complex<float> >& TA,
+    Matrix< std::complex<float> >& B, TriangularFactors< std::complex<float> >& TB,
+    Options const& opts);
+
+template
+void ggqrf< std::complex<double> >(
+    Matrix< std::complex<double> >& A, TriangularFactors< std::complex<double> >& TA,
+    Matrix< std::complex<double> >& B, TriangularFactors< std::complex<double> >& TB,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void gglqf<float>(
+    Matrix<float>& A, TriangularFactors<float>& TA,
+    Matrix<float>& B, TriangularFactors<float>& TB,
+    Options const& opts);
+
+template
+void gglqf<double>(
+    Matrix<double>& A, TriangularFactors<double>& TA,
+    Matrix<double>& B, TriangularFactors<double>& TB,
+    Options const& opts);
+
+template
+void gglqf< std::complex<float> >(
+    Matrix< std::complex<float> >& A, TriangularFactors< std::complex<float> >& TA,
+    Matrix< std::complex<float> >& B, TriangularFactors< std::complex<float> >& TB,
+    Options const& opts);
+
+template
+void gglqf< std::complex<double> >(
+    Matrix< std::complex<double> >& A, TriangularFactors< std::complex<double> >& TA,
+    Matrix< std::complex<double> >& B, TriangularFactors< std::complex<double> >& TB,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void ggrqf<float>(
+    Matrix<float>& A, TriangularFactors<float>& TA,
+    Matrix<float>& B, TriangularFactors<float>& TB,
+    Options const& opts);
+
+template
+void ggrqf<double>(
+    Matrix<double>& A, TriangularFactors<double>& TA,
+    Matrix<double>& B, TriangularFactors<double>& TB,
+    Options const& opts);
+
+template
+void ggrqf< std::complex<float> >(
+    Matrix< std::complex<float> >& A, TriangularFactors< std::complex<float> >& TA,
+    Matrix< std::complex<float> >& B, TriangularFactors< std::complex<float> >& TB,
+    Options const& opts);
+
+template
+void ggrqf< std::complex<double> >(
+    Matrix< std::complex<double> >& A, TriangularFactors< std::complex<double> >& TA,
+    Matrix< std::complex<double> >& B, TriangularFactors< std::complex<double> >& TB,
+    Options const& opts);
+
+} // namespace slate
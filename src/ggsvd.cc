@@ -0,0 +1,291 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+
+#include <cmath>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Computes the 2-norm of each column of A, on all ranks.
+///
+/// @ingroup ggsvd
+///
+template <typename scalar_t>
+void ggsvd_col_norms(
+    Matrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& norms)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    int64_t n = A.n();
+    std::vector<real_t> local_sumsq( n, 0.0 ), sumsq( n );
+    int64_t jj = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                auto Aij = A( i, j );
+                for (int64_t jt = 0; jt < Aij.nb(); ++jt) {
+                    for (int64_t it = 0; it < Aij.mb(); ++it) {
+                        real_t a = std::abs( Aij( it, jt ) );
+                        local_sumsq[ jj + jt ] += a * a;
+                    }
+                }
+            }
+        }
+        jj += A.tileNb( j );
+    }
+    slate_mpi_call(
+        MPI_Allreduce( local_sumsq.data(), sumsq.data(), n,
+                       mpi_type<real_t>::value, MPI_SUM, A.mpiComm() ) );
+
+    norms.resize( n );
+    for (int64_t j = 0; j < n; ++j)
+        norms[ j ] = std::sqrt( sumsq[ j ] );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel generalized singular value decomposition (GSVD)
+/// of an m-by-n matrix $A$ and a p-by-n matrix $B$, with $m + p \ge n$:
+/// \[
+///     A = U \Sigma_A X,
+///     \quad
+///     B = V \Sigma_B X,
+/// \]
+/// where $U$ (m-by-n) and $V$ (p-by-n) have orthonormal columns,
+/// $\Sigma_A = \text{diag}(\alpha)$, $\Sigma_B = \text{diag}(\beta)$ with
+/// $\alpha_i^2 + \beta_i^2 = 1$, and $X$ is n-by-n, nonsingular if
+/// $\begin{bmatrix} A \\ B \end{bmatrix}$ has full column rank.
+/// The generalized singular values are $\alpha_i / \beta_i$.
+///
+/// Uses the QR factorization
+/// $\begin{bmatrix} A \\ B \end{bmatrix}
+///  = \begin{bmatrix} Q_1 \\ Q_2 \end{bmatrix} R$,
+/// followed by the CS decomposition of $Q$: the eigenvectors $W$ of
+/// $Q_1^H Q_1$ simultaneously orthogonalize the columns of $Q_1 W$ and
+/// $Q_2 W$, whose norms are $\alpha$ and $\beta$. Then $X = W^H R$,
+/// up to the normalization of $\alpha$ and $\beta$.
+/// This avoids the Jacobi iteration of LAPACK's xGGSVD3 (xTGSJA).
+/// The Hermitian eigensolver is used in place of the SVD of $Q_1$,
+/// since gesvd does not compute singular vectors.
+///
+/// Forming $Q_1^H Q_1$ squares the condition of the CS decomposition, so
+/// columns of $U$ with $\alpha_i$ near $\sqrt{\epsilon}$ or smaller, and
+/// likewise columns of $V$ with small $\beta_i$, may lose orthogonality.
+/// Columns with $\alpha_i = 0$ or $\beta_i = 0$ are set to zero.
+/// The values are ordered by increasing $\alpha$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The m-by-n matrix $A$, m >= 1. Not modified.
+///
+/// @param[in] B
+///     The p-by-n matrix $B$, p >= 1. Not modified.
+///
+/// @param[out] alpha
+///     The vector $\alpha$ of length n.
+///
+/// @param[out] beta
+///     The vector $\beta$ of length n.
+///
+/// @param[out] U
+///     The m-by-n matrix $U$, with the same tile size as $A$.
+///
+/// @param[out] V
+///     The p-by-n matrix $V$, with the same tile size as $A$.
+///
+/// @param[out] X
+///     The n-by-n matrix $X$, with the same tile size as $A$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to geqrf,
+///     unmqr, gemm, and heev. Possible options:
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup ggsvd
+///
+template <typename scalar_t>
+void ggsvd(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    std::vector< blas::real_type<scalar_t> >& alpha,
+    std::vector< blas::real_type<scalar_t> >& beta,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& X,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t p = B.m();
+
+    slate_assert( A.op() == Op::NoTrans && B.op() == Op::NoTrans );
+    slate_assert( B.n() == n );
+    slate_assert( m >= 1 && p >= 1 && n <= m + p );
+    slate_assert( U.m() == m && U.n() == n );
+    slate_assert( V.m() == p && V.n() == n );
+    slate_assert( X.m() == n && X.n() == n );
+
+    GridOrder grid_order;
+    int grid_p, grid_q, myrow, mycol;
+    A.gridinfo( &grid_order, &grid_p, &grid_q, &myrow, &mycol );
+    slate_assert( grid_order != GridOrder::Unknown );
+    int64_t nb = A.tileNb( 0 );
+    MPI_Comm comm = A.mpiComm();
+
+    // [ A; B ] = Q R.
+    Matrix<scalar_t> AB( m + p, n, nb, nb, grid_order, grid_p, grid_q, comm );
+    AB.insertLocalTiles();
+    auto AB_1 = AB.slice( 0, m-1, 0, n-1 );
+    auto AB_2 = AB.slice( m, m+p-1, 0, n-1 );
+    redistribute( A, AB_1, opts );
+    redistribute( B, AB_2, opts );
+
+    TriangularFactors<scalar_t> T;
+    geqrf( AB, T, opts );
+
+    // Form the first n columns of Q, and split them into Q1 and Q2,
+    // each starting on a tile boundary.
+    auto Q = AB.emptyLike();
+    Q.insertLocalTiles();
+    set( zero, one, Q, opts );
+    unmqr( Side::Left, Op::NoTrans, AB, T, Q, opts );
+
+    auto Q1 = U.emptyLike();
+    Q1.insertLocalTiles();
+    auto Q2 = V.emptyLike();
+    Q2.insertLocalTiles();
+    auto Q_1 = Q.slice( 0, m-1, 0, n-1 );
+    auto Q_2 = Q.slice( m, m+p-1, 0, n-1 );
+    redistribute( Q_1, Q1, opts );
+    redistribute( Q_2, Q2, opts );
+    Q.clear();
+
+    // Q1^H Q1 = W Lambda W^H.
+    auto H = X.emptyLike();
+    H.insertLocalTiles();
+    auto Q1H = conj_transpose( Q1 );
+    gemm( one, Q1H, Q1, zero, H, opts );
+    HermitianMatrix<scalar_t> H_hermitian( Uplo::Lower, H );
+
+    std::vector<real_t> Lambda( n );
+    auto W = X.emptyLike();
+    W.insertLocalTiles();
+    heev( H_hermitian, Lambda, W, opts );
+    H.clear();
+
+    // U = Q1 W, V = Q2 W, with column norms a and b.
+    gemm( one, Q1, W, zero, U, opts );
+    gemm( one, Q2, W, zero, V, opts );
+    Q1.clear();
+    Q2.clear();
+
+    std::vector<real_t> a, b;
+    impl::ggsvd_col_norms( U, a );
+    impl::ggsvd_col_norms( V, b );
+
+    // Normalize (alpha, beta) to the unit circle, and columns of U, V
+    // to unit length. r = hypot( a, b ) is 1 up to rounding.
+    std::vector<real_t> R, a_inv( n ), b_inv( n ), r( n );
+    alpha.resize( n );
+    beta.resize( n );
+    for (int64_t j = 0; j < n; ++j) {
+        r[ j ] = std::hypot( a[ j ], b[ j ] );
+        alpha[ j ] = a[ j ] / r[ j ];
+        beta[ j ]  = b[ j ] / r[ j ];
+        a_inv[ j ] = a[ j ] > 0 ? 1 / a[ j ] : 0;
+        b_inv[ j ] = b[ j ] > 0 ? 1 / b[ j ] : 0;
+    }
+    scale_row_col( Equed::Col, R, a_inv, U, opts );
+    scale_row_col( Equed::Col, R, b_inv, V, opts );
+
+    // X = diag( r ) W^H R_AB = (W diag( r ))^H R_AB.
+    scale_row_col( Equed::Col, R, r, W, opts );
+
+    auto R_AB = AB.slice( 0, n-1, 0, n-1 );
+    auto R_upper = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, R_AB );
+    auto Rg = X.emptyLike();
+    Rg.insertLocalTiles();
+    set( zero, Rg, opts );
+    auto Rg_upper = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, Rg );
+    slate::copy( R_upper, Rg_upper, opts );
+
+    auto WH = conj_transpose( W );
+    gemm( one, WH, Rg, zero, X, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ggsvd<float>(
+    Matrix<float>& A,
+    Matrix<float>& B,
+    std::vector<float>& alpha,
+    std::vector<float>& beta,
+    Matrix<float>& U,
+    Matrix<float>& V,
+    Matrix<float>& X,
+    Options const& opts);
+
+template
+void ggsvd<double>(
+    Matrix<double>& A,
+    Matrix<double>& B,
+    std::vector<double>& alpha,
+    std::vector<double>& beta,
+    Matrix<double>& U,
+    Matrix<double>& V,
+    Matrix<double>& X,
+    Options const& opts);
+
+template
+void ggsvd< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    std::vector<float>& alpha,
+    std::vector<float>& beta,
+    Matrix< std::complex<float> >& U,
+    Matrix< std::complex<float> >& V,
+    Matrix< std::complex<float> >& X,
+    Options const& opts);
+
+template
+void ggsvd< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    std::vector<double>& alpha,
+    std::vector<double>& beta,
+    Matrix< std::complex<double> >& U,
+    Matrix< std::complex<double> >& V,
+    Matrix< std::complex<double> >& X,
+    Options const& opts);
+
+} // namespace slate
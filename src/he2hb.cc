@@ -40,7 +40,10 @@ void he2hb(
     const scalar_t one  = 1.0;
     const scalar_t half = 0.5;
     const real_t r_one  = 1.0;
+    const int priority_0 = 0;
     const int priority_1 = 1;
+    const int queue_0 = 0;
+    const int queue_1 = 1;
     const int batch_size_default = 0;
     const int num_queues = 10;
     // Assumes column major
@@ -104,12 +107,31 @@ void he2hb(
     slate::HermitianMatrix<scalar_t> W(
             Uplo::Lower, n, tileNb, tileRank, tileDevice, A.mpiComm() );
 
-    // Since W( 0, 0 ) is otherwise unused, store TVAVT there.
-    W.tileInsert( 0, 0 );
-    auto TVAVT = W.sub( 0, 0, 0, 0 );
-
     int my_rank = A.mpiRank();
 
+    // TVAVT( g, 0 ) holds T_g^H V_g^H W for the g-th panel rank, and
+    // TVAVT( g, 1 ) receives the transpose partner's partial sum of it.
+    // There are at most nprow panel ranks. Tiles are local, used on host.
+    std::function<int64_t (int64_t j)>
+        tileNb_TVAVT = [nb_A] (int64_t j) {
+            return nb_A;
+        };
+
+    std::function<int (std::tuple<int64_t, int64_t> ij)>
+        tileRank_TVAVT = [my_rank]( std::tuple<int64_t, int64_t> ij ) {
+            return my_rank;
+        };
+
+    std::function<int (std::tuple<int64_t, int64_t> ij)>
+        tileDevice_TVAVT = []( std::tuple<int64_t, int64_t> ij ) {
+            return 0;
+        };
+
+    slate::Matrix<scalar_t> TVAVT(
+            nprow*nb_A, 2*nb_A, tileNb_TVAVT, tileNb_TVAVT,
+            tileRank_TVAVT, tileDevice_TVAVT, A.mpiComm() );
+    TVAVT.insertLocalTiles();
+
     // tracks dependencies by block-column.
     std::vector< uint8_t > block_vector( nt + 2 );
     uint8_t* block = block_vector.data();
@@ -148,11 +170,91 @@ void he2hb(
                 }
             }
 
+            // Group the panel rows by panel rank, in the order of
+            // panel_ranks and first_indices. The local QR of each panel rank
+            // gives reflectors (V_g, T_g) on its own rows, so together they
+            // form one block reflector Q = I - V T V^H, with T = diag( T_g ).
+            int64_t A_panel_mt = A_panel.mt();
+            int64_t npanel = first_indices.size();
+            std::vector< std::vector<int64_t> > group_rows( npanel );
+            std::vector< std::vector<int64_t> > group_rows_sub( npanel );
+            std::vector<int64_t> panel_rows_sub;
+            {
+                int64_t g = 0;
+                for (int r : panel_ranks) {
+                    for (int64_t i = 0; i < A_panel_mt; ++i) {
+                        if (A_panel.tileRank( i, 0 ) == r) {
+                            group_rows[ g ].push_back( i+k+1 );
+                            group_rows_sub[ g ].push_back( i );
+                        }
+                    }
+                    ++g;
+                }
+                for (int64_t i = 0; i < A_panel_mt; ++i)
+                    panel_rows_sub.push_back( i );
+            }
+
+            // With W = A V T, the two-sided update is
+            //     A = Q^H A Q = A - V Y^H - Y V^H,
+            //     Y = W - 0.5 V (T^H V^H W).
+            // Row i of W has a block W_s( i ) = sum_{j in rows(s)} Aij Vj T_s
+            // for each panel rank s. On a square grid, rank (a, b) owns the
+            // tiles Aij with i in rows(g), j in rows(s), for the panel ranks
+            // g and s on process rows a and b. So it needs only the one block
+            // W_s( i ) for i in rows(g), and W_g( j ) for j in rows(s),
+            // which it stores as W( i, k ) and W( j, k ).
+            // W_s( i ) is the sum of a lower part, from the owner of
+            // A( i, rows(s) ), and an upper part, from the owner of
+            // A( rows(s), i ); these two ranks are transposes of each other.
+            // Find, for each group g, the panel rank s this rank pairs it
+            // with, the rows where this rank contributes to W, and where its
+            // transpose partner also contributes, so they must exchange.
+            std::vector<int> group_partner( npanel, -1 );
+            std::vector< std::vector<int64_t> > my_group_rows( npanel );
+            std::vector<int64_t> exchange_rows;
+            std::vector<int> exchange_ranks;
+            for (int64_t g = 0; g < npanel; ++g) {
+                int rank_lower = -1;
+                int rank_upper = -1;
+                int64_t s = 0;
+                for (; s < npanel; ++s) {
+                    rank_lower = A.tileRank( first_indices[ g ], first_indices[ s ] );
+                    rank_upper = A.tileRank( first_indices[ s ], first_indices[ g ] );
+                    if (rank_lower == my_rank || rank_upper == my_rank)
+                        break;
+                }
+                if (s == npanel)
+                    continue;
+
+                // Which of the pair contributes to some row of group g.
+                int64_t s_first = group_rows[ s ].front();
+                int64_t s_last  = group_rows[ s ].back();
+                bool lower_active = group_rows[ g ].back() >= s_first;
+                bool upper_active = group_rows[ g ].front() < s_last;
+                int neighbor = (rank_lower == my_rank ? rank_upper : rank_lower);
+                if (rank_lower != rank_upper && lower_active && upper_active)
+                    group_partner[ g ] = neighbor;
+
+                for (int64_t i : group_rows[ g ]) {
+                    bool has_lower = s_first <= i;
+                    bool has_upper = s_last > i;
+                    if ((rank_lower == my_rank && has_lower)
+                        || (rank_upper == my_rank && has_upper)) {
+                        my_group_rows[ g ].push_back( i );
+                        if (rank_lower != rank_upper && has_lower && has_upper) {
+                            exchange_rows.push_back( i );
+                            exchange_ranks.push_back( neighbor );
+                        }
+                    }
+                }
+            }
+
             if (k == 0) {
                 #pragma omp task depend( inout:alloc_workspace[ 0 ] )
                 {
                     if (target == Target::Devices) {
-                        A.allocateBatchArrays();
+                        // One queue for the lookahead column, one for the rest.
+                        A.allocateBatchArrays( batch_size_default, 2 );
                         A.reserveDeviceWorkspace();
                         W.allocateBatchArrays( batch_size_default, num_queues );
                         W.reserveDeviceWorkspace();
@@ -260,11 +362,14 @@ void he2hb(
                                  depend( inout:fetch_trailing[ 0 ] )
                 {
                     // todo: insert and set on device?
-                    // todo: do we need entire column, or subset? needs W[ my_rows + my_cols ].
-                    // todo: is this getting erased anywhere?
-                    for (int64_t i = k+1; i < nt; ++i) {
-                        W.tileInsert( i, k );
-                        W( i, k ).set( zero );
+                    // Insert only the rows of W( :, k ) this rank contributes
+                    // to or updates with; W( :, k ) is erased after the update
+                    // for panel k.
+                    for (int64_t g = 0; g < npanel; ++g) {
+                        for (int64_t i : my_group_rows[ g ]) {
+                            W.tileInsert( i, k );
+                            W( i, k ).set( zero );
+                        }
                     }
 
                     if (target == Target::Devices) {
@@ -325,26 +430,16 @@ void he2hb(
 
                 //----------------------------------------
                 // QR update trailing submatrix.
-                std::vector<int64_t> panel_rank_rows, panel_rank_rows_sub;
-                for (int panel_rank : panel_ranks) {
-                    // Find local row indices for panel_rank.
-                    panel_rank_rows.clear();
-                    panel_rank_rows_sub.clear();
-                    for (int64_t i = 0; i < A_panel.mt(); ++i) {
-                        if (A_panel.tileRank( i, 0 ) == panel_rank) {
-                            // global index
-                            panel_rank_rows.push_back( i+k+1 );
-                            // index relative to panel sub-matrix.
-                            panel_rank_rows_sub.push_back( i );
-                        }
-                    }
-                    int64_t i0 = panel_rank_rows[ 0 ];
-
-                    #pragma omp task depend( inout:block[ k ] )
-                    {
+                // The reflectors of all panel ranks are applied as one fused
+                // rank-2k update, with a single exchange of W and of
+                // T^H V^H W between transpose partners, followed by the
+                // hettmqr update for the triangle-triangle reductions.
+                #pragma omp task depend( inout:block[ k ] )
+                {
+                    // Save V0 and set upper(V0) to identity, to avoid trmm's.
+                    for (int64_t i0 : first_indices) {
                         if (A.tileExists( i0, k )) {
                             A.tileGetForWriting( i0, k, HostNum, layout_conv );
-                            // Save V0 and set upper(V0) to identity, to avoid trmm's.
                             Asave.tileInsert( i0, k );
                             auto Aik = A( i0, k );
                             tile::gecopy( std::move( Aik ), Asave( i0, k ) );
@@ -352,188 +447,225 @@ void he2hb(
                             Aik.set( zero, one );
                         }
                     }
+                }
 
-                    //--------------------
-                    // Update trailing submatrix.
-                    #pragma omp task depend( inout:block[ k ] ) \
-                                     depend( inout:block[ k+1 ] ) \
-                                     depend( inout:block[ nt-1 ] ) \
-                                     depend( inout:fetch_trailing[ 0 ] )
-                    {
-                        // Compute W = A V T.
-                        // 1a. Wi_part = sum_j Aij Vj, local partial sum,
-                        // for i = k+1, ..., nt-1 and j = panel_rank_rows.
-                        internal::he2hb_hemm<target>(
-                            A.sub( k+1, nt-1 ),
-                            A.sub( k+1, nt-1, k, k ),
+                //--------------------
+                // Compute Y, stored in W.
+                #pragma omp task depend( in:block[ k ] ) \
+                                 depend( in:block[ k+1 ] ) \
+                                 depend( in:block[ nt-1 ] ) \
+                                 depend( inout:fetch_trailing[ 0 ] )
+                {
+                    // 1a. Wi_part = sum_j Aij Vj, local partial sum,
+                    // for i = k+1, ..., nt-1 and all panel rows j.
+                    internal::he2hb_hemm<target>(
+                        A.sub( k+1, nt-1 ),
+                        A.sub( k+1, nt-1, k, k ),
+                        W.sub( k+1, nt-1, k, k ),
+                        panel_rows_sub );
+
+                    // 1b. Wi_part = Wi_part T_s. This is linear, so it is
+                    // applied to each part before the parts are summed.
+                    for (int64_t s = 0; s < npanel; ++s) {
+                        int64_t i0 = first_indices[ s ];
+                        internal::he2hb_trmm<target>(
+                            A.sub( k+1, nt-1 ), // Needed to get the rank
+                            Tlocal.sub( i0, i0, k, k ),
                             W.sub( k+1, nt-1, k, k ),
-                            panel_rank_rows_sub );
-
-                        // 1b. Wi = Wi_part1 + Wi_part2.
-                        // At most 2 ranks contribute to each Wi; if I am one,
-                        // exchange partial sum with neighbor and both ranks sum Wi.
-                        #pragma omp taskgroup
-                        for (int64_t i = k+1; i < nt-1; ++i) {
-                            #pragma omp task
+                            group_rows_sub[ s ] );
+                    }
+
+                    // 1c. TVAVT_g = V_g^H W_part over this rank's rows of g.
+                    // todo: on GPU
+                    #pragma omp taskgroup
+                    for (int64_t g = 0; g < npanel; ++g) {
+                        if (my_group_rows[ g ].size() > 0) {
+                            #pragma omp task shared( A, W, TVAVT, my_group_rows )
                             {
-                                int rank_lower = -1;
-                                int rank_upper = -1;
-                                for (int64_t j : panel_rank_rows) {
-                                    if (i >= j) { // lower
-                                        rank_lower = A.tileRank( i, j );
-                                    }
-                                    else { // upper
-                                        rank_upper = A.tileRank( j, i );
-                                    }
-                                }
-                                int neighbor = -1;
-                                if (rank_lower == my_rank)
-                                    neighbor = rank_upper;
-                                else if (rank_upper == my_rank)
-                                    neighbor = rank_lower;
-                                if (neighbor != -1 && neighbor != my_rank) {
-                                    Wtmp.tileInsert( i, k );
-                                    int tag_i = i;
-                                    int tag_i1 = i+1;
-                                    if (neighbor < my_rank) {
-                                        W.tileGetForWriting( i, k, HostNum,
-                                                             layout_conv );
-                                        W   .tileSend( i, k, neighbor, tag_i );
-                                        Wtmp.tileRecv( i, k, neighbor, layout, tag_i1 );
-                                    }
-                                    else {
-                                        W.tileGetForWriting( i, k, HostNum,
-                                                             layout_conv );
-                                        Wtmp.tileRecv( i, k, neighbor, layout, tag_i );
-                                        W   .tileSend( i, k, neighbor, tag_i1 );
-                                    }
-                                    auto Wtmp_ik = Wtmp( i, k );
-                                    auto W_ik = W( i, k );
-                                    blas::axpy( W_ik.nb()*W_ik.nb(),
-                                                one, Wtmp_ik.data(), 1,
-                                                        W_ik.data(), 1 );
-                                    Wtmp.tileErase( i, k );
+                                TVAVT.tileGetForWriting( g, 0, HostNum, layout_conv );
+                                TVAVT( g, 0 ).set( zero );
+                                for (int64_t i : my_group_rows[ g ]) {
+                                    A.tileGetForReading( i, k, HostNum, layout_conv );
+                                    W.tileGetForReading( i, k, HostNum, layout_conv );
+                                    tile::gemm( one, conj_transpose( A( i, k ) ),
+                                                     W( i, k ),
+                                                one, TVAVT( g, 0 ) );
                                 }
                             }
                         }
+                    }
 
-                        // 1c. Compute Wi = Wi T, for i = k+1, ..., nt-1.
-                        internal::he2hb_trmm<target>(
-                            A.sub( k+1, nt-1 ), // Needed to get the rank
-                            Tlocal.sub( i0, i0, k, k ),
-                            W.sub( k+1, nt-1, k, k ),
-                            panel_rank_rows_sub );
-
-                        if (A.tileIsLocal( i0, i0 )) {
-                            //--------------------
-                            // This rank has diagonal tiles to update.
-                            // Do 2-sided Hermitian update:
-                            // A = Q^H A Q
-                            //   = (I - V T^H V^H) A (I - V T V^H)
-                            //   = A - V Y^H - Y V^H
-                            // where
-                            // Y = A V T - 0.5 V (T^H V^H (A V T))
-                            //   = W - 0.5 V (T^H V^H W),
-                            // W = A V T from above.
-
-                            // 1d. TVAVT = V^H (A V T) = V^H W.
-                            // todo: potentially do gemm+reduce here (block inner-product)
-                            // todo: shouldn't need to set TVAVT = 0 since beta = 0.
-                            // todo: on GPU
-                            TVAVT.tileGetForWriting( 0, 0, HostNum, layout_conv );
-                            TVAVT( 0, 0 ).set( zero );
-                            internal::he2hb_gemm<target>(
-                                one,  conj_transpose( A.sub( k+1, nt-1, k, k ) ),
-                                      W.sub( k+1, nt-1, k, k ),
-                                zero, std::move( TVAVT ),
-                                panel_rank );
-
-                            // 1e. TVAVT = T^H (V^H A V T).
-                            auto T0     = Tlocal.sub( i0, i0, k, k );
-                            auto TVAVT0 = TVAVT;
-
-                            int64_t mb = T0.tileMb( 0 );
-                            int64_t nb = T0.tileNb( 0 );
-                            bool trapezoid = (mb < nb);
-                            if (trapezoid) {
-                                // first mb-by-mb part
-                                T0 = T0.slice( 0, mb-1, 0, mb-1 );
-                                // first mb-by-nb part
-                                TVAVT0 = TVAVT0.slice( 0, mb-1, 0, nb-1 );
-                            }
+                    // 1d. Wi = Wi_part1 + Wi_part2, and likewise TVAVT_g.
+                    // At most 2 ranks contribute to each Wi; if both do,
+                    // they exchange partial sums and both ranks sum Wi.
+                    // All exchanges for this panel are posted at once.
+                    // Directions differ in source rank, so tag i suffices
+                    // for Wi, and tag nt + g for TVAVT_g.
+                    std::vector<MPI_Request> requests;
+                    requests.reserve( 2*(exchange_rows.size() + npanel) );
+                    for (size_t idx = 0; idx < exchange_rows.size(); ++idx) {
+                        int64_t i = exchange_rows[ idx ];
+                        int neighbor = exchange_ranks[ idx ];
+                        requests.resize( requests.size() + 2 );
+                        MPI_Request* req = &requests[ requests.size()-2 ];
+                        int tag_i = i;
+                        Wtmp.tileInsert( i, k );
+                        Wtmp.tileIrecv( i, k, neighbor, layout, tag_i, &req[ 0 ] );
+                        W.tileGetForWriting( i, k, HostNum, layout_conv );
+                        W.tileIsend( i, k, neighbor, tag_i, &req[ 1 ] );
+                    }
+                    for (int64_t g = 0; g < npanel; ++g) {
+                        if (group_partner[ g ] >= 0) {
+                            requests.resize( requests.size() + 2 );
+                            MPI_Request* req = &requests[ requests.size()-2 ];
+                            int tag_g = nt + g;
+                            TVAVT.tileIrecv( g, 1, group_partner[ g ], layout,
+                                             tag_g, &req[ 0 ] );
+                            TVAVT.tileIsend( g, 0, group_partner[ g ], tag_g,
+                                             &req[ 1 ] );
+                        }
+                    }
+                    slate_mpi_call(
+                        MPI_Waitall( requests.size(), requests.data(),
+                                     MPI_STATUSES_IGNORE ) );
 
-                            // todo: move to GPU
-                            auto Tk0 = TriangularMatrix<scalar_t>(
-                                Uplo::Upper, Diag::NonUnit, T0 );
-                            Tk0.tileGetForReading( 0, 0, HostNum, layout_conv );
-                            TVAVT0.tileGetForWriting( 0, 0, HostNum, layout_conv );
-                            tile::trmm( Side::Left, Diag::NonUnit,
-                                        one, conj_transpose( Tk0( 0, 0 ) ),
-                                             std::move( TVAVT0( 0, 0 ) ) );
-
-                            // 1f. Y = W - 0.5 V TVAVT, with Y in W.
-                            internal::he2hb_gemm<target>(
-                                -half, A.sub( k+1, nt-1, k, k ),
-                                       std::move( TVAVT ),
-                                one,   W.sub( k+1, nt-1, k, k ),
-                                panel_rank );
-
-                            // 2. Update trailing matrix.
-                            // A = A - V Y^H - Y V^H, with Y in W.
-                            internal::her2k<target>(
-                                -one,  A.sub( k+1, nt-1, k, k ),
-                                       W.sub( k+1, nt-1, k, k ),
-                                r_one, A.sub( k+1, nt-1 ));
+                    #pragma omp taskgroup
+                    {
+                        for (int64_t i : exchange_rows) {
+                            #pragma omp task shared( W, Wtmp )
+                            {
+                                tile::add( one, Wtmp( i, k ), W( i, k ) );
+                                Wtmp.tileErase( i, k );
+                            }
                         }
-                        else { // off-diag
-                            //--------------------
-                            // This rank has only off-diagonal tiles to update (if any).
-                            // Update from left tiles in lower( A( panel_rank_rows, : ) ):
-                            // A = Q^H A
-                            //   = (I - V T^H V^H) A = A - V T^H V^H A
-                            //   = A - V W^H
-                            // Update from right tiles in lower( A( :, panel_rank_rows ) ):
-                            // A = A Q
-                            //   = A (I - V T V^H)   = A - A V T V^H
-                            //   = A - W V^H
-                            // where
-                            // W = A V T from above.
-
-                            // 2. Update trailing matrix.
-                            // A = A - V W^H or A - W V^H.
-                            internal::he2hb_her2k_offdiag_ranks<target>(
-                                -one, A.sub( k+1, nt-1, k, k ),
-                                      W.sub( k+1, nt-1, k, k ),
-                                one,  A.sub( k+1, nt-1 ),
-                                panel_rank_rows_sub );
+                        for (int64_t g = 0; g < npanel; ++g) {
+                            if (group_partner[ g ] >= 0) {
+                                #pragma omp task shared( TVAVT )
+                                {
+                                    tile::add( one, TVAVT( g, 1 ), TVAVT( g, 0 ) );
+                                }
+                            }
                         }
                     }
 
-                    // Restore V0.
-                    #pragma omp task depend( inout:block[ k ] )
+                    #pragma omp taskgroup
+                    for (int64_t g = 0; g < npanel; ++g) {
+                        if (my_group_rows[ g ].size() > 0) {
+                            #pragma omp task shared( A, W, Tlocal, TVAVT, my_group_rows )
+                            {
+                                // 1e. TVAVT_g = T_g^H (V_g^H A V T).
+                                int64_t i0 = first_indices[ g ];
+                                auto T0     = Tlocal.sub( i0, i0, k, k );
+                                auto TVAVT0 = TVAVT.sub( g, g, 0, 0 );
+
+                                int64_t mb = T0.tileMb( 0 );
+                                int64_t nb = T0.tileNb( 0 );
+                                bool trapezoid = (mb < nb);
+                                if (trapezoid) {
+                                    // first mb-by-mb part
+                                    T0 = T0.slice( 0, mb-1, 0, mb-1 );
+                                    // first mb-by-nb part
+                                    TVAVT0 = TVAVT0.slice( 0, mb-1, 0, nb-1 );
+                                }
+
+                                auto Tk0 = TriangularMatrix<scalar_t>(
+                                    Uplo::Upper, Diag::NonUnit, T0 );
+                                Tk0.tileGetForReading( 0, 0, HostNum, layout_conv );
+                                tile::trmm( Side::Left, Diag::NonUnit,
+                                            one, conj_transpose( Tk0( 0, 0 ) ),
+                                                 std::move( TVAVT0( 0, 0 ) ) );
+
+                                // 1f. Yi = Wi - 0.5 Vi TVAVT_g, with Y in W,
+                                // for this rank's rows i of group g.
+                                for (int64_t i : my_group_rows[ g ]) {
+                                    W.tileGetForWriting( i, k, HostNum, layout_conv );
+                                    tile::gemm( -half, A( i, k ), TVAVT( g, 0 ),
+                                                one,   W( i, k ) );
+                                }
+                            }
+                        }
+                    }
+                }
+
+                //--------------------
+                // 2. Update trailing matrix, A = A - V Y^H - Y V^H,
+                // for this rank's tiles. Each local Aij needs only Vi, Vj,
+                // which were broadcast along row i and col j, and Yi, Yj.
+                // Lookahead: update column k+1 first, at high priority,
+                // so the next panel's QR can overlap the rest of the update.
+                #pragma omp task depend( in:block[ k ] ) \
+                                 depend( inout:block[ k+1 ] ) \
+                                 priority( priority_1 )
+                {
+                    internal::her2k<target>(
+                        -one,  A.sub( k+1, k+1, k, k ),
+                               W.sub( k+1, k+1, k, k ),
+                        r_one, A.sub( k+1, k+1 ),
+                        priority_1, queue_1 );
+
+                    if (k+2 < nt) {
+                        internal::gemm<target>(
+                            -one, A.sub( k+2, nt-1, k, k ),
+                                  conj_transpose( W.sub( k+1, k+1, k, k ) ),
+                            one,  A.sub( k+2, nt-1, k+1, k+1 ),
+                            layout, priority_1, queue_1 );
+                        internal::gemm<target>(
+                            -one, W.sub( k+2, nt-1, k, k ),
+                                  conj_transpose( A.sub( k+1, k+1, k, k ) ),
+                            one,  A.sub( k+2, nt-1, k+1, k+1 ),
+                            layout, priority_1, queue_1 );
+                    }
+                }
+
+                if (k+2 < nt) {
+                    #pragma omp task depend( in:block[ k ] ) \
+                                     depend( inout:block[ nt-1 ] ) \
+                                     depend( inout:fetch_trailing[ 0 ] )
                     {
+                        internal::her2k<target>(
+                            -one,  A.sub( k+2, nt-1, k, k ),
+                                   W.sub( k+2, nt-1, k, k ),
+                            r_one, A.sub( k+2, nt-1 ),
+                            priority_0, queue_0 );
+                    }
+                }
+
+                // Restore V0, and release W( :, k ), so W holds only
+                // one block column at a time rather than growing to the
+                // size of A.
+                #pragma omp task depend( inout:block[ k ] )
+                {
+                    for (int64_t i0 : first_indices) {
                         if (A.tileExists( i0, k )) {
                             A.tileGetForWriting( i0, k, layout_conv );
                             tile::gecopy( Asave( i0, k ), A( i0, k ) );
                             Asave.tileErase( i0, k );
                         }
                     }
-                } // for panel_rank
+                    for (int64_t i = k+1; i < nt; ++i) {
+                        if (W.tileExists( i, k ))
+                            W.tileErase( i, k, AllDevices );
+                    }
+                }
 
                 //--------------------
                 // Update trailing matrix from triangle reductions.
-                #pragma omp task depend( in:block[ k ] ) \
-                                 depend( inout:block[ k+1 ] ) \
-                                 depend( inout:block[ nt-1 ] ) \
-                                 depend( inout:fetch_trailing[ 0 ] )
-                {
-                    // Do 2-sided Hermitian update:
-                    // 3. A = Q^H A Q
-                    internal::hettmqr<Target::HostTask>(
-                        Op::ConjTrans,
-                        std::move( A_panel ),
-                        std::move( Treduce_panel ),
-                        A.sub( k+1, nt-1 ) );
+                // With a single panel rank there are no reductions, and the
+                // next panel's QR needs to wait only for the lookahead column.
+                if (npanel > 1) {
+                    #pragma omp task depend( in:block[ k ] ) \
+                                     depend( inout:block[ k+1 ] ) \
+                                     depend( inout:block[ nt-1 ] ) \
+                                     depend( inout:fetch_trailing[ 0 ] )
+                    {
+                        // Do 2-sided Hermitian update:
+                        // 3. A = Q^H A Q
+                        internal::hettmqr<Target::HostTask>(
+                            Op::ConjTrans,
+                            std::move( A_panel ),
+                            std::move( Treduce_panel ),
+                            A.sub( k+1, nt-1 ) );
+                    }
                 }
 
                 // Unhold and release tiles in A_panel and Tlocal.
@@ -555,40 +687,30 @@ void he2hb(
                             }
                         }
 
-                        for (int panel_rank : panel_ranks) {
-                            // Find local row indices for panel_rank.
-                            panel_rank_rows.clear();
-                            for (int64_t i = 0; i < A_panel.mt(); ++i) {
-                                if (A_panel.tileRank( i, 0 ) == panel_rank) {
-                                    // global index
-                                    panel_rank_rows.push_back( i+k+1 );
-                                }
-                            }
-                            if (panel_rank_rows.size() > 0) {
-                                int64_t i0 = panel_rank_rows[ 0 ];
-                                for (int64_t i : panel_rank_rows) {
-                                    if (Tlocal.tileIsLocal( i, k )) {
-                                        //Tlocal.tileUpdateOrigin( i, k );
-
-                                        std::set<int> dev_set;
-                                        Tlocal.sub( i, i, k+1, nt-1 ).getLocalDevices( &dev_set );
-
-                                        for (auto device : dev_set) {
-                                            Tlocal.tileUnsetHold( i0, k, device );
-                                            Tlocal.tileRelease( i0, k, device );
-                                        }
+                        for (int64_t g = 0; g < npanel; ++g) {
+                            int64_t i0 = first_indices[ g ];
+                            for (int64_t i : group_rows[ g ]) {
+                                if (Tlocal.tileIsLocal( i, k )) {
+                                    //Tlocal.tileUpdateOrigin( i, k );
 
-                                        std::set<int> dev_set2;
-                                        Tlocal.sub( k+1, nt-1, i, i ).getLocalDevices( &dev_set );
+                                    std::set<int> dev_set;
+                                    Tlocal.sub( i, i, k+1, nt-1 ).getLocalDevices( &dev_set );
 
-                                        for (auto device : dev_set2) {
-                                            Tlocal.tileUnsetHold( i0, k, device );
-                                            Tlocal.tileRelease( i0, k, device );
-                                        }
+                                    for (auto device : dev_set) {
+                                        Tlocal.tileUnsetHold( i0, k, device );
+                                        Tlocal.tileRelease( i0, k, device );
+                                    }
+
+                                    std::set<int> dev_set2;
+                                    Tlocal.sub( k+1, nt-1, i, i ).getLocalDevices( &dev_set );
+
+                                    for (auto device : dev_set2) {
+                                        Tlocal.tileUnsetHold( i0, k, device );
+                                        Tlocal.tileRelease( i0, k, device );
                                     }
                                 }
                             }
-                        } // for panel_rank
+                        } // for g
                     } // task
                 } // if devices
             } // if (k < nt-1)
@@ -647,8 +769,11 @@ void he2hb(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
-///     Note a lookahead is not possible with he2hb due to dependencies from
-///     updating on both left and right sides.
+///     The next panel's column is updated first, so the next panel's QR
+///     overlaps the rest of the trailing update. When the panel spans
+///     several process rows, the triangle-triangle reduction update mixes
+///     the first row of each rank's panel on both sides, so the next QR
+///     also waits for that.
 ///
 /// @ingroup heev_computational
 ///
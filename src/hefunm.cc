@@ -0,0 +1,129 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel function of a Hermitian matrix.
+///
+/// Computes
+/// \[
+///     F = f(A) = Z f(\Lambda) Z^H,
+/// \]
+/// from the eigendecomposition $A = Z \Lambda Z^H$ computed by heev.
+/// For example, with a Hermitian matrix H and time t,
+/// the propagator $\exp(-i H t)$ is
+///
+///     slate::hefunm(
+///         [t]( double lambda ) {
+///             return std::exp( std::complex<double>( 0, -lambda * t ) );
+///         },
+///         H, F );
+///
+/// and the inverse square root of a positive definite S uses
+/// `1 / std::sqrt( lambda )`.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] f
+///     Scalar function applied to each (real) eigenvalue.
+///     Its type is not deduced, so a lambda can be passed directly.
+///     For real scalar_t, $F$ is real and symmetric; for complex scalar_t,
+///     $f$ may be complex, in which case $F$ is not Hermitian.
+///
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian matrix $A$.
+///     On exit, destroyed by heev.
+///
+/// @param[out] F
+///     The n-by-n matrix $f(A)$.
+///     Must have the same distribution as $A$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to heev
+///     and gemm. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup matfun
+///
+template <typename scalar_t>
+void hefunm(
+    typename std::common_type<
+        std::function< scalar_t (blas::real_type<scalar_t>) > >::type const& f,
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& F,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t n = A.n();
+    slate_assert( F.m() == n && F.n() == n );
+
+    std::vector<real_t> Lambda( n );
+    auto Z = F.emptyLike();
+    Z.insertLocalTiles();
+    heev( A, Lambda, Z, opts );
+
+    // W = Z f(Lambda); F = W Z^H.
+    std::vector<scalar_t> fLambda( n ), R;
+    for (int64_t i = 0; i < n; ++i)
+        fLambda[ i ] = f( Lambda[ i ] );
+
+    auto W = F.emptyLike();
+    W.insertLocalTiles();
+    slate::copy( Z, W, opts );
+    scale_row_col( Equed::Col, R, fLambda, W, opts );
+
+    auto ZH = conj_transpose( Z );
+    gemm( one, W, ZH, zero, F, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void hefunm<float>(
+    std::function< float (float) > const& f,
+    HermitianMatrix<float>& A,
+    Matrix<float>& F,
+    Options const& opts);
+
+template
+void hefunm<double>(
+    std::function< double (double) > const& f,
+    HermitianMatrix<double>& A,
+    Matrix<double>& F,
+    Options const& opts);
+
+template
+void hefunm< std::complex<float> >(
+    std::function< std::complex<float> (float) > const& f,
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& F,
+    Options const& opts);
+
+template
+void hefunm< std::complex<double> >(
+    std::function< std::complex<double> (double) > const& f,
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& F,
+    Options const& opts);
+
+} // namespace slate
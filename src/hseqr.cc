@@ -0,0 +1,978 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_schur.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Distributed Hessenberg matrix and workspaces for hseqr.
+/// All access to H is through windows gathered to and scattered from
+/// one rank, the O(n) diagonals, and gemm updates outside a window.
+///
+template <typename scalar_t>
+struct HseqrData {
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    Matrix<scalar_t> H;
+    Matrix<scalar_t> Z;     ///< empty if ! wantz
+    Matrix<scalar_t> U;     ///< orthogonal transform of a window
+    Matrix<scalar_t> W;     ///< copy of H outside a window
+    Matrix<scalar_t> WZ;    ///< copy of Z
+    std::vector<complex_t>& Lambda;
+    bool wantt;
+    bool wantz;
+    real_t ulp;
+    real_t smlnum;
+    Options const& opts;
+};
+
+//------------------------------------------------------------------------------
+/// Returns the rank that works on window H(i1:i2, i1:i2).
+template <typename scalar_t>
+int hseqr_root(HseqrData<scalar_t>& hd, int64_t i1, int64_t i2)
+{
+    auto Hw = hd.H.slice( i1, i2, i1, i2 );
+    return Hw.tileRank( 0, 0 );
+}
+
+//------------------------------------------------------------------------------
+/// Gathers (to_matrix = false) or scatters (to_matrix = true) the window
+/// H(i1:i2, i1:i2) and the m-by-m array data on root.
+template <typename scalar_t>
+void hseqr_window(
+    HseqrData<scalar_t>& hd, int64_t i1, int64_t i2,
+    std::vector<scalar_t>& data, int root, bool to_matrix)
+{
+    int64_t m = i2 - i1 + 1;
+    auto Hw = hd.H.slice( i1, i2, i1, i2 );
+    if (hd.H.mpiRank() == root)
+        data.resize( m*m );
+    internal::copy_block( Hw, data.data(), m, root, to_matrix );
+}
+
+//------------------------------------------------------------------------------
+/// Applies the transform U_data of window H(i1:i2, i1:i2), on root,
+/// outside the window: H(imin:i1-1, i1:i2) = H(imin:i1-1, i1:i2) U,
+/// H(i1:i2, i2+1:jmax) = U^H H(i1:i2, i2+1:jmax), and Z(:, i1:i2) = Z U.
+/// If the full Schur form is wanted, imin = 0 and jmax = n-1;
+/// otherwise, only the active block ktop:kbot is updated.
+template <typename scalar_t>
+void hseqr_apply(
+    HseqrData<scalar_t>& hd, int64_t i1, int64_t i2,
+    int64_t ktop, int64_t kbot,
+    std::vector<scalar_t>& U_data, int root)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t n = hd.H.n();
+    int64_t m = i2 - i1 + 1;
+    int64_t imin = hd.wantt ? 0   : ktop;
+    int64_t jmax = hd.wantt ? n-1 : kbot;
+
+    auto Uw = hd.U.slice( i1, i2, i1, i2 );
+    Uw.insertLocalTiles();
+    internal::copy_block( Uw, U_data.data(), m, root, true );
+
+    if (i1 > imin) {
+        auto H12 = hd.H.slice( imin, i1-1, i1, i2 );
+        auto W12 = hd.W.slice( imin, i1-1, i1, i2 );
+        W12.insertLocalTiles();
+        slate::copy( H12, W12, hd.opts );
+        slate::gemm( one, W12, Uw, zero, H12, hd.opts );
+    }
+    if (jmax > i2) {
+        auto H23 = hd.H.slice( i1, i2, i2+1, jmax );
+        auto W23 = hd.W.slice( i1, i2, i2+1, jmax );
+        W23.insertLocalTiles();
+        slate::copy( H23, W23, hd.opts );
+        auto UH = conj_transpose( Uw );
+        slate::gemm( one, UH, W23, zero, H23, hd.opts );
+    }
+    if (hd.wantz) {
+        int64_t nz = hd.Z.m();
+        auto Zw  = hd.Z.slice(  0, nz-1, i1, i2 );
+        auto WZw = hd.WZ.slice( 0, nz-1, i1, i2 );
+        WZw.insertLocalTiles();
+        slate::copy( Zw, WZw, hd.opts );
+        slate::gemm( one, WZw, Uw, zero, Zw, hd.opts );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Returns the diagonal d, subdiagonal sub, and superdiagonal sup of H on
+/// all ranks, with sub[ k ] = H(k, k-1) and sup[ k ] = H(k-1, k).
+template <typename scalar_t>
+void hseqr_diagonals(
+    HseqrData<scalar_t>& hd,
+    std::vector<scalar_t>& d,
+    std::vector<scalar_t>& sub,
+    std::vector<scalar_t>& sup)
+{
+    auto& H = hd.H;
+    int64_t n = H.n();
+
+    // Each entry has one owner, so the sum is exact.
+    std::vector<scalar_t> local( 3*n, 0.0 ), global( 3*n );
+    scalar_t* d_   = &local[ 0 ];
+    scalar_t* sub_ = &local[ n ];
+    scalar_t* sup_ = &local[ 2*n ];
+    int64_t ii = 0;
+    for (int64_t i = 0; i < H.mt(); ++i) {
+        int64_t mb = H.tileMb( i );
+        if (H.tileIsLocal( i, i )) {
+            H.tileGetForReading( i, i, LayoutConvert::ColMajor );
+            auto Hii = H( i, i );
+            for (int64_t r = 0; r < mb; ++r)
+                d_[ ii + r ] = Hii( r, r );
+            for (int64_t r = 1; r < mb; ++r) {
+                sub_[ ii + r ] = Hii( r, r-1 );
+                sup_[ ii + r ] = Hii( r-1, r );
+            }
+        }
+        if (i > 0 && H.tileIsLocal( i, i-1 )) {
+            H.tileGetForReading( i, i-1, LayoutConvert::ColMajor );
+            auto Hij = H( i, i-1 );
+            sub_[ ii ] = Hij( 0, Hij.nb()-1 );
+        }
+        if (i > 0 && H.tileIsLocal( i-1, i )) {
+            H.tileGetForReading( i-1, i, LayoutConvert::ColMajor );
+            auto Hij = H( i-1, i );
+            sup_[ ii ] = Hij( Hij.mb()-1, 0 );
+        }
+        ii += mb;
+    }
+    slate_mpi_call(
+        MPI_Allreduce( local.data(), global.data(), 3*n,
+                       mpi_type<scalar_t>::value, MPI_SUM, H.mpiComm() ) );
+
+    d.assign(   &global[ 0 ],   &global[ n ] );
+    sub.assign( &global[ n ],   &global[ 2*n ] );
+    sup.assign( &global[ 2*n ], &global[ 3*n ] );
+}
+
+//------------------------------------------------------------------------------
+/// Sets H(i, j) = value on its owner.
+template <typename scalar_t>
+void hseqr_set(HseqrData<scalar_t>& hd, int64_t i, int64_t j, scalar_t value)
+{
+    auto Hij = hd.H.slice( i, i, j, j );
+    if (Hij.tileIsLocal( 0, 0 )) {
+        Hij.tileGetForWriting( 0, 0, LayoutConvert::ColMajor );
+        Hij( 0, 0 ).at( 0, 0 ) = value;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Swaps diagonal blocks of the Schur form T to move block ifst to ilst,
+/// 0-based, updating Q. The real and complex LAPACK interfaces differ.
+template <typename real_t>
+void hseqr_trexc(
+    int64_t n, real_t* T, int64_t ldt, real_t* Q, int64_t ldq,
+    int64_t ifst, int64_t ilst)
+{
+    int64_t ifst_ = ifst + 1;
+    int64_t ilst_ = ilst + 1;
+    lapack::trexc( lapack::Job::Vec, n, T, ldt, Q, ldq, &ifst_, &ilst_ );
+}
+
+template <typename real_t>
+void hseqr_trexc(
+    int64_t n, std::complex<real_t>* T, int64_t ldt,
+    std::complex<real_t>* Q, int64_t ldq,
+    int64_t ifst, int64_t ilst)
+{
+    lapack::trexc( lapack::Job::Vec, n, T, ldt, Q, ldq, ifst + 1, ilst + 1 );
+}
+
+//------------------------------------------------------------------------------
+/// Eigenvalues w of the m-by-m upper quasi-triangular T, from its 1-by-1
+/// and 2-by-2 diagonal blocks; for a pair, positive imaginary part first.
+template <typename scalar_t>
+void hseqr_schur_eig(
+    int64_t m, scalar_t const* T, int64_t ldt,
+    std::complex< blas::real_type<scalar_t> >* w)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    for (int64_t k = 0; k < m; ++k) {
+        if (! is_complex<scalar_t>::value && k+1 < m
+            && T[ k+1 + k*ldt ] != scalar_t( 0 )) {
+            real_t a = std::real( T[ k   +  k   *ldt ] );
+            real_t b = std::real( T[ k   + (k+1)*ldt ] );
+            real_t c = std::real( T[ k+1 +  k   *ldt ] );
+            real_t e = std::real( T[ k+1 + (k+1)*ldt ] );
+            real_t p = (a - e) / 2;
+            complex_t disc = std::sqrt( complex_t( p*p + b*c ) );
+            w[ k   ] = (a + e) / 2 + disc;
+            w[ k+1 ] = (a + e) / 2 - disc;
+            if (std::imag( w[ k ] ) < 0)
+                std::swap( w[ k ], w[ k+1 ] );
+            ++k;
+        }
+        else {
+            w[ k ] = T[ k + k*ldt ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Returns x, or its real part for real types.
+template <typename scalar_t>
+scalar_t hseqr_scalar(std::complex< blas::real_type<scalar_t> > x)
+{
+    if constexpr (is_complex<scalar_t>::value)
+        return x;
+    else
+        return x.real();
+}
+
+//------------------------------------------------------------------------------
+/// Solves the active block H(ktop:kbot, ktop:kbot), gathered to one rank,
+/// by LAPACK hseqr. Returns LAPACK's info.
+template <typename scalar_t>
+int64_t hseqr_small(HseqrData<scalar_t>& hd, int64_t ktop, int64_t kbot)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    int64_t m = kbot - ktop + 1;
+    int root = hseqr_root( hd, ktop, kbot );
+    MPI_Comm comm = hd.H.mpiComm();
+    bool vec = hd.wantt || hd.wantz;
+
+    std::vector<scalar_t> W_data, U_data;
+    hseqr_window( hd, ktop, kbot, W_data, root, false );
+
+    int64_t info = 0;
+    if (hd.H.mpiRank() == root) {
+        U_data.resize( m*m );
+        info = lapack::hseqr(
+            vec ? lapack::JobSchur::Schur : lapack::JobSchur::Eigenvalues,
+            vec ? lapack::Job::Vec : lapack::Job::NoVec,
+            m, 1, m, W_data.data(), m, &hd.Lambda[ ktop ],
+            U_data.data(), m );
+    }
+    slate_mpi_call(
+        MPI_Bcast( &info, 1, MPI_INT64_T, root, comm ) );
+    slate_mpi_call(
+        MPI_Bcast( &hd.Lambda[ ktop ], m, mpi_type<complex_t>::value,
+                   root, comm ) );
+
+    if (info == 0 && vec) {
+        hseqr_window( hd, ktop, kbot, W_data, root, true );
+        hseqr_apply( hd, ktop, kbot, ktop, kbot, U_data, root );
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Aggressive early deflation, as in LAPACK laqr3, on the deflation window
+/// of size nw at the bottom of the active block ktop:kbot. The window is
+/// reduced to Schur form on one rank; converged eigenvalues are deflated,
+/// the rest are returned as shifts, and the window is returned to
+/// Hessenberg form.
+///
+/// @param[in] s
+///     Subdiagonal entry coupling the window to the rest of the block.
+///
+/// @param[out] ls
+///     Number of undeflated eigenvalues.
+///
+/// @param[out] ld
+///     Number of deflated eigenvalues.
+///
+/// @param[out] shifts
+///     The undeflated eigenvalues, for use as shifts.
+///
+template <typename scalar_t>
+void hseqr_aed(
+    HseqrData<scalar_t>& hd, int64_t ktop, int64_t kbot, int64_t nw,
+    scalar_t s, int64_t& ls, int64_t& ld,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& shifts)
+{
+    using blas::conj;
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t jw = std::min( nw, kbot - ktop + 1 );
+    int64_t kwtop = kbot - jw + 1;
+    if (kwtop == ktop)
+        s = zero;
+
+    int root = hseqr_root( hd, kwtop, kbot );
+    MPI_Comm comm = hd.H.mpiComm();
+
+    std::vector<scalar_t> T_data, V_data;
+    hseqr_window( hd, kwtop, kbot, T_data, root, false );
+
+    std::vector<complex_t> w( jw );
+    int64_t ns = 0;
+    scalar_t spike = zero;
+    if (hd.H.mpiRank() == root) {
+        V_data.resize( jw*jw );
+        scalar_t* T = T_data.data();
+        scalar_t* V = V_data.data();
+        real_t smlnum = hd.smlnum;
+        real_t ulp = hd.ulp;
+
+        // Schur form of the window; if it fails, the first infqr
+        // eigenvalues are not checked for deflation.
+        int64_t infqr = lapack::hseqr(
+            lapack::JobSchur::Schur, lapack::Job::Vec,
+            jw, 1, jw, T, jw, w.data(), V, jw );
+
+        // Deflation checks, from the bottom up; an undeflatable
+        // eigenvalue is moved to the top, position ilst.
+        ns = jw;
+        int64_t ilst = infqr;
+        while (ilst < ns) {
+            bool pair = ! is_complex<scalar_t>::value && ns > 1
+                        && T[ ns-1 + (ns-2)*jw ] != zero;
+            if (! pair) {
+                real_t foo = std::abs( T[ ns-1 + (ns-1)*jw ] );
+                if (foo == 0)
+                    foo = std::abs( s );
+                if (std::abs( s ) * std::abs( V[ (ns-1)*jw ] )
+                    <= std::max( smlnum, ulp*foo )) {
+                    ns -= 1;
+                }
+                else {
+                    hseqr_trexc( jw, T, jw, V, jw, ns-1, ilst );
+                    ilst += 1;
+                }
+            }
+            else {
+                real_t foo = std::abs( T[ ns-1 + (ns-1)*jw ] )
+                           + std::sqrt( std::abs( T[ ns-1 + (ns-2)*jw ] ) )
+                             * std::sqrt( std::abs( T[ ns-2 + (ns-1)*jw ] ) );
+                if (foo == 0)
+                    foo = std::abs( s );
+                if (std::max( std::abs( s*V[ (ns-1)*jw ] ),
+                              std::abs( s*V[ (ns-2)*jw ] ) )
+                    <= std::max( smlnum, ulp*foo )) {
+                    ns -= 2;
+                }
+                else {
+                    hseqr_trexc( jw, T, jw, V, jw, ns-1, ilst );
+                    ilst += 2;
+                }
+            }
+        }
+        if (ns == 0)
+            s = zero;
+        hseqr_schur_eig( jw, T, jw, w.data() );
+
+        // Clear below the subdiagonal, left by trexc and gehrd.
+        auto clear_lower = [&]() {
+            if (jw > 2) {
+                lapack::laset( lapack::MatrixType::Lower, jw-2, jw-2,
+                               zero, zero, &T[ 2 ], jw );
+            }
+        };
+
+        if (s != zero && ns > 1) {
+            // Reflector to zero the spike, then back to Hessenberg form.
+            std::vector<scalar_t> work( ns ), tau( jw ), V2( jw*jw );
+            for (int64_t j = 0; j < ns; ++j)
+                work[ j ] = conj( V[ j*jw ] );
+            scalar_t beta = work[ 0 ];
+            scalar_t tau1;
+            lapack::larfg( ns, &beta, &work[ 1 ], 1, &tau1 );
+            work[ 0 ] = one;
+            clear_lower();
+            lapack::larf( Side::Left, ns, jw, work.data(), 1, conj( tau1 ),
+                          T, jw );
+            lapack::larf( Side::Right, ns, ns, work.data(), 1, tau1, T, jw );
+            lapack::larf( Side::Right, jw, ns, work.data(), 1, tau1, V, jw );
+
+            lapack::gehrd( jw, 1, ns, T, jw, tau.data() );
+            std::vector<scalar_t> Q( T_data );
+            lapack::unghr( jw, 1, ns, Q.data(), jw, tau.data() );
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        jw, jw, jw, one, V, jw, Q.data(), jw, zero,
+                        V2.data(), jw );
+            V_data = V2;
+            V = V_data.data();
+        }
+        spike = s * conj( V[ 0 ] );
+        clear_lower();
+    }
+    slate_mpi_call(
+        MPI_Bcast( &ns, 1, MPI_INT64_T, root, comm ) );
+    slate_mpi_call(
+        MPI_Bcast( w.data(), jw, mpi_type<complex_t>::value, root, comm ) );
+    slate_mpi_call(
+        MPI_Bcast( &spike, 1, mpi_type<scalar_t>::value, root, comm ) );
+
+    hseqr_window( hd, kwtop, kbot, T_data, root, true );
+    if (kwtop > ktop)
+        hseqr_set( hd, kwtop, kwtop-1, spike );
+    hseqr_apply( hd, kwtop, kbot, ktop, kbot, V_data, root );
+
+    ls = ns;
+    ld = jw - ns;
+    for (int64_t j = ns; j < jw; ++j)
+        hd.Lambda[ kwtop + j ] = w[ j ];
+    shifts.assign( w.begin(), w.begin() + ns );
+}
+
+//------------------------------------------------------------------------------
+/// First column of (H - s1 I) (H - s2 I), scaled, from the leading 3-by-3
+/// block of h, as in LAPACK laqr1. For real types, s1 and s2 are real or
+/// a conjugate pair, so the result is real.
+template <typename scalar_t>
+void hseqr_shift_vector(
+    scalar_t const* h, int64_t ldh,
+    std::complex< blas::real_type<scalar_t> > s1,
+    std::complex< blas::real_type<scalar_t> > s2,
+    scalar_t* v)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    complex_t h00 = h[ 0 ], h10 = h[ 1 ];
+    complex_t h01 = h[ ldh ], h11 = h[ 1 + ldh ], h21 = h[ 2 + ldh ];
+    real_t scale = blas::cabs1( h00 - s2 ) + blas::cabs1( h10 );
+    if (scale == 0) {
+        v[ 0 ] = v[ 1 ] = v[ 2 ] = 0;
+        return;
+    }
+    complex_t h10s = h10 / scale;
+    v[ 0 ] = hseqr_scalar<scalar_t>(
+        (h00 - s1) * ((h00 - s2) / scale) + h01 * h10s );
+    v[ 1 ] = hseqr_scalar<scalar_t>( h10s * (h00 + h11 - s1 - s2) );
+    v[ 2 ] = hseqr_scalar<scalar_t>( h10s * h21 );
+}
+
+//------------------------------------------------------------------------------
+/// Multishift QR sweep over the active block ktop:kbot, chasing a chain of
+/// shifts.size()/2 bulges of two shifts each. The chain is chased in
+/// windows gathered to one rank; the accumulated transform of each window
+/// is applied outside the window by gemm.
+template <typename scalar_t>
+void hseqr_sweep(
+    HseqrData<scalar_t>& hd, int64_t ktop, int64_t kbot,
+    std::vector< std::complex< blas::real_type<scalar_t> > > const& shifts)
+{
+    using blas::conj;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t nbmps = shifts.size() / 2;
+    int64_t nh = kbot - ktop + 1;
+    int64_t len = std::min( nh, 8*nbmps + 8 );
+
+    // pos[ b ] is the column of bulge b; it starts outside the block.
+    std::vector<int64_t> pos( nbmps, ktop - 1 );
+    while (pos[ nbmps-1 ] < kbot - 1) {
+        int64_t i1 = std::max( ktop, pos[ nbmps-1 ] );
+        int64_t i2 = std::min( kbot, i1 + len - 1 );
+        int64_t m = i2 - i1 + 1;
+        int root = hseqr_root( hd, i1, i2 );
+        bool is_root = (hd.H.mpiRank() == root);
+
+        std::vector<scalar_t> W_data, U_data;
+        hseqr_window( hd, i1, i2, W_data, root, false );
+        if (is_root) {
+            U_data.assign( m*m, zero );
+            for (int64_t i = 0; i < m; ++i)
+                U_data[ i + i*m ] = one;
+        }
+        auto w = [&]( int64_t i, int64_t j ) -> scalar_t& {
+            return W_data[ (i - i1) + (j - i1)*m ];
+        };
+
+        // Move each bulge as far as it stays in the window and 4 rows
+        // behind the bulge ahead of it. Positions are updated on all
+        // ranks; the window is updated on root.
+        for (int64_t b = 0; b < nbmps; ++b) {
+            while (true) {
+                int64_t k = pos[ b ];
+                if (k >= kbot - 1)
+                    break;
+                if (b > 0 && pos[ b-1 ] < kbot - 1 && k + 4 > pos[ b-1 ])
+                    break;
+                if (std::min( k + 4, kbot ) > i2)
+                    break;
+
+                if (is_root) {
+                    int64_t nr;
+                    scalar_t v[ 3 ], tau, beta;
+                    if (k == ktop - 1) {
+                        // Introduce the bulge.
+                        nr = 3;
+                        hseqr_shift_vector( &w( ktop, ktop ), m,
+                                            shifts[ 2*b ], shifts[ 2*b+1 ], v );
+                        beta = v[ 0 ];
+                        lapack::larfg( nr, &beta, &v[ 1 ], 1, &tau );
+                    }
+                    else {
+                        // Chase the bulge one column.
+                        nr = std::min( int64_t( 3 ), kbot - k );
+                        for (int64_t r = 0; r < nr; ++r)
+                            v[ r ] = w( k+1+r, k );
+                        beta = v[ 0 ];
+                        lapack::larfg( nr, &beta, &v[ 1 ], 1, &tau );
+                        w( k+1, k ) = beta;
+                        for (int64_t r = 1; r < nr; ++r)
+                            w( k+1+r, k ) = zero;
+                    }
+                    v[ 0 ] = one;
+                    int64_t r0 = k + 1;
+                    int64_t c1 = std::max( k + 1, i1 );
+                    int64_t rb = std::min( k + 4, kbot );
+                    lapack::larf( Side::Left, nr, i2 - c1 + 1, v, 1,
+                                  conj( tau ), &w( r0, c1 ), m );
+                    lapack::larf( Side::Right, rb - i1 + 1, nr, v, 1,
+                                  tau, &w( i1, r0 ), m );
+                    lapack::larf( Side::Right, m, nr, v, 1,
+                                  tau, &U_data[ (r0 - i1)*m ], m );
+                }
+                pos[ b ] = k + 1;
+            }
+        }
+        hseqr_window( hd, i1, i2, W_data, root, true );
+        hseqr_apply( hd, i1, i2, ktop, kbot, U_data, root );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Number of shifts for an active block of size nh, as in LAPACK iparmq.
+inline int64_t hseqr_num_shifts(int64_t nh)
+{
+    int64_t ns = 2;
+    if (nh >= 30)
+        ns = 4;
+    if (nh >= 60)
+        ns = 10;
+    if (nh >= 150) {
+        int64_t log2_nh = std::lround( std::log( double( nh ) ) / std::log( 2.0 ) );
+        ns = std::max( int64_t( 10 ), nh / log2_nh );
+    }
+    if (nh >= 590)
+        ns = 64;
+    if (nh >= 3000)
+        ns = 128;
+    if (nh >= 6000)
+        ns = 256;
+    return std::max( int64_t( 2 ), ns - ns % 2 );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed multishift Hessenberg QR with aggressive early deflation,
+/// following LAPACK laqr0. Returns 0, or i > 0 if eigenvalues 0:i-1
+/// failed to converge.
+///
+/// @ingroup geev_impl
+///
+template <typename scalar_t>
+int64_t hseqr(HseqrData<scalar_t>& hd)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    // Parameters of LAPACK laqr0 and iparmq.
+    const int64_t nmin   = 75;
+    const int64_t nibble = 14;
+    const int64_t kexnw  = 5;
+    const int64_t kexsh  = 6;
+    const real_t  wilk1  = 0.75;
+
+    int64_t n = hd.H.n();
+    hd.Lambda.assign( n, complex_t( 0 ) );
+    if (n == 0)
+        return 0;
+    if (n <= nmin)
+        return hseqr_small( hd, 0, n-1 );
+
+    int64_t nsr = hseqr_num_shifts( n );
+    nsr = std::min( nsr, std::max( int64_t( 2 ), (n - 3) / 6 ) );
+    nsr = std::max( int64_t( 2 ), nsr - nsr % 2 );
+    int64_t nwr = (n <= 500) ? nsr : 3*nsr/2;
+    nwr = std::max( int64_t( 2 ), std::min( nwr, (n - 1) / 3 ) );
+    int64_t nsmax = std::min( (n - 3) / 6, int64_t( 256 ) );
+    nsmax = std::max( int64_t( 2 ), nsmax - nsmax % 2 );
+    int64_t nwmax = std::min( (n - 1) / 3, int64_t( 384 ) );
+
+    real_t ulp = hd.ulp;
+    real_t smlnum = hd.smlnum;
+    int64_t itmax = 30 * std::max( int64_t( 10 ), n );
+    int64_t kbot = n - 1;
+    int64_t ndfl = 1;
+    int64_t nw = nwr;
+    std::vector<scalar_t> d, sub, sup;
+    for (int64_t it = 0; kbot >= 0; ++it) {
+        if (it >= itmax)
+            return kbot + 1;
+
+        // Set negligible subdiagonals to zero (Ahues and Tisseur).
+        hseqr_diagonals( hd, d, sub, sup );
+        for (int64_t k = kbot; k > 0; --k) {
+            if (sub[ k ] == scalar_t( 0 ))
+                continue;
+            real_t tst = blas::cabs1( d[ k-1 ] ) + blas::cabs1( d[ k ] );
+            if (tst == 0) {
+                if (k >= 2)
+                    tst += std::abs( std::real( sub[ k-1 ] ) );
+                if (k + 1 <= kbot)
+                    tst += std::abs( std::real( sub[ k+1 ] ) );
+            }
+            if (blas::cabs1( sub[ k ] ) <= ulp*tst) {
+                real_t ab = std::max( blas::cabs1( sub[ k ] ),
+                                      blas::cabs1( sup[ k ] ) );
+                real_t ba = std::min( blas::cabs1( sub[ k ] ),
+                                      blas::cabs1( sup[ k ] ) );
+                real_t aa = std::max( blas::cabs1( d[ k ] ),
+                                      blas::cabs1( d[ k-1 ] - d[ k ] ) );
+                real_t bb = std::min( blas::cabs1( d[ k ] ),
+                                      blas::cabs1( d[ k-1 ] - d[ k ] ) );
+                real_t s = aa + ab;
+                if (ba*(ab / s) <= std::max( smlnum, ulp*(bb*(aa / s)) )) {
+                    hseqr_set( hd, k, k-1, scalar_t( 0 ) );
+                    sub[ k ] = 0;
+                }
+            }
+        }
+
+        // Active block ktop:kbot.
+        int64_t ktop = kbot;
+        while (ktop > 0 && sub[ ktop ] != scalar_t( 0 ))
+            --ktop;
+        int64_t nh = kbot - ktop + 1;
+        if (nh <= nmin) {
+            int64_t info = hseqr_small( hd, ktop, kbot );
+            if (info != 0)
+                return ktop + info;
+            kbot = ktop - 1;
+            ndfl = 1;
+            continue;
+        }
+
+        // Deflation window size; grows if deflation stalls.
+        int64_t nwupbd = std::min( nh, nwmax );
+        if (ndfl < kexnw)
+            nw = std::min( nwupbd, nwr );
+        else
+            nw = std::min( nwupbd, 2*nw );
+        if (nw < nwmax) {
+            if (nw >= nh - 1) {
+                nw = nh;
+            }
+            else {
+                int64_t kwtop = kbot - nw + 1;
+                if (blas::cabs1( sub[ kwtop ] ) > blas::cabs1( sub[ kwtop-1 ] ))
+                    ++nw;
+            }
+        }
+
+        int64_t ls, ld;
+        std::vector<complex_t> shifts;
+        int64_t kwtop = kbot - std::min( nw, nh ) + 1;
+        hseqr_aed( hd, ktop, kbot, nw, sub[ kwtop ], ls, ld, shifts );
+        kbot -= ld;
+
+        // Sweep unless AED deflated enough.
+        if (ld == 0
+            || (100*ld <= nw*nibble
+                && kbot - ktop + 1 > std::min( nmin, nwmax ))) {
+            int64_t ns = std::min( std::min( nsmax, nsr ),
+                                   std::max( int64_t( 2 ), kbot - ktop ) );
+            ns -= ns % 2;
+            if (ndfl % kexsh == 0) {
+                // Exceptional shifts.
+                hseqr_diagonals( hd, d, sub, sup );
+                shifts.assign( ns, complex_t( 0 ) );
+                for (int64_t i = 0; i < ns; i += 2) {
+                    int64_t k = std::max( ktop + 1, kbot - i );
+                    complex_t x = complex_t( d[ k ] )
+                                  + wilk1 * blas::cabs1( sub[ k ] );
+                    shifts[ i ] = x;
+                    shifts[ i+1 ] = x;
+                }
+            }
+            else {
+                if (ls <= ns / 2) {
+                    // Too few shifts from AED; use eigenvalues of the
+                    // bottom ns-by-ns block, or of its bottom 2-by-2 block.
+                    int64_t ks = kbot - ns + 1;
+                    int root = hseqr_root( hd, ks, kbot );
+                    std::vector<scalar_t> B_data, dummy( 1 );
+                    hseqr_window( hd, ks, kbot, B_data, root, false );
+                    shifts.assign( ns, complex_t( 0 ) );
+                    if (hd.H.mpiRank() == root) {
+                        scalar_t* b2 = &B_data[ ns-2 + (ns-2)*ns ];
+                        complex_t a = b2[ 0 ], b = b2[ ns ];
+                        complex_t c = b2[ 1 ], e = b2[ 1 + ns ];
+                        int64_t info = lapack::hseqr(
+                            lapack::JobSchur::Eigenvalues, lapack::Job::NoVec,
+                            ns, 1, ns, B_data.data(), ns, shifts.data(),
+                            dummy.data(), 1 );
+                        if (info != 0) {
+                            complex_t p = (a - e) / real_t( 2 );
+                            complex_t disc = std::sqrt( p*p + b*c );
+                            for (int64_t i = 0; i < ns; i += 2) {
+                                shifts[ i ]   = (a + e) / real_t( 2 ) + disc;
+                                shifts[ i+1 ] = (a + e) / real_t( 2 ) - disc;
+                            }
+                        }
+                    }
+                    slate_mpi_call(
+                        MPI_Bcast( shifts.data(), ns,
+                                   mpi_type<complex_t>::value,
+                                   root, hd.H.mpiComm() ) );
+                }
+                else if (int64_t( shifts.size() ) > ns) {
+                    shifts.erase( shifts.begin(), shifts.end() - ns );
+                }
+
+                // Sort by decreasing magnitude; for real types, keep
+                // conjugate pairs together and pair up the real shifts.
+                std::stable_sort(
+                    shifts.begin(), shifts.end(),
+                    [](complex_t const& a, complex_t const& b) {
+                        return blas::cabs1( a ) > blas::cabs1( b );
+                    } );
+                if (! is_complex<scalar_t>::value) {
+                    std::vector<complex_t> pairs, reals;
+                    for (auto const& x : shifts) {
+                        if (std::imag( x ) > 0) {
+                            pairs.push_back( x );
+                            pairs.push_back( std::conj( x ) );
+                        }
+                        else if (std::imag( x ) == 0) {
+                            reals.push_back( x );
+                        }
+                    }
+                    if (reals.size() % 2 != 0)
+                        reals.pop_back();
+                    shifts = pairs;
+                    shifts.insert( shifts.end(), reals.begin(), reals.end() );
+                }
+                ns = shifts.size() - shifts.size() % 2;
+                shifts.resize( ns );
+                if (ns == 2 && std::imag( shifts[ 0 ] ) == 0) {
+                    // Two real shifts: use the one closer to H(kbot, kbot)
+                    // twice.
+                    hseqr_diagonals( hd, d, sub, sup );
+                    complex_t hk = d[ kbot ];
+                    complex_t x = std::abs( shifts[ 0 ] - hk )
+                                  < std::abs( shifts[ 1 ] - hk )
+                                ? shifts[ 0 ] : shifts[ 1 ];
+                    shifts[ 0 ] = x;
+                    shifts[ 1 ] = x;
+                }
+            }
+            if (ns >= 2)
+                hseqr_sweep( hd, ktop, kbot, shifts );
+        }
+        ndfl = (ld > 0) ? 1 : ndfl + 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Sets up the workspaces and runs hseqr; throws if it fails to converge.
+///
+/// @ingroup geev_impl
+///
+template <typename scalar_t>
+void hseqr(
+    Matrix<scalar_t>& H,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& Z,
+    bool wantt,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    slate_assert( H.op() == Op::NoTrans );
+    slate_assert( H.m() == H.n() );
+
+    int64_t n = H.n();
+    bool wantz = (Z.mt() > 0);
+    if (wantz) {
+        slate_assert( Z.op() == Op::NoTrans );
+        slate_assert( Z.n() == n );
+    }
+
+    real_t ulp = std::numeric_limits<real_t>::epsilon();
+    real_t safe_min = std::numeric_limits<real_t>::min();
+    HseqrData<scalar_t> hd = {
+        H, Z, H.emptyLike(), H.emptyLike(),
+        wantz ? Z.emptyLike() : Matrix<scalar_t>(),
+        Lambda, wantt, wantz, ulp, safe_min * (real_t( n ) / ulp), opts
+    };
+
+    int64_t info = hseqr( hd );
+
+    H.tileUpdateAllOrigin();
+    H.releaseWorkspace();
+    if (wantz) {
+        Z.tileUpdateAllOrigin();
+        Z.releaseWorkspace();
+    }
+
+    if (info != 0) {
+        slate_error( "Hessenberg QR failed to converge "
+                     + std::to_string( info ) + " eigenvalues" );
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Schur decomposition of an upper Hessenberg matrix.
+///
+/// Computes the Schur form $T$, eigenvalues, and optionally the Schur
+/// vectors of an n-by-n upper Hessenberg matrix $H$:
+/// \[
+///     H = Q T Q^H.
+/// \]
+/// Uses multishift QR with aggressive early deflation, following LAPACK
+/// laqr0. The matrix stays distributed: deflation windows and chains of
+/// bulges are processed in windows gathered to one rank at a time, and
+/// the transforms of each window are applied to the rest of $H$ and to
+/// $Z$ by distributed gemm. Active blocks of at most 75 rows are solved
+/// by LAPACK on one rank.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] H
+///     On entry, the n-by-n upper Hessenberg matrix $H$; entries below the
+///     first subdiagonal must be zero.
+///     On exit, the Schur form $T$. For complex types, $T$ is upper
+///     triangular; for real types, upper quasi-triangular with 2-by-2
+///     diagonal blocks for complex conjugate pairs.
+///
+/// @param[out] Lambda
+///     The vector Lambda of length n.
+///     If successful, the eigenvalues, in the order of the diagonal of $T$.
+///     For real types, complex conjugate pairs appear consecutively,
+///     with positive imaginary part first.
+///
+/// @param[in,out] Z
+///     On entry, if Z is empty, does not compute Schur vectors.
+///     Otherwise, an n-by-n matrix $Z$, typically the unitary $Q$ from
+///     gehrd, with the same tile size as $H$.
+///     On exit, $Z Q$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target for the updates outside windows.
+///       Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// Throws an exception if Hessenberg QR fails to converge.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void hseqr(
+    Matrix<scalar_t>& H,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts)
+{
+    impl::hseqr( H, Lambda, Z, true, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel eigenvalues of an upper Hessenberg matrix.
+///
+/// As hseqr with Schur vectors, but computes only the eigenvalues; on exit,
+/// contents of $H$ are destroyed.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void hseqr(
+    Matrix<scalar_t>& H,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Options const& opts)
+{
+    Matrix<scalar_t> Z;
+    impl::hseqr( H, Lambda, Z, false, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void hseqr<float>(
+    Matrix<float>& H,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix<float>& Z,
+    Options const& opts);
+
+template
+void hseqr<double>(
+    Matrix<double>& H,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix<double>& Z,
+    Options const& opts);
+
+template
+void hseqr< std::complex<float> >(
+    Matrix< std::complex<float> >& H,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix< std::complex<float> >& Z,
+    Options const& opts);
+
+template
+void hseqr< std::complex<double> >(
+    Matrix< std::complex<double> >& H,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix< std::complex<double> >& Z,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void hseqr<float>(
+    Matrix<float>& H,
+    std::vector< std::complex<float> >& Lambda,
+    Options const& opts);
+
+template
+void hseqr<double>(
+    Matrix<double>& H,
+    std::vector< std::complex<double> >& Lambda,
+    Options const& opts);
+
+template
+void hseqr< std::complex<float> >(
+    Matrix< std::complex<float> >& H,
+    std::vector< std::complex<float> >& Lambda,
+    Options const& opts);
+
+template
+void hseqr< std::complex<double> >(
+    Matrix< std::complex<double> >& H,
+    std::vector< std::complex<double> >& Lambda,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,762 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal_alltoall.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Nonzero entry (i, j, value) of a sparse matrix, with global indices.
+template <typename scalar_t>
+struct Entry {
+    int64_t i;
+    int64_t j;
+    scalar_t value;
+};
+
+//------------------------------------------------------------------------------
+/// Rectangular block of a matrix held by one rank in an external layout:
+/// rows [ i0, i0 + mb ) and cols [ j0, j0 + nb ).
+struct Block {
+    int64_t i0, j0, mb, nb;
+};
+
+//------------------------------------------------------------------------------
+/// Calls func( i, j, ii, jj, mb, nb ) for each tile (i, j) of A that
+/// overlaps the block, in column-major order of tiles, where the overlap
+/// is rows [ ii, ii + mb ) and cols [ jj, jj + nb ) of the global matrix.
+/// Both the sender and receiver of a block iterate in this order, so the
+/// data can be exchanged without indices.
+///
+template <typename scalar_t, typename func_t>
+void for_each_overlap( Matrix<scalar_t>& A, Block const& block, func_t func )
+{
+    if (block.mb <= 0 || block.nb <= 0)
+        return;
+
+    int64_t i_first = A.tileRowIndex( block.i0 );
+    int64_t i_last  = A.tileRowIndex( block.i0 + block.mb - 1 );
+    int64_t j_first = A.tileColIndex( block.j0 );
+    int64_t j_last  = A.tileColIndex( block.j0 + block.nb - 1 );
+    for (int64_t j = j_first; j <= j_last; ++j) {
+        int64_t col0 = A.tileColOffset( j );
+        int64_t jj   = std::max( block.j0, col0 );
+        int64_t nb   = std::min( block.j0 + block.nb, col0 + A.tileNb( j ) ) - jj;
+        for (int64_t i = i_first; i <= i_last; ++i) {
+            int64_t row0 = A.tileRowOffset( i );
+            int64_t ii   = std::max( block.i0, row0 );
+            int64_t mb   = std::min( block.i0 + block.mb, row0 + A.tileMb( i ) ) - ii;
+            func( i, j, ii, jj, mb, nb );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Sends entries to the ranks owning them, then sums them into A,
+/// which is first set to zero. gen( emit ) calls emit( i, j, value )
+/// for each local entry; it is called twice, to count and to pack.
+///
+template <typename scalar_t, typename gen_t>
+void import_entries( Matrix<scalar_t>& A, gen_t gen )
+{
+    using entry_t = Entry<scalar_t>;
+
+    const scalar_t zero = 0.0;
+
+    if (A.op() != Op::NoTrans)
+        slate_not_implemented( "importing into a transposed matrix" );
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    MPI_Comm comm = A.mpiComm();
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ));
+
+    // Count entries for each rank, then pack them.
+    // Entries out of range are flagged rather than thrown here, so all
+    // ranks agree on the error instead of the others hanging in alltoallv.
+    std::vector<int64_t> send_offsets( mpi_size + 1, 0 );
+    int bad_index = 0;
+    gen( [&]( int64_t i, int64_t j, scalar_t value ) {
+        if (i < 0 || i >= m || j < 0 || j >= n) {
+            bad_index = 1;
+            return;
+        }
+        int rank = A.tileRank( A.tileRowIndex( i ), A.tileColIndex( j ) );
+        ++send_offsets[ rank+1 ];
+    });
+    int any_bad_index;
+    slate_mpi_call(
+        MPI_Allreduce( &bad_index, &any_bad_index, 1, MPI_INT, MPI_MAX, comm ));
+    if (any_bad_index)
+        slate_error( "entry index out of range" );
+    for (int r = 0; r < mpi_size; ++r)
+        send_offsets[ r+1 ] += send_offsets[ r ];
+
+    std::vector<entry_t> send( send_offsets[ mpi_size ] );
+    std::vector<int64_t> next( send_offsets.begin(), send_offsets.end() - 1 );
+    gen( [&]( int64_t i, int64_t j, scalar_t value ) {
+        int rank = A.tileRank( A.tileRowIndex( i ), A.tileColIndex( j ) );
+        send[ next[ rank ]++ ] = entry_t{ i, j, value };
+    });
+
+    std::vector<entry_t> recv;
+    std::vector<int64_t> recv_offsets;
+    internal::alltoallv( send, send_offsets, recv, recv_offsets, comm );
+    send.clear();
+    send.shrink_to_fit();
+
+    // Sort by column, then row, so consecutive entries share tiles.
+    std::sort( recv.begin(), recv.end(),
+               []( entry_t const& a, entry_t const& b ) {
+                   return a.j < b.j || (a.j == b.j && a.i < b.i);
+               });
+
+    A.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+    set( zero, A );
+
+    // Sum entries, so duplicates accumulate as in finite element assembly.
+    int64_t ti = -1, tj = -1, row0 = 0, col0 = 0;
+    Tile<scalar_t> T;
+    for (auto const& e : recv) {
+        if (tj < 0 || e.j < col0 || e.j >= col0 + A.tileNb( tj )
+            || e.i < row0 || e.i >= row0 + A.tileMb( ti )) {
+            ti = A.tileRowIndex( e.i );
+            tj = A.tileColIndex( e.j );
+            row0 = A.tileRowOffset( ti );
+            col0 = A.tileColOffset( tj );
+            T = A( ti, tj );
+        }
+        T.at( e.i - row0, e.j - col0 ) += e.value;
+    }
+
+    A.tileUpdateAllOrigin();
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel import of a sparse matrix in coordinate (COO)
+/// format, with entries arbitrarily distributed among the ranks.
+/// Entries are sent to the ranks owning them with a single all-to-all
+/// exchange, and densified into A.
+/// Collective over A's MPI communicator.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] nnz
+///     Number of local entries.
+///
+/// @param[in] rowind
+///     Array of length nnz. Global 0-based row index of each local entry.
+///
+/// @param[in] colind
+///     Array of length nnz. Global 0-based column index of each local entry.
+///
+/// @param[in] values
+///     Array of length nnz. Value of each local entry.
+///
+/// @param[in,out] A
+///     On entry, the m-by-n matrix A, with local tiles allocated.
+///     On exit, A is set to zero, then the entries are added to it.
+///     Duplicate entries are summed, as in finite element assembly.
+///     Transposed matrices are not supported.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void import_coo(
+    int64_t nnz, int64_t const* rowind, int64_t const* colind,
+    scalar_t const* values,
+    Matrix<scalar_t>& A,
+    Options const& opts)
+{
+    impl::import_entries( A, [&]( auto emit ) {
+        for (int64_t k = 0; k < nnz; ++k)
+            emit( rowind[ k ], colind[ k ], values[ k ] );
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel import of a sparse matrix in compressed sparse row
+/// (CSR) format, with rows distributed among the ranks, e.g., as in PETSc.
+/// Entries are sent to the ranks owning them with a single all-to-all
+/// exchange, and densified into A.
+/// Collective over A's MPI communicator.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] mloc
+///     Number of local rows.
+///
+/// @param[in] row_offset
+///     Global index of the first local row. Local row k is global row
+///     row_offset + k.
+///
+/// @param[in] rowptr
+///     Array of length mloc + 1. Entries of local row k are
+///     rowptr[ k ], ..., rowptr[ k+1 ] - 1 of colind and values.
+///     0-based, with rowptr[ 0 ] = 0.
+///
+/// @param[in] colind
+///     Array of length rowptr[ mloc ]. Global 0-based column indices.
+///
+/// @param[in] values
+///     Array of length rowptr[ mloc ]. Values.
+///
+/// @param[in,out] A
+///     On entry, the m-by-n matrix A, with local tiles allocated.
+///     On exit, A is set to zero, then the entries are added to it.
+///     Duplicate entries are summed.
+///     Transposed matrices are not supported.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void import_csr(
+    int64_t mloc, int64_t row_offset,
+    int64_t const* rowptr, int64_t const* colind, scalar_t const* values,
+    Matrix<scalar_t>& A,
+    Options const& opts)
+{
+    impl::import_entries( A, [&]( auto emit ) {
+        for (int64_t k = 0; k < mloc; ++k) {
+            for (int64_t p = rowptr[ k ]; p < rowptr[ k+1 ]; ++p)
+                emit( row_offset + k, colind[ p ], values[ p ] );
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel import of a dense matrix from an external layout,
+/// where each rank holds one column-major block, e.g., a 1D row or column
+/// slab. The blocks are sent to the ranks owning the tiles with a single
+/// all-to-all exchange of packed values; only the block extents are
+/// gathered, no indices are sent.
+/// Collective over A's MPI communicator.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] i0
+///     Global index of the first row of the local block.
+///
+/// @param[in] j0
+///     Global index of the first column of the local block.
+///
+/// @param[in] mloc
+///     Number of rows of the local block. May be 0.
+///
+/// @param[in] nloc
+///     Number of columns of the local block. May be 0.
+///
+/// @param[in] data
+///     The mloc-by-nloc local block, column-major.
+///
+/// @param[in] lda
+///     Leading dimension of data. lda >= max( 1, mloc ).
+///
+/// @param[in,out] A
+///     On entry, the m-by-n matrix A, with local tiles allocated.
+///     On exit, the parts of A covered by the blocks are set from them;
+///     the rest of A is unchanged. Blocks should not overlap.
+///     Transposed matrices are not supported.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void import_dense(
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    scalar_t const* data, int64_t lda,
+    Matrix<scalar_t>& A,
+    Options const& opts)
+{
+    if (A.op() != Op::NoTrans)
+        slate_not_implemented( "importing into a transposed matrix" );
+    slate_assert( lda >= std::max( int64_t( 1 ), mloc ) );
+    slate_assert( i0 >= 0 && j0 >= 0 && mloc >= 0 && nloc >= 0 );
+    slate_assert( i0 + mloc <= A.m() && j0 + nloc <= A.n() );
+
+    MPI_Comm comm = A.mpiComm();
+    int mpi_size, mpi_rank = A.mpiRank();
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ));
+
+    impl::Block my_block = { i0, j0, mloc, nloc };
+    std::vector<impl::Block> blocks;
+    internal::allgather( &my_block, 1, blocks, comm );
+
+    // Pack the local block by destination rank, in tile order.
+    std::vector<int64_t> send_offsets( mpi_size + 1, 0 );
+    impl::for_each_overlap( A, my_block,
+        [&]( int64_t i, int64_t j, int64_t ii, int64_t jj,
+             int64_t mb, int64_t nb ) {
+            send_offsets[ A.tileRank( i, j ) + 1 ] += mb*nb;
+        });
+    for (int r = 0; r < mpi_size; ++r)
+        send_offsets[ r+1 ] += send_offsets[ r ];
+
+    std::vector<scalar_t> send( send_offsets[ mpi_size ] );
+    std::vector<int64_t> next( send_offsets.begin(), send_offsets.end() - 1 );
+    impl::for_each_overlap( A, my_block,
+        [&]( int64_t i, int64_t j, int64_t ii, int64_t jj,
+             int64_t mb, int64_t nb ) {
+            int64_t& pos = next[ A.tileRank( i, j ) ];
+            for (int64_t c = 0; c < nb; ++c) {
+                scalar_t const* src = &data[ (ii - i0) + (jj - j0 + c)*lda ];
+                std::copy( src, src + mb, &send[ pos ] );
+                pos += mb;
+            }
+        });
+
+    std::vector<scalar_t> recv;
+    std::vector<int64_t> recv_offsets;
+    internal::alltoallv( send, send_offsets, recv, recv_offsets, comm );
+
+    // Unpack each sender's block into local tiles, in the same tile order.
+    A.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+    for (int r = 0; r < mpi_size; ++r) {
+        int64_t pos = recv_offsets[ r ];
+        impl::for_each_overlap( A, blocks[ r ],
+            [&]( int64_t i, int64_t j, int64_t ii, int64_t jj,
+                 int64_t mb, int64_t nb ) {
+                if (A.tileRank( i, j ) != mpi_rank)
+                    return;
+                auto T = A( i, j );
+                int64_t row = ii - A.tileRowOffset( i );
+                int64_t col = jj - A.tileColOffset( j );
+                for (int64_t c = 0; c < nb; ++c) {
+                    std::copy( &recv[ pos ], &recv[ pos ] + mb,
+                               &T.at( row, col + c ) );
+                    pos += mb;
+                }
+            });
+        assert( pos == recv_offsets[ r+1 ] );
+    }
+
+    A.tileUpdateAllOrigin();
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel export of a dense matrix to an external layout,
+/// where each rank receives one column-major block, e.g., a 1D row or
+/// column slab. This is the reverse of import_dense(), with a single
+/// all-to-all exchange of packed values.
+/// Collective over A's MPI communicator.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The m-by-n matrix A. Transposed matrices are not supported.
+///
+/// @param[in] i0
+///     Global index of the first row of the local block.
+///
+/// @param[in] j0
+///     Global index of the first column of the local block.
+///
+/// @param[in] mloc
+///     Number of rows of the local block. May be 0.
+///
+/// @param[in] nloc
+///     Number of columns of the local block. May be 0.
+///
+/// @param[out] data
+///     The mloc-by-nloc local block, column-major.
+///     On exit, A( i0 : i0+mloc-1, j0 : j0+nloc-1 ).
+///
+/// @param[in] lda
+///     Leading dimension of data. lda >= max( 1, mloc ).
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void export_dense(
+    Matrix<scalar_t>& A,
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    scalar_t* data, int64_t lda,
+    Options const& opts)
+{
+    if (A.op() != Op::NoTrans)
+        slate_not_implemented( "exporting a transposed matrix" );
+    slate_assert( lda >= std::max( int64_t( 1 ), mloc ) );
+    slate_assert( i0 >= 0 && j0 >= 0 && mloc >= 0 && nloc >= 0 );
+    slate_assert( i0 + mloc <= A.m() && j0 + nloc <= A.n() );
+
+    MPI_Comm comm = A.mpiComm();
+    int mpi_size, mpi_rank = A.mpiRank();
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ));
+
+    impl::Block my_block = { i0, j0, mloc, nloc };
+    std::vector<impl::Block> blocks;
+    internal::allgather( &my_block, 1, blocks, comm );
+
+    A.tileGetAllForReading( HostNum, LayoutConvert::ColMajor );
+
+    // Pack local tiles for each requesting rank, in its block's tile order.
+    std::vector<int64_t> send_offsets( mpi_size + 1, 0 );
+    for (int r = 0; r < mpi_size; ++r) {
+        int64_t count = 0;
+        impl::for_each_overlap( A, blocks[ r ],
+            [&]( int64_t i, int64_t j, int64_t ii, int64_t jj,
+                 int64_t mb, int64_t nb ) {
+                if (A.tileRank( i, j ) == mpi_rank)
+                    count += mb*nb;
+            });
+        send_offsets[ r+1 ] = send_offsets[ r ] + count;
+    }
+
+    std::vector<scalar_t> send( send_offsets[ mpi_size ] );
+    for (int r = 0; r < mpi_size; ++r) {
+        int64_t pos = send_offsets[ r ];
+        impl::for_each_overlap( A, blocks[ r ],
+            [&]( int64_t i, int64_t j, int64_t ii, int64_t jj,
+                 int64_t mb, int64_t nb ) {
+                if (A.tileRank( i, j ) != mpi_rank)
+                    return;
+                auto T = A( i, j );
+                int64_t row = ii - A.tileRowOffset( i );
+                int64_t col = jj - A.tileColOffset( j );
+                for (int64_t c = 0; c < nb; ++c) {
+                    scalar_t const* src = &T.at( row, col + c );
+                    std::copy( src, src + mb, &send[ pos ] );
+                    pos += mb;
+                }
+            });
+    }
+
+    std::vector<scalar_t> recv;
+    std::vector<int64_t> recv_offsets;
+    internal::alltoallv( send, send_offsets, recv, recv_offsets, comm );
+
+    // Unpack from each tile owner, in the local block's tile order.
+    std::vector<int64_t> next( recv_offsets.begin(), recv_offsets.end() - 1 );
+    impl::for_each_overlap( A, my_block,
+        [&]( int64_t i, int64_t j, int64_t ii, int64_t jj,
+             int64_t mb, int64_t nb ) {
+            int64_t& pos = next[ A.tileRank( i, j ) ];
+            for (int64_t c = 0; c < nb; ++c) {
+                std::copy( &recv[ pos ], &recv[ pos ] + mb,
+                           &data[ (ii - i0) + (jj - j0 + c)*lda ] );
+                pos += mb;
+            }
+        });
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel export of the nonzeros of a matrix to compressed
+/// sparse row (CSR) format, with rows distributed among the ranks.
+/// This is the reverse of import_csr(), with a single all-to-all exchange.
+/// Collective over A's MPI communicator.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The m-by-n matrix A. Transposed matrices are not supported.
+///
+/// @param[in] mloc
+///     Number of local rows. The row ranges of the ranks must not overlap.
+///
+/// @param[in] row_offset
+///     Global index of the first local row.
+///
+/// @param[out] rowptr
+///     On exit, vector of length mloc + 1. Entries of local row k are
+///     rowptr[ k ], ..., rowptr[ k+1 ] - 1 of colind and values.
+///
+/// @param[out] colind
+///     On exit, global 0-based column indices, ascending within each row.
+///
+/// @param[out] values
+///     On exit, the nonzero values.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void export_csr(
+    Matrix<scalar_t>& A,
+    int64_t mloc, int64_t row_offset,
+    std::vector<int64_t>& rowptr, std::vector<int64_t>& colind,
+    std::vector<scalar_t>& values,
+    Options const& opts)
+{
+    using entry_t = impl::Entry<scalar_t>;
+
+    const scalar_t zero = 0.0;
+
+    if (A.op() != Op::NoTrans)
+        slate_not_implemented( "exporting a transposed matrix" );
+    slate_assert( row_offset >= 0 && mloc >= 0 );
+    slate_assert( row_offset + mloc <= A.m() );
+
+    MPI_Comm comm = A.mpiComm();
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ));
+
+    // Gather row ranges, sorted by first row, to find each row's owner.
+    impl::Block my_rows = { row_offset, 0, mloc, 0 };
+    std::vector<impl::Block> blocks;
+    internal::allgather( &my_rows, 1, blocks, comm );
+    std::vector< std::pair<int64_t, int> > starts;
+    for (int r = 0; r < mpi_size; ++r) {
+        if (blocks[ r ].mb > 0)
+            starts.push_back( { blocks[ r ].i0, r } );
+    }
+    std::sort( starts.begin(), starts.end() );
+    auto row_rank = [&]( int64_t row ) {
+        auto it = std::upper_bound(
+            starts.begin(), starts.end(), std::make_pair( row, mpi_size ) );
+        if (it == starts.begin())
+            return -1;
+        --it;
+        auto const& b = blocks[ it->second ];
+        return row < b.i0 + b.mb ? it->second : -1;
+    };
+
+    A.tileGetAllForReading( HostNum, LayoutConvert::ColMajor );
+
+    // Scan local tiles twice: count, then pack nonzeros by destination.
+    auto scan = [&]( auto emit ) {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            int64_t col0 = A.tileColOffset( j );
+            for (int64_t i = 0; i < A.mt(); ++i) {
+                if (! A.tileIsLocal( i, j ))
+                    continue;
+                auto T = A( i, j );
+                int64_t row0 = A.tileRowOffset( i );
+                for (int64_t ii = 0; ii < T.mb(); ++ii) {
+                    int rank = row_rank( row0 + ii );
+                    if (rank < 0)
+                        continue;
+                    for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                        scalar_t value = T.at( ii, jj );
+                        if (value != zero)
+                            emit( rank, entry_t{ row0 + ii, col0 + jj, value } );
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<int64_t> send_offsets( mpi_size + 1, 0 );
+    scan( [&]( int rank, entry_t const& e ) {
+        ++send_offsets[ rank+1 ];
+    });
+    for (int r = 0; r < mpi_size; ++r)
+        send_offsets[ r+1 ] += send_offsets[ r ];
+
+    std::vector<entry_t> send( send_offsets[ mpi_size ] );
+    std::vector<int64_t> next( send_offsets.begin(), send_offsets.end() - 1 );
+    scan( [&]( int rank, entry_t const& e ) {
+        send[ next[ rank ]++ ] = e;
+    });
+
+    std::vector<entry_t> recv;
+    std::vector<int64_t> recv_offsets;
+    internal::alltoallv( send, send_offsets, recv, recv_offsets, comm );
+
+    std::sort( recv.begin(), recv.end(),
+               []( entry_t const& a, entry_t const& b ) {
+                   return a.i < b.i || (a.i == b.i && a.j < b.j);
+               });
+
+    rowptr.assign( mloc + 1, 0 );
+    colind.resize( recv.size() );
+    values.resize( recv.size() );
+    for (size_t k = 0; k < recv.size(); ++k) {
+        ++rowptr[ recv[ k ].i - row_offset + 1 ];
+        colind[ k ] = recv[ k ].j;
+        values[ k ] = recv[ k ].value;
+    }
+    for (int64_t k = 0; k < mloc; ++k)
+        rowptr[ k+1 ] += rowptr[ k ];
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void import_coo<float>(
+    int64_t nnz, int64_t const* rowind, int64_t const* colind,
+    float const* values,
+    Matrix<float>& A,
+    Options const& opts);
+
+template
+void import_coo<double>(
+    int64_t nnz, int64_t const* rowind, int64_t const* colind,
+    double const* values,
+    Matrix<double>& A,
+    Options const& opts);
+
+template
+void import_coo< std::complex<float> >(
+    int64_t nnz, int64_t const* rowind, int64_t const* colind,
+    std::complex<float> const* values,
+    Matrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void import_coo< std::complex<double> >(
+    int64_t nnz, int64_t const* rowind, int64_t const* colind,
+    std::complex<double> const* values,
+    Matrix< std::complex<double> >& A,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void import_csr<float>(
+    int64_t mloc, int64_t row_offset,
+    int64_t const* rowptr, int64_t const* colind, float const* values,
+    Matrix<float>& A,
+    Options const& opts);
+
+template
+void import_csr<double>(
+    int64_t mloc, int64_t row_offset,
+    int64_t const* rowptr, int64_t const* colind, double const* values,
+    Matrix<double>& A,
+    Options const& opts);
+
+template
+void import_csr< std::complex<float> >(
+    int64_t mloc, int64_t row_offset,
+    int64_t const* rowptr, int64_t const* colind,
+    std::complex<float> const* values,
+    Matrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void import_csr< std::complex<double> >(
+    int64_t mloc, int64_t row_offset,
+    int64_t const* rowptr, int64_t const* colind,
+    std::complex<double> const* values,
+    Matrix< std::complex<double> >& A,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void import_dense<float>(
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    float const* data, int64_t lda,
+    Matrix<float>& A,
+    Options const& opts);
+
+template
+void import_dense<double>(
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    double const* data, int64_t lda,
+    Matrix<double>& A,
+    Options const& opts);
+
+template
+void import_dense< std::complex<float> >(
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    std::complex<float> const* data, int64_t lda,
+    Matrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void import_dense< std::complex<double> >(
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    std::complex<double> const* data, int64_t lda,
+    Matrix< std::complex<double> >& A,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void export_dense<float>(
+    Matrix<float>& A,
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    float* data, int64_t lda,
+    Options const& opts);
+
+template
+void export_dense<double>(
+    Matrix<double>& A,
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    double* data, int64_t lda,
+    Options const& opts);
+
+template
+void export_dense< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    std::complex<float>* data, int64_t lda,
+    Options const& opts);
+
+template
+void export_dense< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    int64_t i0, int64_t j0, int64_t mloc, int64_t nloc,
+    std::complex<double>* data, int64_t lda,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void export_csr<float>(
+    Matrix<float>& A,
+    int64_t mloc, int64_t row_offset,
+    std::vector<int64_t>& rowptr, std::vector<int64_t>& colind,
+    std::vector<float>& values,
+    Options const& opts);
+
+template
+void export_csr<double>(
+    Matrix<double>& A,
+    int64_t mloc, int64_t row_offset,
+    std::vector<int64_t>& rowptr, std::vector<int64_t>& colind,
+    std::vector<double>& values,
+    Options const& opts);
+
+template
+void export_csr< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    int64_t mloc, int64_t row_offset,
+    std::vector<int64_t>& rowptr, std::vector<int64_t>& colind,
+    std::vector< std::complex<float> >& values,
+    Options const& opts);
+
+template
+void export_csr< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    int64_t mloc, int64_t row_offset,
+    std::vector<int64_t>& rowptr, std::vector<int64_t>& colind,
+    std::vector< std::complex<double> >& values,
+    Options const& opts);
+
+} // namespace slate
@@ -186,6 +186,26 @@ void gemmA(scalar_t alpha, Matrix<scalar_t>&& A,
            Layout layout, int priority=0, int64_t queue_index=0,
            Options const& opts = Options());
 
+//-----------------------------------------
+// gemm_compensated()
+template <Target target=Target::HostTask, typename scalar_t>
+void gemm_compensated(scalar_t alpha, Matrix<scalar_t>&& A,
+                                      Matrix<scalar_t>&& B,
+                                      Matrix<scalar_t>&& C,
+                                      Matrix<scalar_t>&& C_lo,
+                                      Matrix<scalar_t>&& C_abs,
+                      int priority=0);
+
+//-----------------------------------------
+// hemm_compensated()
+template <Target target=Target::HostTask, typename scalar_t>
+void hemm_compensated(scalar_t alpha, HermitianMatrix<scalar_t>&& A,
+                      int64_t k,      Matrix<scalar_t>&& B,
+                                      Matrix<scalar_t>&& C,
+                                      Matrix<scalar_t>&& C_lo,
+                                      Matrix<scalar_t>&& C_abs,
+                      int priority=0);
+
 //-----------------------------------------
 // hemm()
 template <Target target=Target::HostTask, typename scalar_t>
@@ -345,6 +365,15 @@ void trmm(Side side,
                                     Matrix<scalar_t>&& B,
           int priority=0, int64_t queue_index=0);
 
+//-----------------------------------------
+// trmm_add()
+template <Target target=Target::HostTask, typename scalar_t>
+void trmm_add(Side side,
+              scalar_t alpha, TriangularMatrix<scalar_t>&& A,
+                                        Matrix<scalar_t>&& B,
+                                        Matrix<scalar_t>&& C,
+              int priority=0);
+
 //-----------------------------------------
 // trsm()
 template <Target target=Target::HostTask, typename scalar_t>
@@ -375,6 +404,14 @@ template <Target target=Target::HostTask, typename scalar_t>
 void trtrm(TriangularMatrix<scalar_t>&& A,
            int priority=0);
 
+//-----------------------------------------
+// trtrmm()
+template <Target target=Target::HostTask, typename scalar_t>
+void trtrmm(scalar_t alpha, TriangularMatrix<scalar_t>&& A,
+                            TriangularMatrix<scalar_t>&& B,
+                                      Matrix<scalar_t>&& C,
+            int priority=0);
+
 //------------------------------------------------------------------------------
 // LAPACK auxiliary
 template <Target target=Target::HostTask, typename scalar_t>
@@ -383,6 +420,15 @@ void permuteRows(
     Matrix<scalar_t>&& A, std::vector<Pivot>& pivot,
     Layout layout, int priority=0, int tag=0, int queue_index=0);
 
+void composeParallelPivot(
+    int64_t tile_offset, std::vector<Pivot> const& pivot,
+    std::map<Pivot, Pivot>& pivot_map);
+
+template <Target target=Target::HostTask, typename scalar_t>
+void permuteRowsMap(
+    std::map<Pivot, Pivot> const& pivot_map,
+    Matrix<scalar_t>&& A, Layout layout, int priority=0, int tag=0);
+
 template <Target target=Target::HostTask, typename scalar_t>
 void permuteRowsCols(
     Direction direction,
@@ -616,6 +662,10 @@ void unmlq(Side side, Op op,
            Matrix<scalar_t>&& C,
            Matrix<scalar_t>&& W);
 
+// Workspace for unmqr() and unmlq().
+template <typename scalar_t>
+Matrix<scalar_t> unmqr_workspace(Side side, Matrix<scalar_t>& C);
+
 //-----------------------------------------
 // unmtr_hb2st()
 template <Target target=Target::HostTask, typename scalar_t>
@@ -0,0 +1,140 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_INTERNAL_ALLTOALL_HH
+#define SLATE_INTERNAL_ALLTOALL_HH
+
+#include "slate/Exception.hh"
+#include "slate/internal/mpi.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Packed all-to-all exchange of items of a trivially copyable type T,
+/// with a single MPI_Alltoallv for the data, after exchanging the counts.
+/// Collective over mpi_comm.
+///
+/// @param[in] send
+///     Items to send, packed by destination rank: the items for rank r
+///     are send[ send_offsets[ r ] : send_offsets[ r+1 ]-1 ].
+///
+/// @param[in] send_offsets
+///     Vector of length mpi_size + 1 of offsets into send.
+///
+/// @param[out] recv
+///     Items received, packed by source rank.
+///
+/// @param[out] recv_offsets
+///     Vector of length mpi_size + 1 of offsets into recv: the items
+///     from rank r are recv[ recv_offsets[ r ] : recv_offsets[ r+1 ]-1 ].
+///
+/// @param[in] mpi_comm
+///     MPI communicator.
+///
+template <typename T>
+void alltoallv(
+    std::vector<T> const& send, std::vector<int64_t> const& send_offsets,
+    std::vector<T>& recv, std::vector<int64_t>& recv_offsets,
+    MPI_Comm mpi_comm)
+{
+    static_assert( std::is_trivially_copyable<T>::value,
+                   "alltoallv requires a trivially copyable type" );
+
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( mpi_comm, &mpi_size ));
+    assert( int( send_offsets.size() ) == mpi_size + 1 );
+
+    recv_offsets.resize( mpi_size + 1 );
+    if (mpi_size == 1) {
+        recv = send;
+        recv_offsets = send_offsets;
+        return;
+    }
+
+#ifndef SLATE_NO_MPI
+    // Counts and displacements are in items of type T, which is sent as
+    // a contiguous type, so the volume can exceed 2 GiB.
+    std::vector<int> send_counts( mpi_size ), send_displs( mpi_size );
+    std::vector<int> recv_counts( mpi_size ), recv_displs( mpi_size );
+    for (int r = 0; r < mpi_size; ++r) {
+        int64_t count = send_offsets[ r+1 ] - send_offsets[ r ];
+        slate_assert( send_offsets[ r ] <= INT_MAX && count <= INT_MAX );
+        send_counts[ r ] = count;
+        send_displs[ r ] = send_offsets[ r ];
+    }
+
+    slate_mpi_call(
+        MPI_Alltoall( send_counts.data(), 1, MPI_INT,
+                      recv_counts.data(), 1, MPI_INT, mpi_comm ));
+
+    recv_offsets[ 0 ] = 0;
+    for (int r = 0; r < mpi_size; ++r) {
+        slate_assert( recv_offsets[ r ] <= INT_MAX );
+        recv_displs[ r ] = recv_offsets[ r ];
+        recv_offsets[ r+1 ] = recv_offsets[ r ] + recv_counts[ r ];
+    }
+    recv.resize( recv_offsets[ mpi_size ] );
+
+    MPI_Datatype item_type;
+    slate_mpi_call(
+        MPI_Type_contiguous( sizeof(T), MPI_BYTE, &item_type ));
+    slate_mpi_call(
+        MPI_Type_commit( &item_type ));
+
+    slate_mpi_call(
+        MPI_Alltoallv( send.data(), send_counts.data(), send_displs.data(),
+                       item_type,
+                       recv.data(), recv_counts.data(), recv_displs.data(),
+                       item_type, mpi_comm ));
+
+    slate_mpi_call(
+        MPI_Type_free( &item_type ));
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// Gathers n items of type T from every rank, in rank order.
+/// Collective over mpi_comm.
+///
+template <typename T>
+void allgather(
+    T const* send, int n, std::vector<T>& recv, MPI_Comm mpi_comm)
+{
+    static_assert( std::is_trivially_copyable<T>::value,
+                   "allgather requires a trivially copyable type" );
+
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( mpi_comm, &mpi_size ));
+
+    recv.resize( size_t( n ) * mpi_size );
+    if (mpi_size == 1) {
+        std::copy( send, send + n, recv.begin() );
+        return;
+    }
+
+#ifndef SLATE_NO_MPI
+    slate_mpi_call(
+        MPI_Allgather( send, n*sizeof(T), MPI_BYTE,
+                       recv.data(), n*sizeof(T), MPI_BYTE, mpi_comm ));
+#endif
+}
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_ALLTOALL_HH
@@ -0,0 +1,491 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Matrix.hh"
+#include "slate/Tile_aux.hh"
+#include "slate/types.hh"
+#include "internal/internal_checkpoint.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+namespace slate {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// @return true if physical tile (i, j) is in the stored triangle.
+inline bool in_uplo( Uplo uplo, int64_t i, int64_t j )
+{
+    return uplo == Uplo::General
+           || (uplo == Uplo::Lower && i >= j)
+           || (uplo == Uplo::Upper && i <= j);
+}
+
+//------------------------------------------------------------------------------
+/// @return true if tile (i, j) of op(A) exists on the host or any device.
+template <typename scalar_t>
+bool tile_exists( BaseMatrix<scalar_t>& A, int64_t i, int64_t j )
+{
+    for (int device = HostNum; device < A.num_devices(); ++device) {
+        if (A.tileExists( i, j, device ))
+            return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+/// Returns physical tile (i, j) of A on the host, that is, tile (i, j) of A
+/// without A's transpose op applied, so checkpoints are independent of op.
+///
+template <typename scalar_t>
+Tile<scalar_t> physical_tile( BaseMatrix<scalar_t>& A, int64_t i, int64_t j )
+{
+    if (A.op() == Op::NoTrans)
+        return A( i, j );
+
+    auto T = A( j, i );
+    if (T.op() == Op::Trans)
+        return transpose( T );
+    else
+        return conj_transpose( T );
+}
+
+//------------------------------------------------------------------------------
+/// Creates a host matrix with the physical structure and distribution of A,
+/// with all local tiles allocated and set to zero.
+///
+template <typename scalar_t>
+Matrix<scalar_t> physical_empty_like( BaseMatrix<scalar_t>& A )
+{
+    const scalar_t zero = 0.0;
+
+    auto S = Matrix<scalar_t>::emptyLike( A );
+    if (S.op() == Op::Trans)
+        S = transpose( S );
+    else if (S.op() == Op::ConjTrans)
+        S = conj_transpose( S );
+
+    S.insertLocalTiles();
+    for (int64_t j = 0; j < S.nt(); ++j) {
+        for (int64_t i = 0; i < S.mt(); ++i) {
+            if (S.tileIsLocal( i, j ))
+                S( i, j ).set( zero );
+        }
+    }
+    return S;
+}
+
+//------------------------------------------------------------------------------
+/// Copies existing local tiles of A in its stored triangle into snapshot S.
+/// Tiles are read in whatever layout and location they are, without
+/// changing the layout, so the factorization is not disturbed.
+///
+template <typename scalar_t>
+void copy_to_snapshot( BaseMatrix<scalar_t>& A, Matrix<scalar_t>& S )
+{
+    Uplo uplo = A.uploPhysical();
+    bool trans = A.op() != Op::NoTrans;
+    for (int64_t j = 0; j < S.nt(); ++j) {
+        for (int64_t i = 0; i < S.mt(); ++i) {
+            int64_t li = trans ? j : i;
+            int64_t lj = trans ? i : j;
+            if (S.tileIsLocal( i, j ) && in_uplo( uplo, i, j )
+                && tile_exists( A, li, lj )) {
+                A.tileGetForReading( li, lj, HostNum, LayoutConvert::None );
+                tile::gecopy( physical_tile( A, i, j ), S( i, j ) );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies snapshot S into existing local tiles of A in its stored triangle.
+///
+template <typename scalar_t>
+void copy_from_snapshot( Matrix<scalar_t>& S, BaseMatrix<scalar_t>& A )
+{
+    Uplo uplo = A.uploPhysical();
+    bool trans = A.op() != Op::NoTrans;
+    for (int64_t j = 0; j < S.nt(); ++j) {
+        for (int64_t i = 0; i < S.mt(); ++i) {
+            int64_t li = trans ? j : i;
+            int64_t lj = trans ? i : j;
+            if (S.tileIsLocal( i, j ) && in_uplo( uplo, i, j )
+                && tile_exists( A, li, lj )) {
+                A.tileGetForWriting( li, lj, HostNum, LayoutConvert::ColMajor );
+                tile::gecopy( S( i, j ), physical_tile( A, i, j ) );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return file name of snapshot `<prefix>.<slot>.<index>`,
+/// where index 0 is A, and 1, 2 are the T factors.
+inline std::string snapshot_name(
+    std::string const& prefix, int64_t slot, int index )
+{
+    static char const* names[] = { "A", "T0", "T1" };
+    return prefix + "." + std::to_string( slot ) + "." + names[ index ];
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Creates a checkpoint for the given routine.
+///
+/// @param[in] routine
+///     Routine name, "potrf", "getrf", or "geqrf", recorded in the metadata.
+///
+/// @param[in] opts
+///     Options:
+///     - Option::CheckpointInterval: save every interval panels;
+///       0 disables checkpoints. Default 0.
+///     - Option::CheckpointFile: prefix of the checkpoint files.
+///       Default "slate_checkpoint".
+///
+/// @param[in] k_start
+///     First panel of the factorization, > 0 when restarted.
+///     When restarted, the first save uses the slot not holding
+///     the checkpoint restarted from.
+///
+/// @param[in] mpi_comm
+///     MPI communicator of the matrix.
+///
+template <typename scalar_t>
+Checkpoint<scalar_t>::Checkpoint(
+    char const* routine, Options const& opts, int64_t k_start,
+    MPI_Comm mpi_comm )
+    : prefix_( get_option<char const*>( opts, Option::CheckpointFile,
+                                         "slate_checkpoint" ) ),
+      interval_( get_option<int64_t>( opts, Option::CheckpointInterval, 0 ) ),
+      k_start_( k_start ),
+      mpi_comm_( mpi_comm ),
+      mpi_rank_( 0 ),
+      pending_k_( -1 ),
+      slot_( 1 ),
+      m_( 0 ), n_( 0 ), nb_( 0 ),
+      uplo_( Uplo::General )
+{
+    slate_assert( interval_ >= 0 );
+    std::memset( routine_, 0, sizeof(routine_) );
+    std::strncpy( routine_, routine, sizeof(routine_) - 1 );
+
+    if (interval_ > 0) {
+        slate_mpi_call(
+            MPI_Comm_rank( mpi_comm_, &mpi_rank_ ));
+        if (k_start_ > 0) {
+            CheckpointHeader header;
+            read_meta( prefix_, routine, mpi_comm_, header, nullptr );
+            slot_ = header.slot;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Destructor completes a pending checkpoint, if any.
+/// Errors are reported by an explicit finish().
+///
+template <typename scalar_t>
+Checkpoint<scalar_t>::~Checkpoint()
+{
+    try {
+        finish();
+    }
+    catch (...) {
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Saves a checkpoint of the factorization after panels 0, ..., k-1 are
+/// complete, and the trailing matrix is updated by them.
+/// All tasks modifying A must be complete, e.g., by a taskwait.
+/// Completes the previous checkpoint, if any, then copies A (and T) into
+/// the snapshots and starts writing them asynchronously.
+/// Collective over A's MPI communicator.
+///
+/// @param[in] k
+///     Number of completed block columns.
+///
+/// @param[in] A
+///     Matrix being factored. May be transposed, trapezoid, or Hermitian;
+///     the physical tiles in the stored triangle are saved.
+///
+/// @param[in] pivots
+///     Optional pivots of LU; pivots of panels 0, ..., k-1 are saved.
+///
+/// @param[in] T
+///     Optional triangular factors of QR, of size 2.
+///
+template <typename scalar_t>
+void Checkpoint<scalar_t>::save(
+    int64_t k, BaseMatrix<scalar_t>& A,
+    Pivots const* pivots,
+    std::vector< Matrix<scalar_t> >* T )
+{
+    finish();
+
+    if (snapshots_.empty()) {
+        snapshots_.push_back( physical_empty_like( A ) );
+        if (T != nullptr) {
+            slate_assert( T->size() + 1 <= size_t( max_files ) );
+            for (auto& Ti : *T)
+                snapshots_.push_back( physical_empty_like( Ti ) );
+        }
+        m_  = snapshots_[ 0 ].m();
+        n_  = snapshots_[ 0 ].n();
+        nb_ = snapshots_[ 0 ].tileNb( 0 );
+        uplo_ = A.uploPhysical();
+    }
+
+    copy_to_snapshot( A, snapshots_[ 0 ] );
+    if (T != nullptr) {
+        for (size_t t = 0; t < T->size(); ++t)
+            copy_to_snapshot( (*T)[ t ], snapshots_[ t+1 ] );
+    }
+
+    pending_pivots_.clear();
+    if (pivots != nullptr) {
+        for (int64_t j = 0; j < k && j < int64_t( pivots->size() ); ++j) {
+            for (auto const& pivot : pivots->at( j )) {
+                pending_pivots_.push_back( pivot.tileIndex() );
+                pending_pivots_.push_back( pivot.elementOffset() );
+            }
+        }
+    }
+
+    slot_ = 1 - slot_;
+    pending_k_ = k;
+    for (size_t s = 0; s < snapshots_.size(); ++s) {
+        std::string name = snapshot_name( prefix_, slot_, s );
+        iwrite( name.c_str(), snapshots_[ s ], FileFormat::Tiled,
+                requests_[ s ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Waits for the pending checkpoint, if any, to be written, then commits it
+/// by writing its metadata. Collective over the matrix's MPI communicator.
+///
+template <typename scalar_t>
+void Checkpoint<scalar_t>::finish()
+{
+    if (pending_k_ < 0)
+        return;
+
+    for (int s = 0; s < max_files; ++s)
+        requests_[ s ].wait();
+
+    write_meta();
+    pending_k_ = -1;
+}
+
+//------------------------------------------------------------------------------
+/// Rank 0 writes the metadata to a temporary file, then renames it,
+/// so `<prefix>.meta` is replaced atomically.
+///
+template <typename scalar_t>
+void Checkpoint<scalar_t>::write_meta()
+{
+    int ok = 1;
+    if (mpi_rank_ == 0) {
+        CheckpointHeader header;
+        std::memset( &header, 0, sizeof(header) );
+        std::memcpy( header.magic, "SLATECKP", sizeof(header.magic) );
+        header.version    = 1;
+        header.precision  = precision_char<scalar_t>();
+        header.uplo       = char( uplo_ );
+        std::memcpy( header.routine, routine_, sizeof(header.routine) );
+        header.k          = pending_k_;
+        header.slot       = slot_;
+        header.m          = m_;
+        header.n          = n_;
+        header.nb         = nb_;
+        header.num_pivots = pending_pivots_.size() / 2;
+
+        std::string meta = prefix_ + ".meta";
+        std::string tmp  = meta + ".tmp";
+        FILE* file = std::fopen( tmp.c_str(), "wb" );
+        if (file != nullptr) {
+            size_t cnt = std::fwrite( &header, sizeof(header), 1, file );
+            if (! pending_pivots_.empty()) {
+                cnt += std::fwrite( pending_pivots_.data(),
+                                    pending_pivots_.size()*sizeof(int64_t), 1,
+                                    file );
+            }
+            ok = (std::fclose( file ) == 0)
+                 && cnt == (pending_pivots_.empty() ? 1 : 2)
+                 && std::rename( tmp.c_str(), meta.c_str() ) == 0;
+        }
+        else {
+            ok = 0;
+        }
+    }
+    slate_mpi_call(
+        MPI_Bcast( &ok, 1, MPI_INT, 0, mpi_comm_ ));
+    if (! ok)
+        slate_error( "cannot write checkpoint " + prefix_ + ".meta" );
+}
+
+//------------------------------------------------------------------------------
+/// Reads and validates the checkpoint metadata.
+/// Rank 0 reads the file and broadcasts it. Collective over mpi_comm.
+///
+template <typename scalar_t>
+void Checkpoint<scalar_t>::read_meta(
+    std::string const& prefix, char const* routine, MPI_Comm mpi_comm,
+    CheckpointHeader& header, std::vector<int64_t>* pivots )
+{
+    int mpi_rank;
+    slate_mpi_call(
+        MPI_Comm_rank( mpi_comm, &mpi_rank ));
+
+    std::string meta = prefix + ".meta";
+    std::vector<int64_t> buffer;
+    int ok = 1;
+    if (mpi_rank == 0) {
+        FILE* file = std::fopen( meta.c_str(), "rb" );
+        ok = file != nullptr
+             && std::fread( &header, sizeof(header), 1, file ) == 1
+             && header.num_pivots >= 0;
+        if (ok) {
+            buffer.resize( 2*header.num_pivots );
+            if (! buffer.empty()) {
+                ok = std::fread( buffer.data(), buffer.size()*sizeof(int64_t),
+                                 1, file ) == 1;
+            }
+        }
+        if (file != nullptr)
+            std::fclose( file );
+    }
+    slate_mpi_call(
+        MPI_Bcast( &ok, 1, MPI_INT, 0, mpi_comm ));
+    if (! ok)
+        slate_error( "cannot read checkpoint " + meta );
+
+    slate_mpi_call(
+        MPI_Bcast( &header, sizeof(header), MPI_BYTE, 0, mpi_comm ));
+
+    if (std::memcmp( header.magic, "SLATECKP", sizeof(header.magic) ) != 0
+        || header.version != 1)
+        slate_error( meta + " is not a SLATE checkpoint" );
+    if (header.precision != precision_char<scalar_t>())
+        slate_error( "checkpoint precision does not match matrix" );
+    if (std::strncmp( header.routine, routine, sizeof(header.routine) ) != 0)
+        slate_error( "checkpoint is from a different routine" );
+
+    if (pivots != nullptr) {
+        buffer.resize( 2*header.num_pivots );
+        slate_mpi_call(
+            MPI_Bcast( buffer.data(), buffer.size()*sizeof(int64_t), MPI_BYTE,
+                       0, mpi_comm ));
+        *pivots = std::move( buffer );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return number of completed block columns in the last checkpoint.
+/// Collective over mpi_comm.
+///
+template <typename scalar_t>
+int64_t Checkpoint<scalar_t>::restart_column(
+    char const* routine, Options const& opts, MPI_Comm mpi_comm )
+{
+    std::string prefix = get_option<char const*>(
+        opts, Option::CheckpointFile, "slate_checkpoint" );
+
+    CheckpointHeader header;
+    read_meta( prefix, routine, mpi_comm, header, nullptr );
+    return header.k;
+}
+
+//------------------------------------------------------------------------------
+/// Restores A (and pivots, T) from the last checkpoint.
+/// Collective over A's MPI communicator.
+///
+/// @param[in,out] A
+///     Matrix with the same dimensions and tile size as the checkpointed
+///     matrix; its distribution may differ. On exit, the stored triangle
+///     of A is restored.
+///
+/// @param[out] pivots
+///     Optional LU pivots; on exit, pivots of the completed panels.
+///
+/// @param[in,out] T
+///     Optional QR triangular factors; existing local tiles are restored.
+///     The caller inserts the tiles of the completed panels beforehand.
+///
+/// @return number of completed block columns, from which to resume.
+///
+template <typename scalar_t>
+int64_t Checkpoint<scalar_t>::restore(
+    char const* routine, Options const& opts,
+    BaseMatrix<scalar_t>& A,
+    Pivots* pivots,
+    std::vector< Matrix<scalar_t> >* T )
+{
+    std::string prefix = get_option<char const*>(
+        opts, Option::CheckpointFile, "slate_checkpoint" );
+
+    CheckpointHeader header;
+    std::vector<int64_t> buffer;
+    read_meta( prefix, routine, A.mpiComm(), header, &buffer );
+
+    auto S = physical_empty_like( A );
+    if (header.m != S.m() || header.n != S.n() || header.nb != S.tileNb( 0 ))
+        slate_error( "checkpoint dimensions or tile size do not match matrix" );
+    if (header.uplo != char( A.uploPhysical() ))
+        slate_error( "checkpoint uplo does not match matrix" );
+
+    IORequest request;
+    std::string name = snapshot_name( prefix, header.slot, 0 );
+    iread( name.c_str(), S, FileFormat::Tiled, request );
+    request.wait();
+    copy_from_snapshot( S, A );
+
+    if (T != nullptr) {
+        slate_assert( T->size() + 1 <= size_t( max_files ) );
+        for (size_t t = 0; t < T->size(); ++t) {
+            auto ST = physical_empty_like( (*T)[ t ] );
+            name = snapshot_name( prefix, header.slot, t+1 );
+            iread( name.c_str(), ST, FileFormat::Tiled, request );
+            request.wait();
+            copy_from_snapshot( ST, (*T)[ t ] );
+        }
+    }
+
+    if (pivots != nullptr) {
+        // Pivots are stored panel by panel; panel j has min(mb, nb) pivots.
+        int64_t min_mt_nt = std::min( A.mt(), A.nt() );
+        pivots->resize( min_mt_nt );
+        size_t index = 0;
+        for (int64_t j = 0; j < header.k; ++j) {
+            int64_t diag_len = std::min( A.tileMb( j ), A.tileNb( j ) );
+            pivots->at( j ).resize( diag_len );
+            for (int64_t p = 0; p < diag_len; ++p) {
+                slate_assert( index + 1 < buffer.size() );
+                pivots->at( j )[ p ] = Pivot( buffer[ index ],
+                                              buffer[ index+1 ] );
+                index += 2;
+            }
+        }
+    }
+
+    return header.k;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class Checkpoint<float>;
+template class Checkpoint<double>;
+template class Checkpoint< std::complex<float> >;
+template class Checkpoint< std::complex<double> >;
+
+} // namespace internal
+} // namespace slate
@@ -0,0 +1,123 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_INTERNAL_CHECKPOINT_HH
+#define SLATE_INTERNAL_CHECKPOINT_HH
+
+#include "slate/Matrix.hh"
+#include "slate/types.hh"
+#include "internal/internal_io.hh"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Header of the checkpoint metadata file, `<prefix>.meta`.
+/// The header is followed by num_pivots pairs of int64_t,
+/// (tile index, element offset), of the pivots of completed panels.
+/// The metadata is written by rank 0 only after all data files of the
+/// checkpoint are complete, and is renamed into place atomically,
+/// so it always describes a complete checkpoint.
+///
+struct CheckpointHeader {
+    char    magic[ 8 ];     ///< "SLATECKP"
+    int32_t version;        ///< checkpoint format version, currently 1
+    char    precision;      ///< 's', 'd', 'c', 'z'
+    char    uplo;           ///< stored triangle of A, 'L', 'U', 'G'
+    char    reserved[ 2 ];
+    char    routine[ 8 ];   ///< "potrf", "getrf", "geqrf", null padded
+    int64_t k;              ///< number of completed block columns
+    int64_t slot;           ///< data files are `<prefix>.<slot>.*`
+    int64_t m;              ///< rows of A
+    int64_t n;              ///< cols of A
+    int64_t nb;             ///< tile cols of A
+    int64_t num_pivots;     ///< number of pivots following the header
+};
+
+//------------------------------------------------------------------------------
+/// Asynchronous checkpoint of a right-looking factorization, saved at
+/// block column boundaries every Option::CheckpointInterval panels.
+///
+/// save() copies the local tiles of A (and T) into host snapshot matrices,
+/// then starts nonblocking collective writes of the snapshots, so the
+/// factorization continues while the data is written. The writes are
+/// completed at the next save() or at finish(). Two slots are used
+/// alternately, so the previous checkpoint stays valid until the next
+/// one is complete.
+///
+/// The snapshots require host memory equal to the local part of A (and T).
+///
+template <typename scalar_t>
+class Checkpoint {
+public:
+    Checkpoint( char const* routine, Options const& opts, int64_t k_start,
+                MPI_Comm mpi_comm );
+    ~Checkpoint();
+
+    Checkpoint(Checkpoint const& orig) = delete;
+    Checkpoint& operator = (Checkpoint const& orig) = delete;
+
+    /// @return true if a checkpoint should be saved before panel k.
+    bool due( int64_t k ) const
+    {
+        return interval_ > 0 && k > k_start_ && k % interval_ == 0;
+    }
+
+    void save(
+        int64_t k, BaseMatrix<scalar_t>& A,
+        Pivots const* pivots = nullptr,
+        std::vector< Matrix<scalar_t> >* T = nullptr );
+
+    void finish();
+
+    static int64_t restore(
+        char const* routine, Options const& opts,
+        BaseMatrix<scalar_t>& A,
+        Pivots* pivots = nullptr,
+        std::vector< Matrix<scalar_t> >* T = nullptr );
+
+    static int64_t restart_column(
+        char const* routine, Options const& opts, MPI_Comm mpi_comm );
+
+private:
+    static void read_meta(
+        std::string const& prefix, char const* routine, MPI_Comm mpi_comm,
+        CheckpointHeader& header, std::vector<int64_t>* pivots );
+
+    void write_meta();
+
+    /// Snapshot files: A, and for QR the local and reduction T factors.
+    static const int max_files = 3;
+
+    std::string prefix_;
+    char routine_[ 8 ];
+    int64_t interval_;
+    int64_t k_start_;
+    MPI_Comm mpi_comm_;
+    int mpi_rank_;
+
+    // Snapshots of A and T, allocated at the first save.
+    std::vector< Matrix<scalar_t> > snapshots_;
+    IORequest requests_[ max_files ];
+
+    // Checkpoint being written: block column, slot, and pivots.
+    int64_t pending_k_;
+    int64_t slot_;
+    std::vector<int64_t> pending_pivots_;
+    int64_t m_, n_, nb_;
+    Uplo uplo_;
+};
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_CHECKPOINT_HH
@@ -0,0 +1,195 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/types.hh"
+#include "internal/internal.hh"
+#include "tile/gemm_compensated.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// General matrix multiply with compensated accumulation, for a rank-nb
+/// update:
+///     $C + C_{lo} = \alpha A B + C + C_{lo}$,
+///     $C_{abs} = |\alpha| |A| |B| + C_{abs}$,
+/// where $A$ is a single block column and $B$ a single block row.
+/// Remote tiles are not released; the caller erases them.
+/// Dispatches to target implementations.
+/// @ingroup gemm_internal
+///
+template <Target target, typename scalar_t>
+void gemm_compensated(scalar_t alpha, Matrix<scalar_t>&& A,
+                                      Matrix<scalar_t>&& B,
+                                      Matrix<scalar_t>&& C,
+                                      Matrix<scalar_t>&& C_lo,
+                                      Matrix<scalar_t>&& C_abs,
+                      int priority)
+{
+    assert(A.nt() == 1 && B.mt() == 1);
+    auto get_A = [&A]( int64_t i ) {
+        A.tileGetForReading( i, 0, LayoutConvert::ColMajor );
+        return A( i, 0 );
+    };
+    gemm_compensated(internal::TargetType<target>(),
+                     alpha, get_A, B, C, C_lo, C_abs,
+                     priority);
+}
+
+//------------------------------------------------------------------------------
+/// Hermitian matrix multiply with compensated accumulation, for the
+/// rank-nb update with block column k of $A$:
+///     $C + C_{lo} = \alpha A(:, k) B + C + C_{lo}$,
+///     $C_{abs} = |\alpha| |A(:, k)| |B| + C_{abs}$,
+/// where $B$ is a single block row.
+/// Tiles of block column k outside the stored triangle are taken as
+/// the conjugate-transpose of tiles in block row k.
+/// Dispatches to target implementations.
+/// @ingroup gemm_internal
+///
+template <Target target, typename scalar_t>
+void hemm_compensated(scalar_t alpha, HermitianMatrix<scalar_t>&& A,
+                      int64_t k,      Matrix<scalar_t>&& B,
+                                      Matrix<scalar_t>&& C,
+                                      Matrix<scalar_t>&& C_lo,
+                                      Matrix<scalar_t>&& C_abs,
+                      int priority)
+{
+    assert(B.mt() == 1);
+    Uplo uplo = A.uplo();
+    auto get_A = [&A, k, uplo]( int64_t i ) {
+        if (i == k || (uplo == Uplo::Lower) == (i > k)) {
+            A.tileGetForReading( i, k, LayoutConvert::ColMajor );
+            return A( i, k );
+        }
+        else {
+            A.tileGetForReading( k, i, LayoutConvert::ColMajor );
+            return conj_transpose( A( k, i ) );
+        }
+    };
+    gemm_compensated(internal::TargetType<target>(),
+                     alpha, get_A, B, C, C_lo, C_abs,
+                     priority);
+}
+
+//------------------------------------------------------------------------------
+/// Matrix multiply with compensated accumulation.
+/// Host OpenMP task implementation.
+/// get_A( i ) returns tile i of the block column of $A$.
+/// @ingroup gemm_internal
+///
+template <typename scalar_t, typename get_tile_t>
+void gemm_compensated(internal::TargetType<Target::HostTask>,
+                      scalar_t alpha, get_tile_t& get_A,
+                                      Matrix<scalar_t>& B,
+                                      Matrix<scalar_t>& C,
+                                      Matrix<scalar_t>& C_lo,
+                                      Matrix<scalar_t>& C_abs,
+                      int priority)
+{
+    const LayoutConvert layout = LayoutConvert::ColMajor;
+
+    #pragma omp taskgroup
+    for (int64_t i = 0; i < C.mt(); ++i) {
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            if (C.tileIsLocal( i, j )) {
+                #pragma omp task slate_omp_default_none \
+                    shared( get_A, B, C, C_lo, C_abs ) \
+                    firstprivate( i, j, layout, alpha ) \
+                    priority( priority )
+                {
+                    B.tileGetForReading( 0, j, layout );
+                    C.tileGetForWriting( i, j, layout );
+                    C_lo.tileGetForWriting( i, j, layout );
+                    C_abs.tileGetForWriting( i, j, layout );
+                    tile::gemm_compensated(
+                        alpha, get_A( i ), B( 0, j ),
+                        C( i, j ), C_lo( i, j ), C_abs( i, j ) );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void gemm_compensated<Target::HostTask, float>(
+    float alpha, Matrix<float>&& A,
+                 Matrix<float>&& B,
+                 Matrix<float>&& C,
+                 Matrix<float>&& C_lo,
+                 Matrix<float>&& C_abs,
+    int priority);
+
+template
+void gemm_compensated<Target::HostTask, double>(
+    double alpha, Matrix<double>&& A,
+                  Matrix<double>&& B,
+                  Matrix<double>&& C,
+                  Matrix<double>&& C_lo,
+                  Matrix<double>&& C_abs,
+    int priority);
+
+template
+void gemm_compensated< Target::HostTask, std::complex<float> >(
+    std::complex<float> alpha, Matrix< std::complex<float> >&& A,
+                               Matrix< std::complex<float> >&& B,
+                               Matrix< std::complex<float> >&& C,
+                               Matrix< std::complex<float> >&& C_lo,
+                               Matrix< std::complex<float> >&& C_abs,
+    int priority);
+
+template
+void gemm_compensated< Target::HostTask, std::complex<double> >(
+    std::complex<double> alpha, Matrix< std::complex<double> >&& A,
+                                Matrix< std::complex<double> >&& B,
+                                Matrix< std::complex<double> >&& C,
+                                Matrix< std::complex<double> >&& C_lo,
+                                Matrix< std::complex<double> >&& C_abs,
+    int priority);
+
+// ----------------------------------------
+template
+void hemm_compensated<Target::HostTask, float>(
+    float alpha, HermitianMatrix<float>&& A,
+    int64_t k,   Matrix<float>&& B,
+                 Matrix<float>&& C,
+                 Matrix<float>&& C_lo,
+                 Matrix<float>&& C_abs,
+    int priority);
+
+template
+void hemm_compensated<Target::HostTask, double>(
+    double alpha, HermitianMatrix<double>&& A,
+    int64_t k,    Matrix<double>&& B,
+                  Matrix<double>&& C,
+                  Matrix<double>&& C_lo,
+                  Matrix<double>&& C_abs,
+    int priority);
+
+template
+void hemm_compensated< Target::HostTask, std::complex<float> >(
+    std::complex<float> alpha, HermitianMatrix< std::complex<float> >&& A,
+    int64_t k,                 Matrix< std::complex<float> >&& B,
+                               Matrix< std::complex<float> >&& C,
+                               Matrix< std::complex<float> >&& C_lo,
+                               Matrix< std::complex<float> >&& C_abs,
+    int priority);
+
+template
+void hemm_compensated< Target::HostTask, std::complex<double> >(
+    std::complex<double> alpha, HermitianMatrix< std::complex<double> >&& A,
+    int64_t k,                  Matrix< std::complex<double> >&& B,
+                                Matrix< std::complex<double> >&& C,
+                                Matrix< std::complex<double> >&& C_lo,
+                                Matrix< std::complex<double> >&& C_abs,
+    int priority);
+
+} // namespace internal
+} // namespace slate
@@ -135,9 +135,9 @@ void scale_row_col(
                 lda[q] = 0;
                 mb[q] = A.tileMb( irange[q][0] );
                 nb[q] = A.tileNb( jrange[q][0] );
-                int ii = A.tileMb( 0 ) * irange[q][0];
+                int64_t ii = A.tileRowOffset( irange[q][0] );
                 for (int64_t i = irange[q][0]; i < irange[q][1]; ++i) {
-                    int jj = A.tileNb( 0 ) * jrange[q][0];
+                    int64_t jj = A.tileColOffset( jrange[q][0] );
                     for (int64_t j = jrange[q][0]; j < jrange[q][1]; ++j) {
                         if (A.tileIsLocal(i, j) && device == A.tileDevice(i, j)) {
                             auto Aij = A( i, j, device );
@@ -132,6 +132,8 @@ void he2hb_trmm(
             int rank_upper = -1;
 
             for (int64_t i = 0; i < B.mt(); ++i) {
+                rank_lower = -1;
+                rank_upper = -1;
                 for (int64_t j : panel_rank_rows) {
                     if (i >= j) { // lower
                         rank_lower = AH.tileRank( i, j );
@@ -187,6 +189,8 @@ void he2hb_trmm(
                 rank_upper = -1;
 
                 for (int64_t i = 0; i < i_interior; ++i) {
+                    rank_lower = -1;
+                    rank_upper = -1;
                     for (int64_t j : panel_rank_rows) {
                         if (i >= j) { // lower
                             rank_lower = AH.tileRank( i, j );
@@ -62,6 +62,12 @@ void hettmqr(
 /// Distributed multiply Hermitian matrix on left and right by Q from
 /// QR triangle-triangle factorization of column of tiles.
 /// Host implementation.
+/// Within a level, messages are nonblocking and each tile is updated as
+/// soon as its pair arrives. Unlike ttmqr, levels are not pipelined:
+/// since only the lower triangle is stored, step 3 of a level reads tiles
+/// that step 2 updated in other rows, as well as the diagonal tiles of
+/// step 1, so each level (and step 2 within it) finishes all its
+/// messages before the next one starts.
 /// @ingroup heev_internal
 ///
 template <typename scalar_t>
@@ -134,6 +140,17 @@ void hettmqr(
     // ^H are temporary conj-transposed copies, and
     // (*) shows where conj-transposed tiles come from.
 
+    int mpi_rank = C.mpiRank();
+
+    // Local tile C(i, j) of a pair in steps 2 and 3. The pair's other tile
+    // is in row k (step 2) or column k (step 3), on rank rank.
+    // Communication for column j (step 2) or row i (step 3) uses tag + j
+    // or tag + i, so the columns or rows proceed independently.
+    struct PairTile {
+        int64_t i, j, k;
+        int rank;
+    };
+
     for (int level = 0; level < nlevels; ++level) {
         // index is first node of each pair.
         for (int index = 0; index + step < nranks; index += 2*step) {
@@ -189,52 +206,102 @@ void hettmqr(
                 C.tileTick(i2, i2);
                 C.tileErase(i1, i2);  // Discard results; equals C(i2, i1)^H.
             }
+        } // for index
 
-            //--------------------
-            // 2: Multiply Q^H * [ C(i1, j) ] for j = 0, ..., i1-1,
-            //                   [ C(i2, j) ]         i1+1, ..., i2-1.
-            // Note j = i1 is skipped because it is handled in step 1 above.
-            // If  C(i1, j) is in upper triangle (i1 < j),
-            // use C(i1, j) = C(j, i1)^H.
-            // TODO: the j loop can be parallelized, with care for MPI.
-            // the j loop splited into three loops:
-            // first loop : send tiles to dst
-            // second loop: applies Q (tpmqrt)
-            // third loop:  send back the updated tiles
-            for (int64_t j = 0; j < i2; ++j) {
-                if (j == i1)
-                    continue;
-
-                if ((i1 >= j && C.tileIsLocal(i1, j)) ||
-                    (i1 <  j && C.tileIsLocal(j, i1))) {
-                    // First node of each pair sends tile to dst.
-                    int dst = C.tileRank(i2, j);
-                    if (i1 >= j) {
-                        C.tileSend(i1, j, dst, tag);
+        //--------------------
+        // 2: Multiply Q^H * [ C(i1, j) ] for j = 0, ..., i1-1,
+        //                   [ C(i2, j) ]         i1+1, ..., i2-1,
+        // for all pairs of this level at once, since pairs update
+        // disjoint rows.
+        // Note j = i1 is skipped because it is handled in step 1 above.
+        // If  C(i1, j) is in upper triangle (i1 < j),
+        // use C(i1, j) = C(j, i1)^H.
+        // All sends and receives are posted first; Q is applied to each
+        // C(i2, j) as soon as C(i1, j) arrives, then C(i1, j) is sent back.
+        {
+            // src_tiles: local C(i1, j) with k = i2, sent to rank.
+            // dst_tiles: local C(i2, j) with k = i1, receives C(i1, j)
+            //            from rank.
+            std::vector<PairTile> src_tiles, dst_tiles;
+            for (int index = 0; index + step < nranks; index += 2*step) {
+                int64_t i1 = rank_indices[ index ].second;
+                int64_t i2 = rank_indices[ index + step ].second;
+                for (int64_t j = 0; j < i2; ++j) {
+                    if (j == i1)
+                        continue;
+
+                    if ((i1 >= j && C.tileIsLocal(i1, j)) ||
+                        (i1 <  j && C.tileIsLocal(j, i1))) {
+                        src_tiles.push_back( { i1, j, i2, C.tileRank(i2, j) } );
                     }
-                    else {
-                        // Send transposed tile.
-                        tile::deepConjTranspose( C(j, i1) );
-                        C.tileSend(j, i1, dst, tag);
+                    if (C.tileIsLocal(i2, j)) {
+                        int src = (i1 >= j
+                                  ? C.tileRank(i1, j)
+                                  : C.tileRank(j, i1));
+                        dst_tiles.push_back( { i2, j, i1, src } );
                     }
                 }
-                else if (C.tileIsLocal(i2, j)) {
-                    // Second node of each pair receives tile from src.
-                    int src = (i1 >= j
-                              ? C.tileRank(i1, j)
-                              : C.tileRank(j, i1));
-                    C.tileRecv(i1, j, src, layout, tag);
+            }
+            int64_t nsrc = src_tiles.size();
+            int64_t ndst = dst_tiles.size();
+            std::vector<MPI_Request> src_requests( nsrc );
+            std::vector<MPI_Request> dst_requests( ndst );
+            std::vector<MPI_Request> dst_back_requests( ndst, MPI_REQUEST_NULL );
+
+            for (int64_t n = 0; n < nsrc; ++n) {
+                int64_t i1 = src_tiles[ n ].i;
+                int64_t j  = src_tiles[ n ].j;
+                int dst = src_tiles[ n ].rank;
+                // First node of each pair sends tile to dst.
+                if (i1 >= j) {
+                    C.tileGetForWriting(i1, j, LayoutConvert(layout));
+                    C.tileIsend(i1, j, dst, tag + j, &src_requests[ n ]);
+                }
+                else {
+                    // Send transposed tile.
+                    C.tileGetForWriting(j, i1, LayoutConvert(layout));
+                    tile::deepConjTranspose( C(j, i1) );
+                    C.tileIsend(j, i1, dst, tag + j, &src_requests[ n ]);
                 }
-            } // for j
+            }
+            for (int64_t n = 0; n < ndst; ++n) {
+                // Second node of each pair receives tile from src.
+                auto& t = dst_tiles[ n ];
+                C.tileIrecv(t.k, t.j, t.rank, layout, tag + t.j,
+                            &dst_requests[ n ]);
+            }
 
-            for (int64_t j = 0; j < i2; ++j) {
-                if (j == i1)
-                    continue;
+            std::vector<int64_t> local_pairs;
+            for (int64_t n = 0; n < ndst; ++n) {
+                if (dst_tiles[ n ].rank == mpi_rank)
+                    local_pairs.push_back( n );
+            }
+            int64_t nlocal = local_pairs.size();
+
+            #pragma omp taskgroup
+            {
+                for (int64_t count = 0; count < ndst; ++count) {
+                    int64_t n;
+                    if (count < nlocal) {
+                        n = local_pairs[ count ];
+                    }
+                    else {
+                        int index;
+                        slate_mpi_call(
+                            MPI_Waitany(ndst, dst_requests.data(), &index,
+                                        MPI_STATUS_IGNORE));
+                        n = index;
+                    }
 
-                if (C.tileIsLocal(i2, j)) {
                     // Applies Q, then sends updated tile back.
-                    #pragma omp task shared(V, T, C)
+                    #pragma omp task slate_omp_default_none \
+                        shared( V, T, C, dst_tiles, dst_back_requests ) \
+                        firstprivate( n, layout, op, tag )
                     {
+                        int64_t i2 = dst_tiles[ n ].i;
+                        int64_t j  = dst_tiles[ n ].j;
+                        int64_t i1 = dst_tiles[ n ].k;
+                        int src = dst_tiles[ n ].rank;
                         V.tileGetForReading(i2, 0, LayoutConvert(layout));
                         T.tileGetForReading(i2, 0, LayoutConvert(layout));
                         C.tileGetForWriting(i2, j, LayoutConvert(layout));
@@ -247,68 +314,126 @@ void hettmqr(
                         // todo: should tileRelease()?
                         V.tileTick(i2, 0);
                         T.tileTick(i2, 0);
-                    }
-                }
-            } // for j
-            #pragma omp taskwait
-
-            for (int64_t j = 0; j < i2; ++j) {
-                if (j == i1)
-                    continue;
 
-                if ((i1 >= j && C.tileIsLocal(i1, j)) ||
-                    (i1 <  j && C.tileIsLocal(j, i1))) {
-                    // Receives updated tile back ().
-                    int dst = C.tileRank(i2, j);
+                        // Send updated tile back.
+                        C.tileIsend(i1, j, src, tag + j,
+                                    &dst_back_requests[ n ]);
+                    }
+                } // for count
+
+                // Once tiles are sent, post receives for updated tiles.
+                slate_mpi_call(
+                    MPI_Waitall(nsrc, src_requests.data(),
+                                MPI_STATUSES_IGNORE));
+                for (int64_t n = 0; n < nsrc; ++n) {
+                    int64_t i1 = src_tiles[ n ].i;
+                    int64_t j  = src_tiles[ n ].j;
+                    int dst = src_tiles[ n ].rank;
                     if (i1 >= j) {
-                        C.tileRecv(i1, j, dst, layout, tag);
+                        C.tileIrecv(i1, j, dst, layout, tag + j,
+                                    &src_requests[ n ]);
                     }
                     else {
-                        C.tileRecv(j, i1, dst, layout, tag);
-                        tile::deepConjTranspose(C(j, i1));
+                        C.tileIrecv(j, i1, dst, layout, tag + j,
+                                    &src_requests[ n ]);
                     }
                 }
-                else if (C.tileIsLocal(i2, j)) {
-                    // Sends updated tile back.
-                    int src = (i1 >= j
-                              ? C.tileRank(i1, j)
-                              : C.tileRank(j, i1));
-                    // Send updated tile back.
-                    C.tileSend(i1, j, src, tag);
-                    C.tileTick(i1, j);
-                }
-            } // for j
-        } // for index
+            }
+
+            // The next level pairs tiles updated in this one, so levels
+            // do not overlap: finish all of this level's messages first.
+            slate_mpi_call(
+                MPI_Waitall(nsrc, src_requests.data(),
+                            MPI_STATUSES_IGNORE));
+            slate_mpi_call(
+                MPI_Waitall(ndst, dst_back_requests.data(),
+                            MPI_STATUSES_IGNORE));
+            for (auto& t : src_tiles) {
+                if (t.i < t.j)
+                    tile::deepConjTranspose( C(t.j, t.i) );
+            }
+            for (auto& t : dst_tiles) {
+                if (t.rank != mpi_rank)
+                    C.tileTick(t.k, t.j);
+            }
+        }
 
         //--------------------
         // Finish updating all rows before updating columns.
         slate_mpi_call(
             MPI_Barrier(C.mpiComm()));
 
-        for (int index = 0; index + step < nranks; index += 2*step) {
-            int64_t j1 = rank_indices[ index ].second;
-            int64_t j2 = rank_indices[ index + step ].second;
-
-            //--------------------
-            // 3: Multiply [ C(i, j1)  C(i, j2) ] * Q for i = j2+1, ..., mt-1.
-            for (int64_t i = j2+1; i < C.mt(); ++i) {
-                if (C.tileIsLocal(i, j1)) {
-                    // First node of each pair sends tile to dst.
-                    int dst = C.tileRank(i, j2);
-                    C.tileSend(i, j1, dst, tag);
-                }
-                else if (C.tileIsLocal(i, j2)) {
-                    // Second node of each pair receives tile from src.
-                    int src = C.tileRank(i, j1);
-                    C.tileRecv(i, j1, src, layout, tag);
+        //--------------------
+        // 3: Multiply [ C(i, j1)  C(i, j2) ] * Q for i = j2+1, ..., mt-1,
+        // for all pairs of this level at once, since pairs update
+        // disjoint columns.
+        {
+            // src_tiles: local C(i, j1) with k = j2, sent to rank.
+            // dst_tiles: local C(i, j2) with k = j1, receives C(i, j1)
+            //            from rank.
+            std::vector<PairTile> src_tiles, dst_tiles;
+            for (int index = 0; index + step < nranks; index += 2*step) {
+                int64_t j1 = rank_indices[ index ].second;
+                int64_t j2 = rank_indices[ index + step ].second;
+                for (int64_t i = j2+1; i < C.mt(); ++i) {
+                    if (C.tileIsLocal(i, j1)) {
+                        src_tiles.push_back( { i, j1, j2, C.tileRank(i, j2) } );
+                    }
+                    if (C.tileIsLocal(i, j2)) {
+                        dst_tiles.push_back( { i, j2, j1, C.tileRank(i, j1) } );
+                    }
                 }
-            } // for i
+            }
+            int64_t nsrc = src_tiles.size();
+            int64_t ndst = dst_tiles.size();
+            std::vector<MPI_Request> src_requests( nsrc );
+            std::vector<MPI_Request> dst_requests( ndst );
+            std::vector<MPI_Request> dst_back_requests( ndst, MPI_REQUEST_NULL );
+
+            for (int64_t n = 0; n < nsrc; ++n) {
+                // First node of each pair sends tile to dst.
+                auto& t = src_tiles[ n ];
+                C.tileGetForWriting(t.i, t.j, LayoutConvert(layout));
+                C.tileIsend(t.i, t.j, t.rank, tag + t.i, &src_requests[ n ]);
+            }
+            for (int64_t n = 0; n < ndst; ++n) {
+                // Second node of each pair receives tile from src.
+                auto& t = dst_tiles[ n ];
+                C.tileIrecv(t.i, t.k, t.rank, layout, tag + t.i,
+                            &dst_requests[ n ]);
+            }
+
+            std::vector<int64_t> local_pairs;
+            for (int64_t n = 0; n < ndst; ++n) {
+                if (dst_tiles[ n ].rank == mpi_rank)
+                    local_pairs.push_back( n );
+            }
+            int64_t nlocal = local_pairs.size();
+
+            #pragma omp taskgroup
+            {
+                for (int64_t count = 0; count < ndst; ++count) {
+                    int64_t n;
+                    if (count < nlocal) {
+                        n = local_pairs[ count ];
+                    }
+                    else {
+                        int index;
+                        slate_mpi_call(
+                            MPI_Waitany(ndst, dst_requests.data(), &index,
+                                        MPI_STATUS_IGNORE));
+                        n = index;
+                    }
 
-            for (int64_t i = j2+1; i < C.mt(); ++i) {
-                if (C.tileIsLocal(i, j2)) {
                     // Applies Q, then sends updated tile back.
-                    #pragma omp task shared(V, T, C)
+                    #pragma omp task slate_omp_default_none \
+                        shared( V, T, C, dst_tiles, dst_back_requests ) \
+                        firstprivate( n, layout, opR, tag )
                     {
+                        int64_t i  = dst_tiles[ n ].i;
+                        int64_t j2 = dst_tiles[ n ].j;
+                        int64_t j1 = dst_tiles[ n ].k;
+                        int src = dst_tiles[ n ].rank;
                         V.tileGetForReading(j2, 0, LayoutConvert(layout));
                         T.tileGetForReading(j2, 0, LayoutConvert(layout));
                         C.tileGetForWriting(i, j2, LayoutConvert(layout));
@@ -320,26 +445,37 @@ void hettmqr(
                         // todo: should tileRelease()?
                         V.tileTick(j2, 0);
                         T.tileTick(j2, 0);
+
+                        // Send updated tile back.
+                        C.tileIsend(i, j1, src, tag + i,
+                                    &dst_back_requests[ n ]);
                     }
+                } // for count
+
+                // Once tiles are sent, post receives for updated tiles.
+                slate_mpi_call(
+                    MPI_Waitall(nsrc, src_requests.data(),
+                                MPI_STATUSES_IGNORE));
+                for (int64_t n = 0; n < nsrc; ++n) {
+                    auto& t = src_tiles[ n ];
+                    C.tileIrecv(t.i, t.j, t.rank, layout, tag + t.i,
+                                &src_requests[ n ]);
                 }
-            } // for i
-            #pragma omp taskwait
-
-            for (int64_t i = j2+1; i < C.mt(); ++i) {
-                if (C.tileIsLocal(i, j1)) {
-                    // Receives updated tile back.
-                    int dst = C.tileRank(i, j2);
-                    C.tileRecv(i, j1, dst, layout, tag);
-                }
-                else if (C.tileIsLocal(i, j2)) {
-                    int src = C.tileRank(i, j1);
+            }
 
-                    // Send updated tile back.
-                    C.tileSend(i, j1, src, tag);
-                    C.tileTick(i, j1);
-                }
-            } // for i
-        } // for index
+            // The next level pairs tiles updated in this one, so levels
+            // do not overlap: finish all of this level's messages first.
+            slate_mpi_call(
+                MPI_Waitall(nsrc, src_requests.data(),
+                            MPI_STATUSES_IGNORE));
+            slate_mpi_call(
+                MPI_Waitall(ndst, dst_back_requests.data(),
+                            MPI_STATUSES_IGNORE));
+            for (auto& t : dst_tiles) {
+                if (t.rank != mpi_rank)
+                    C.tileTick(t.i, t.k);
+            }
+        }
 
         //--------------------
         // Next level.
@@ -0,0 +1,482 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Matrix.hh"
+#include "slate/types.hh"
+#include "internal/internal_io.hh"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <>
+char precision_char<float>() { return 's'; }
+
+template <>
+char precision_char<double>() { return 'd'; }
+
+template <>
+char precision_char< std::complex<float> >() { return 'c'; }
+
+template <>
+char precision_char< std::complex<double> >() { return 'z'; }
+
+//------------------------------------------------------------------------------
+IORequest::IORequest()
+    :
+#ifndef SLATE_NO_MPI
+      file_(MPI_FILE_NULL),
+      request_(MPI_REQUEST_NULL),
+      memtype_(MPI_DATATYPE_NULL),
+      filetype_(MPI_DATATYPE_NULL),
+#endif
+      active_(false)
+{}
+
+//------------------------------------------------------------------------------
+IORequest::~IORequest()
+{
+    // Destructors must not throw; errors are reported by an explicit wait().
+    try {
+        wait();
+    }
+    catch (...) {
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Waits for the I/O operation to complete, then frees the datatypes and
+/// closes the file. Collective over the file's communicator.
+///
+void IORequest::wait()
+{
+    if (! active_)
+        return;
+    active_ = false;
+
+#ifndef SLATE_NO_MPI
+    slate_mpi_call(
+        MPI_Wait( &request_, MPI_STATUS_IGNORE ));
+    if (memtype_ != MPI_DATATYPE_NULL) {
+        slate_mpi_call(
+            MPI_Type_free( &memtype_ ));
+    }
+    if (filetype_ != MPI_DATATYPE_NULL) {
+        slate_mpi_call(
+            MPI_Type_free( &filetype_ ));
+    }
+    slate_mpi_call(
+        MPI_File_close( &file_ ));
+#endif
+}
+
+#ifndef SLATE_NO_MPI
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Contiguous run of elements, both in the file and in memory.
+struct Segment {
+    int64_t offset;     ///< element offset in file, from start of data
+    char* address;      ///< address in memory
+    int64_t count;      ///< number of elements
+};
+
+//------------------------------------------------------------------------------
+/// Appends segments for rows [ row, row + len ) of column col of the global
+/// m-by-n matrix, whose elements are contiguous in memory at address.
+/// For FileFormat::Tiled, the column is split at the boundaries of the
+/// file's mb-by-nb tiles, which need not match the matrix's tiles.
+///
+template <typename scalar_t>
+void append_segments(
+    FileFormat format, int64_t m, int64_t n, int64_t mb, int64_t nb,
+    int64_t row, int64_t col, int64_t len, scalar_t* address,
+    std::vector<Segment>& segments)
+{
+    if (format == FileFormat::ColMajor) {
+        segments.push_back( { col*m + row, (char*) address, len } );
+        return;
+    }
+
+    // File tile holding column col, and that column's offset within it.
+    int64_t jf  = col / nb;
+    int64_t jj  = col % nb;
+    int64_t nbf = std::min( nb, n - jf*nb );
+    while (len > 0) {
+        int64_t i_f = row / mb;
+        int64_t ii  = row % mb;
+        int64_t mbf = std::min( mb, m - i_f*mb );
+        int64_t cnt = std::min( len, mbf - ii );
+        // Block col jf starts at element jf*nb*m; tile i_f within it
+        // starts i_f*mb*nbf later; column jj is jj*mbf into the tile.
+        int64_t offset = jf*nb*m + i_f*mb*nbf + jj*mbf + ii;
+        segments.push_back( { offset, (char*) address, cnt } );
+        row     += cnt;
+        len     -= cnt;
+        address += cnt;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Builds the segments of all local tiles of A, sorted by file offset,
+/// merging runs that are contiguous in both the file and memory.
+/// Tiles must be on the host in column-major layout.
+///
+template <typename scalar_t>
+void local_segments(
+    Matrix<scalar_t>& A, FileFormat format, int64_t mb, int64_t nb,
+    std::vector<Segment>& segments)
+{
+    int64_t m = A.m();
+    int64_t n = A.n();
+    segments.clear();
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        int64_t col0 = A.tileColOffset( j );
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto T = A( i, j );
+                assert( T.layout() == Layout::ColMajor );
+                int64_t row0 = A.tileRowOffset( i );
+                for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                    append_segments(
+                        format, m, n, mb, nb, row0, col0 + jj, T.mb(),
+                        &T.at( 0, jj ), segments );
+                }
+            }
+        }
+    }
+
+    std::sort( segments.begin(), segments.end(),
+               [](Segment const& a, Segment const& b) {
+                   return a.offset < b.offset;
+               });
+
+    // Merge contiguous runs, keeping counts within MPI's int limit.
+    size_t k = 0;
+    for (size_t s = 1; s < segments.size(); ++s) {
+        Segment& prev = segments[ k ];
+        Segment& next = segments[ s ];
+        if (prev.offset + prev.count == next.offset
+            && prev.address + prev.count*sizeof(scalar_t) == next.address
+            && prev.count + next.count <= INT_MAX) {
+            prev.count += next.count;
+        }
+        else {
+            segments[ ++k ] = next;
+        }
+    }
+    if (! segments.empty())
+        segments.resize( k + 1 );
+}
+
+//------------------------------------------------------------------------------
+/// Sets the file view to the segments owned by this rank and starts
+/// a nonblocking collective read or write of the local tiles.
+///
+template <typename scalar_t>
+void start_io(
+    Matrix<scalar_t>& A, FileFormat format, int64_t mb, int64_t nb,
+    MPI_Offset data_offset, bool writing, IORequest& request)
+{
+    MPI_Datatype etype = mpi_type<scalar_t>::value;
+
+    std::vector<Segment> segments;
+    local_segments( A, format, mb, nb, segments );
+
+    int count = segments.size();
+    slate_assert( size_t( count ) == segments.size() );
+    if (count > 0) {
+        std::vector<int> counts( count );
+        std::vector<MPI_Aint> file_disps( count );
+        std::vector<MPI_Aint> mem_disps( count );
+        for (int s = 0; s < count; ++s) {
+            counts[ s ] = segments[ s ].count;
+            file_disps[ s ] = segments[ s ].offset * sizeof(scalar_t);
+            slate_mpi_call(
+                MPI_Get_address( segments[ s ].address, &mem_disps[ s ] ));
+        }
+        slate_mpi_call(
+            MPI_Type_create_hindexed(
+                count, counts.data(), file_disps.data(), etype,
+                &request.filetype_ ));
+        slate_mpi_call(
+            MPI_Type_commit( &request.filetype_ ));
+        slate_mpi_call(
+            MPI_Type_create_hindexed(
+                count, counts.data(), mem_disps.data(), etype,
+                &request.memtype_ ));
+        slate_mpi_call(
+            MPI_Type_commit( &request.memtype_ ));
+    }
+
+    // Setting the view is collective, so ranks without tiles participate
+    // with a plain view and a zero-length transfer.
+    slate_mpi_call(
+        MPI_File_set_view(
+            request.file_, data_offset, etype,
+            count > 0 ? request.filetype_ : etype,
+            "native", MPI_INFO_NULL ));
+
+    void* buffer = count > 0 ? MPI_BOTTOM : nullptr;
+    MPI_Datatype memtype = count > 0 ? request.memtype_ : etype;
+    int mem_count = count > 0 ? 1 : 0;
+    if (writing) {
+        slate_mpi_call(
+            MPI_File_iwrite_all(
+                request.file_, buffer, mem_count, memtype,
+                &request.request_ ));
+    }
+    else {
+        slate_mpi_call(
+            MPI_File_iread_all(
+                request.file_, buffer, mem_count, memtype,
+                &request.request_ ));
+    }
+    request.active_ = true;
+}
+
+} // namespace
+
+#endif // SLATE_NO_MPI
+
+//------------------------------------------------------------------------------
+/// Starts a nonblocking collective write of matrix A to a file.
+/// Collective over A's MPI communicator.
+/// Local tiles are converted to column-major on the host, then written
+/// directly from the tiles, without packing. The tiles must not be modified
+/// until request.wait() returns.
+///
+/// @param[in] filename
+///     File to write. Created or truncated.
+///
+/// @param[in] A
+///     The m-by-n matrix A to write. Transposed matrices are not supported.
+///
+/// @param[in] format
+///     FileFormat::Tiled or FileFormat::ColMajor.
+///
+/// @param[out] request
+///     Request to wait on.
+///
+template <typename scalar_t>
+void iwrite(
+    const char* filename, Matrix<scalar_t>& A,
+    FileFormat format, IORequest& request)
+{
+#ifndef SLATE_NO_MPI
+    if (A.op() != Op::NoTrans)
+        slate_not_implemented( "writing a transposed matrix" );
+
+    request.wait();
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t mb = std::max( int64_t( 1 ), std::min( A.tileMb( 0 ), m ) );
+    int64_t nb = std::max( int64_t( 1 ), std::min( A.tileNb( 0 ), n ) );
+
+    A.tileGetAllForReading( HostNum, LayoutConvert::ColMajor );
+
+    MPI_Comm comm = A.mpiComm();
+    slate_mpi_call(
+        MPI_File_open( comm, filename, MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                       MPI_INFO_NULL, &request.file_ ));
+    slate_mpi_call(
+        MPI_File_set_size( request.file_, 0 ));
+
+    MPI_Offset data_offset = 0;
+    if (format == FileFormat::Tiled) {
+        FileHeader header;
+        std::memset( &header, 0, sizeof(header) );
+        std::memcpy( header.magic, "SLATEMAT", sizeof(header.magic) );
+        header.version     = 1;
+        header.precision   = precision_char<scalar_t>();
+        header.layout      = 'C';
+        header.m           = m;
+        header.n           = n;
+        header.mb          = mb;
+        header.nb          = nb;
+        header.data_offset = sizeof(FileHeader);
+        data_offset = header.data_offset;
+
+        if (A.mpiRank() == 0) {
+            slate_mpi_call(
+                MPI_File_write_at( request.file_, 0, &header, sizeof(header),
+                                   MPI_BYTE, MPI_STATUS_IGNORE ));
+        }
+    }
+
+    start_io( A, format, mb, nb, data_offset, true, request );
+#else
+    slate_not_implemented( "matrix I/O requires MPI" );
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// Starts a nonblocking collective read of matrix A from a file.
+/// Collective over A's MPI communicator.
+/// Local tiles of A must already be allocated; they are read directly,
+/// without packing, and must not be accessed until request.wait() returns.
+/// The tile sizes of A need not match the tile sizes in the file.
+///
+/// @param[in] filename
+///     File to read.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A to read into. Transposed matrices are not supported.
+///     For FileFormat::Tiled, m, n, and precision must match the file.
+///
+/// @param[in] format
+///     FileFormat::Tiled or FileFormat::ColMajor.
+///
+/// @param[out] request
+///     Request to wait on.
+///
+template <typename scalar_t>
+void iread(
+    const char* filename, Matrix<scalar_t>& A,
+    FileFormat format, IORequest& request)
+{
+#ifndef SLATE_NO_MPI
+    if (A.op() != Op::NoTrans)
+        slate_not_implemented( "reading a transposed matrix" );
+
+    request.wait();
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t mb = m;
+    int64_t nb = n;
+    MPI_Offset data_offset = 0;
+    if (format == FileFormat::Tiled) {
+        FileHeader header;
+        read_header( filename, header, A.mpiComm() );
+        if (header.precision != precision_char<scalar_t>())
+            slate_error( std::string( "file precision '" )
+                         + header.precision + "' does not match matrix" );
+        if (header.m != m || header.n != n)
+            slate_error( "file dimensions do not match matrix" );
+        mb = header.mb;
+        nb = header.nb;
+        data_offset = header.data_offset;
+    }
+
+    A.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+
+    slate_mpi_call(
+        MPI_File_open( A.mpiComm(), filename, MPI_MODE_RDONLY,
+                       MPI_INFO_NULL, &request.file_ ));
+
+    start_io( A, format, mb, nb, data_offset, false, request );
+#else
+    slate_not_implemented( "matrix I/O requires MPI" );
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// Reads and validates the header of a FileFormat::Tiled file.
+/// Rank 0 reads the header and broadcasts it.
+/// Collective over mpi_comm.
+///
+void read_header(
+    const char* filename, FileHeader& header, MPI_Comm mpi_comm)
+{
+#ifndef SLATE_NO_MPI
+    int mpi_rank;
+    slate_mpi_call(
+        MPI_Comm_rank( mpi_comm, &mpi_rank ));
+
+    int ok = 1;
+    if (mpi_rank == 0) {
+        MPI_File file;
+        int err = MPI_File_open( MPI_COMM_SELF, filename, MPI_MODE_RDONLY,
+                                 MPI_INFO_NULL, &file );
+        if (err == MPI_SUCCESS) {
+            MPI_Status status;
+            int cnt = 0;
+            err = MPI_File_read_at( file, 0, &header, sizeof(header),
+                                    MPI_BYTE, &status );
+            if (err == MPI_SUCCESS)
+                MPI_Get_count( &status, MPI_BYTE, &cnt );
+            MPI_File_close( &file );
+            ok = (err == MPI_SUCCESS && cnt == int( sizeof(header) ));
+        }
+        else {
+            ok = 0;
+        }
+    }
+    slate_mpi_call(
+        MPI_Bcast( &ok, 1, MPI_INT, 0, mpi_comm ));
+    if (! ok)
+        slate_error( std::string( "cannot read header of " ) + filename );
+
+    slate_mpi_call(
+        MPI_Bcast( &header, sizeof(header), MPI_BYTE, 0, mpi_comm ));
+
+    if (std::memcmp( header.magic, "SLATEMAT", sizeof(header.magic) ) != 0)
+        slate_error( std::string( filename ) + " is not a SLATE matrix file" );
+    if (header.version != 1)
+        slate_error( "unsupported SLATE matrix file version "
+                     + std::to_string( header.version ) );
+    if (header.layout != 'C' || header.m < 0 || header.n < 0
+        || header.mb < 1 || header.nb < 1)
+        slate_error( std::string( "invalid header in " ) + filename );
+#else
+    slate_not_implemented( "matrix I/O requires MPI" );
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void iwrite<float>(
+    const char* filename, Matrix<float>& A,
+    FileFormat format, IORequest& request);
+
+template
+void iwrite<double>(
+    const char* filename, Matrix<double>& A,
+    FileFormat format, IORequest& request);
+
+template
+void iwrite< std::complex<float> >(
+    const char* filename, Matrix< std::complex<float> >& A,
+    FileFormat format, IORequest& request);
+
+template
+void iwrite< std::complex<double> >(
+    const char* filename, Matrix< std::complex<double> >& A,
+    FileFormat format, IORequest& request);
+
+// ----------------------------------------
+template
+void iread<float>(
+    const char* filename, Matrix<float>& A,
+    FileFormat format, IORequest& request);
+
+template
+void iread<double>(
+    const char* filename, Matrix<double>& A,
+    FileFormat format, IORequest& request);
+
+template
+void iread< std::complex<float> >(
+    const char* filename, Matrix< std::complex<float> >& A,
+    FileFormat format, IORequest& request);
+
+template
+void iread< std::complex<double> >(
+    const char* filename, Matrix< std::complex<double> >& A,
+    FileFormat format, IORequest& request);
+
+} // namespace internal
+} // namespace slate
@@ -0,0 +1,94 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_INTERNAL_IO_HH
+#define SLATE_INTERNAL_IO_HH
+
+#include "slate/Matrix.hh"
+#include "slate/types.hh"
+#include "slate/internal/mpi.hh"
+
+#include <cstdint>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Header of the SLATE tiled binary matrix file, FileFormat::Tiled.
+/// The header is followed by the m-by-n matrix stored as a grid of
+/// mb-by-nb tiles (last block row and col may be smaller).
+/// Block columns are stored one after another; within a block column,
+/// tiles are stored top to bottom; each tile is column-major with
+/// leading dimension equal to its number of rows.
+/// Values are stored in native byte order.
+///
+struct FileHeader {
+    char    magic[ 8 ];     ///< "SLATEMAT"
+    int32_t version;        ///< file format version, currently 1
+    char    precision;      ///< 's', 'd', 'c', 'z'
+    char    layout;         ///< layout of elements within tiles, 'C'
+    char    reserved1[ 2 ];
+    int64_t m;              ///< number of rows
+    int64_t n;              ///< number of cols
+    int64_t mb;             ///< tile rows
+    int64_t nb;             ///< tile cols
+    int64_t data_offset;    ///< byte offset of the data from start of file
+    char    reserved2[ 8 ];
+};
+
+static_assert( sizeof(FileHeader) == 64, "FileHeader must be 64 bytes" );
+
+//------------------------------------------------------------------------------
+/// State of a nonblocking collective matrix read or write,
+/// started by internal::iread or internal::iwrite.
+/// The matrix tiles involved must not be modified (iwrite) or accessed
+/// (iread) until wait() returns. The destructor waits if still active.
+///
+class IORequest {
+public:
+    IORequest();
+    ~IORequest();
+
+    IORequest(IORequest const& orig) = delete;
+    IORequest& operator = (IORequest const& orig) = delete;
+
+    void wait();
+
+    /// @return true if an I/O operation is in progress.
+    bool active() const { return active_; }
+
+#ifndef SLATE_NO_MPI
+    MPI_File file_;
+    MPI_Request request_;
+    MPI_Datatype memtype_;
+    MPI_Datatype filetype_;
+#endif
+    bool active_;
+};
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+char precision_char();
+
+template <typename scalar_t>
+void iwrite(
+    const char* filename, Matrix<scalar_t>& A,
+    FileFormat format, IORequest& request);
+
+template <typename scalar_t>
+void iread(
+    const char* filename, Matrix<scalar_t>& A,
+    FileFormat format, IORequest& request);
+
+void read_header(
+    const char* filename, FileHeader& header, MPI_Comm mpi_comm);
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_IO_HH
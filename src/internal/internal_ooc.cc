@@ -0,0 +1,289 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/mpi.hh"
+#include "internal/internal_ooc.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace slate {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Reads or writes bytes at offset, retrying partial transfers.
+void transfer_bytes(
+    bool is_read, int fd, char* buf, size_t bytes, int64_t offset )
+{
+    while (bytes > 0) {
+        ssize_t count = is_read ? ::pread(  fd, buf, bytes, offset )
+                                : ::pwrite( fd, buf, bytes, offset );
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count < 0)
+            slate_error( std::string( "out-of-core tile I/O failed: " )
+                         + std::strerror( errno ) );
+        if (count == 0)
+            slate_error( "out-of-core tile file is too short" );
+        buf    += count;
+        bytes  -= count;
+        offset += count;
+    }
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Reads or writes one tile, which is contiguous in the file.
+template <typename scalar_t>
+void TileFile<scalar_t>::Segment::transfer( bool is_read, int fd ) const
+{
+    if (stride == mb) {
+        transfer_bytes( is_read, fd, (char*) data,
+                        mb*nb*sizeof(scalar_t), offset );
+    }
+    else {
+        for (int64_t c = 0; c < nb; ++c) {
+            transfer_bytes( is_read, fd, (char*) (data + c*stride),
+                            mb*sizeof(scalar_t),
+                            offset + c*mb*sizeof(scalar_t) );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Opens (creating if needed) the per-rank tile file of A, and computes
+/// the offsets of its local tiles.
+///
+/// @param[in] A
+///     Matrix whose local tiles are held in the file. Not transposed.
+///
+/// @param[in] opts
+///     Option::OutOfCoreFile gives the prefix of the file names; required.
+///
+template <typename scalar_t>
+TileFile<scalar_t>::TileFile( BaseMatrix<scalar_t>& A, Options const& opts )
+    : A_( A ),
+      fd_( -1 )
+{
+    if (A.op() != Op::NoTrans)
+        slate_not_implemented( "out-of-core transposed matrix" );
+
+    const char* prefix = get_option<const char*>(
+        opts, Option::OutOfCoreFile, nullptr );
+    if (prefix == nullptr)
+        slate_error( "out-of-core requires Option::OutOfCoreFile" );
+    filename_ = std::string( prefix ) + "." + std::to_string( A.mpiRank() );
+
+    fd_ = ::open( filename_.c_str(), O_RDWR | O_CREAT, 0644 );
+    if (fd_ < 0)
+        slate_error( "cannot open " + filename_ + ": "
+                     + std::strerror( errno ) );
+
+    Uplo uplo = A.uploPhysical();
+    int64_t offset = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if ((uplo == Uplo::Lower && i < j)
+                || (uplo == Uplo::Upper && i > j)
+                || ! A.tileIsLocal( i, j ))
+                continue;
+            offsets_[ { i, j } ] = offset;
+            offset += A.tileMb( i ) * A.tileNb( j ) * sizeof(scalar_t);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Completes pending writes, then closes the file. The file is kept.
+template <typename scalar_t>
+TileFile<scalar_t>::~TileFile()
+{
+    try {
+        flush();
+    }
+    catch (...) {
+        // Destructors must not throw; errors are reported by flush().
+    }
+    ::close( fd_ );
+}
+
+//------------------------------------------------------------------------------
+/// Starts reading stored tiles A( i1:i2, j1:j2 ) into host memory,
+/// inserting the tiles that do not exist yet; existing tiles are kept.
+/// Waits first for pending writes of the same tiles.
+///
+/// @return future to wait on before accessing the tiles.
+///
+template <typename scalar_t>
+std::future<void> TileFile<scalar_t>::read(
+    int64_t i1, int64_t i2, int64_t j1, int64_t j2 )
+{
+    finish_writes( i1, i2, j1, j2 );
+
+    std::vector<Segment> segments;
+    for (int64_t j = j1; j <= j2; ++j) {
+        for (int64_t i = i1; i <= i2; ++i) {
+            if (! stored( i, j ) || exists( i, j ))
+                continue;
+            Tile<scalar_t>* T = A_.tileInsert( i, j, HostNum );
+            segments.push_back( { T->data(), T->mb(), T->nb(), T->stride(),
+                                  offsets_[ { i, j } ] } );
+        }
+    }
+
+    int fd = fd_;
+    return std::async( std::launch::async, [fd, segments]() {
+        for (auto const& s : segments)
+            s.transfer( true, fd );
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Starts writing stored tiles A( i1:i2, j1:j2 ) that exist to the file.
+/// The host instances are brought up to date first. The tiles are erased
+/// from memory when the write completes, at the next flush() or
+/// overlapping read(); they must not be modified meanwhile.
+///
+template <typename scalar_t>
+void TileFile<scalar_t>::write(
+    int64_t i1, int64_t i2, int64_t j1, int64_t j2 )
+{
+    std::vector<Segment> segments;
+    for (int64_t j = j1; j <= j2; ++j) {
+        for (int64_t i = i1; i <= i2; ++i) {
+            if (! stored( i, j ) || ! exists( i, j ))
+                continue;
+            A_.tileGetForReading( i, j, HostNum, LayoutConvert::ColMajor );
+            auto T = A_( i, j );
+            segments.push_back( { T.data(), T.mb(), T.nb(), T.stride(),
+                                  offsets_[ { i, j } ] } );
+        }
+    }
+
+    int fd = fd_;
+    auto done = std::async( std::launch::async, [fd, segments]() {
+        for (auto const& s : segments)
+            s.transfer( false, fd );
+    });
+    writes_.push_back( { std::move( done ), i1, i2, j1, j2 } );
+}
+
+//------------------------------------------------------------------------------
+/// Erases stored tiles A( i1:i2, j1:j2 ) from memory without writing them,
+/// e.g., after reading factored panels that were not modified.
+///
+template <typename scalar_t>
+void TileFile<scalar_t>::release(
+    int64_t i1, int64_t i2, int64_t j1, int64_t j2 )
+{
+    for (int64_t j = j1; j <= j2; ++j) {
+        for (int64_t i = i1; i <= i2; ++i) {
+            if (stored( i, j ) && exists( i, j ))
+                A_.tileErase( i, j, AllDevices );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return true if tile {i, j} has an instance on the host or any device.
+template <typename scalar_t>
+bool TileFile<scalar_t>::exists( int64_t i, int64_t j )
+{
+    for (int device = HostNum; device < A_.num_devices(); ++device) {
+        if (A_.tileExists( i, j, device ))
+            return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+/// Waits for all pending writes, and erases their tiles.
+template <typename scalar_t>
+void TileFile<scalar_t>::flush()
+{
+    int64_t last = std::max( A_.mt(), A_.nt() );
+    finish_writes( 0, last, 0, last );
+}
+
+//------------------------------------------------------------------------------
+/// Waits for pending writes that overlap A( i1:i2, j1:j2 ), and erases
+/// their tiles.
+template <typename scalar_t>
+void TileFile<scalar_t>::finish_writes(
+    int64_t i1, int64_t i2, int64_t j1, int64_t j2 )
+{
+    auto it = writes_.begin();
+    while (it != writes_.end()) {
+        if (it->i1 <= i2 && i1 <= it->i2 && it->j1 <= j2 && j1 <= it->j2) {
+            // Take the write out of the list first, so an I/O error
+            // thrown by get() leaves the list consistent.
+            PendingWrite w = std::move( *it );
+            it = writes_.erase( it );
+            w.done.get();
+            release( w.i1, w.i2, w.j1, w.j2 );
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Returns the number of block columns, starting at k0, of a super-panel
+/// A( i1:mt-1, k0:k0+w-1 ) for which the super-panel, the previous one
+/// being written back, and two streamed block columns fit in budget
+/// bytes on every rank. At least 1. Collective, so all ranks agree.
+///
+template <typename scalar_t>
+int64_t TileFile<scalar_t>::panel_width( int64_t k0, int64_t i1,
+                                         int64_t budget )
+{
+    auto col_bytes = [&]( int64_t j, int64_t row1 ) {
+        int64_t bytes = 0;
+        for (int64_t i = row1; i < A_.mt(); ++i) {
+            if (stored( i, j ))
+                bytes += A_.tileMb( i ) * A_.tileNb( j ) * sizeof(scalar_t);
+        }
+        return bytes;
+    };
+
+    int64_t stream = 0;
+    for (int64_t j = 0; j < k0; ++j)
+        stream = std::max( stream, col_bytes( j, 0 ) );
+
+    int64_t width = 1;
+    int64_t used = col_bytes( k0, i1 );
+    while (k0 + width < A_.nt()) {
+        int64_t next = used + col_bytes( k0 + width, i1 );
+        if (2*next + 2*stream > budget)
+            break;
+        used = next;
+        ++width;
+    }
+
+    // All ranks must stream the same panel, so take the minimum width.
+    int64_t min_width;
+    slate_mpi_call(
+        MPI_Allreduce( &width, &min_width, 1, MPI_INT64_T, MPI_MIN,
+                       A_.mpiComm() ));
+    return min_width;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class TileFile<float>;
+template class TileFile<double>;
+template class TileFile< std::complex<float> >;
+template class TileFile< std::complex<double> >;
+
+} // namespace internal
+} // namespace slate
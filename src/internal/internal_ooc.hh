@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_INTERNAL_OOC_HH
+#define SLATE_INTERNAL_OOC_HH
+
+#include "slate/BaseMatrix.hh"
+#include "slate/types.hh"
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Per-rank file holding the local tiles of a matrix for out-of-core
+/// algorithms, named `<prefix>.<rank>` from Option::OutOfCoreFile.
+///
+/// Local tiles in the stored part of the matrix (all tiles for a general
+/// matrix, the lower or upper triangle for a trapezoid matrix) are stored
+/// in column-major order of tiles; each tile is column-major with leading
+/// dimension equal to its number of rows.
+///
+/// Tiles are streamed through host memory: read() inserts host tiles and
+/// fills them asynchronously, write() writes tiles back asynchronously and
+/// erases them once the write completes, at flush() or when an overlapping
+/// read() is started. Inserted tiles come from the matrix's memory pool,
+/// so a driver that loads and releases tiles of the same sizes runs in a
+/// fixed amount of memory.
+///
+/// The asynchronous I/O uses plain POSIX reads and writes into tile
+/// memory, on a separate thread; tiles being read or written must not be
+/// accessed until the I/O completes.
+///
+template <typename scalar_t>
+class TileFile {
+public:
+    TileFile( BaseMatrix<scalar_t>& A, Options const& opts );
+    ~TileFile();
+
+    TileFile(TileFile const& orig) = delete;
+    TileFile& operator = (TileFile const& orig) = delete;
+
+    std::future<void> read( int64_t i1, int64_t i2, int64_t j1, int64_t j2 );
+
+    void write( int64_t i1, int64_t i2, int64_t j1, int64_t j2 );
+
+    void release( int64_t i1, int64_t i2, int64_t j1, int64_t j2 );
+
+    void flush();
+
+    int64_t panel_width( int64_t k0, int64_t i1, int64_t budget );
+
+    /// @return true if tile {i, j} is local and in the file.
+    bool stored( int64_t i, int64_t j ) const
+    {
+        return offsets_.find( { i, j } ) != offsets_.end();
+    }
+
+private:
+    /// Tile I/O to do on the I/O thread.
+    struct Segment {
+        scalar_t* data;
+        int64_t mb, nb, stride;
+        int64_t offset;
+
+        void transfer( bool is_read, int fd ) const;
+    };
+
+    /// Write in progress; its tiles are erased when it completes.
+    struct PendingWrite {
+        std::future<void> done;
+        int64_t i1, i2, j1, j2;
+    };
+
+    void finish_writes( int64_t i1, int64_t i2, int64_t j1, int64_t j2 );
+
+    bool exists( int64_t i, int64_t j );
+
+    BaseMatrix<scalar_t> A_;
+    std::string filename_;
+    int fd_;
+    std::map< std::tuple<int64_t, int64_t>, int64_t > offsets_;
+    std::vector<PendingWrite> writes_;
+};
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_OOC_HH
@@ -0,0 +1,74 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_INTERNAL_REVERSE_HH
+#define SLATE_INTERNAL_REVERSE_HH
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/internal/mpi.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Copies the m-by-n matrix A into the m-by-n matrix B with the order of
+/// both its rows and its columns reversed, B = J A J, where J is the
+/// exchange matrix, B( i, j ) = A( m-1-i, n-1-j ).
+///
+/// A and B may have different tile sizes and distributions, so the
+/// reversed matrix keeps the regular tiling, with partial tiles last, that
+/// the tile algorithms expect. Each rank exports a column slab of A with
+/// export_dense, reverses it locally, and imports it into the mirrored
+/// column slab of B with import_dense: two all-to-all exchanges of the
+/// matrix, with a slab of about m*n/P values of workspace per rank.
+/// Collective over A's MPI communicator, which B must share.
+///
+/// @param[in] A
+///     The m-by-n matrix A.
+///
+/// @param[out] B
+///     The m-by-n matrix B, with local tiles allocated.
+///     On exit, B = J A J.
+///
+template <typename scalar_t>
+void reverse_copy( Matrix<scalar_t>& A, Matrix<scalar_t>& B )
+{
+    slate_assert( A.m() == B.m() && A.n() == B.n() );
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+
+    int mpi_size, mpi_rank;
+    slate_mpi_call(
+        MPI_Comm_size( A.mpiComm(), &mpi_size ));
+    slate_mpi_call(
+        MPI_Comm_rank( A.mpiComm(), &mpi_rank ));
+
+    // Column slab j0 : j0+nloc-1 of A for this rank.
+    int64_t j0   = (n * mpi_rank) / mpi_size;
+    int64_t nloc = (n * (mpi_rank + 1)) / mpi_size - j0;
+    int64_t lda  = std::max( int64_t( 1 ), m );
+
+    std::vector<scalar_t> slab( lda * nloc );
+    export_dense( A, 0, j0, m, nloc, slab.data(), lda );
+
+    // With lda == m, reversing the slab's storage reverses its rows and
+    // columns, giving B's slab n-j0-nloc : n-j0-1.
+    std::reverse( slab.begin(), slab.end() );
+    import_dense( 0, n - j0 - nloc, m, nloc, slab.data(), lda, B );
+}
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_REVERSE_HH
@@ -0,0 +1,342 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/Tile_aux.hh"
+#include "internal/internal_schur.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Copies the m-by-n matrix M, not transposed, between its distributed
+/// tiles and the column-major array data with leading dimension ld,
+/// which exists only on rank root.
+///
+/// @param[in] to_matrix
+///     If false, gathers M to data; if true, scatters data to M.
+///
+template <typename scalar_t>
+void copy_block(
+    Matrix<scalar_t>& M, scalar_t* data, int64_t ld, int root, bool to_matrix)
+{
+    assert( M.op() == Op::NoTrans );
+
+    int mpi_rank = M.mpiRank();
+    MPI_Comm comm = M.mpiComm();
+
+    int64_t jj = 0;
+    for (int64_t j = 0; j < M.nt(); ++j) {
+        int64_t ii = 0;
+        for (int64_t i = 0; i < M.mt(); ++i) {
+            int owner = M.tileRank( i, j );
+            if (mpi_rank == owner) {
+                if (to_matrix)
+                    M.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                else
+                    M.tileGetForReading( i, j, LayoutConvert::ColMajor );
+            }
+            if (mpi_rank == root) {
+                Tile<scalar_t> Dij( M.tileMb( i ), M.tileNb( j ),
+                                    &data[ ii + jj*ld ], ld,
+                                    HostNum, TileKind::UserOwned );
+                if (owner == root) {
+                    auto Mij = M( i, j );
+                    if (to_matrix)
+                        tile::gecopy( Dij, Mij );
+                    else
+                        tile::gecopy( Mij, Dij );
+                }
+                else if (to_matrix) {
+                    Dij.send( owner, comm );
+                }
+                else {
+                    Dij.recv( owner, comm, Layout::ColMajor );
+                }
+            }
+            else if (mpi_rank == owner) {
+                auto Mij = M( i, j );
+                if (to_matrix)
+                    Mij.recv( root, comm, Layout::ColMajor );
+                else
+                    Mij.send( root, comm );
+            }
+            ii += M.tileMb( i );
+        }
+        jj += M.tileNb( j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the Householder vectors stored below the diagonal of A to V,
+/// with the unit diagonal and zeros above it made explicit:
+/// V(i, j) = A(i, j) for i > j, 1 for i == j, 0 for i < j.
+/// A and V have the same tiling and distribution; no communication.
+///
+template <typename scalar_t>
+void copy_reflectors(Matrix<scalar_t> A, Matrix<scalar_t> V)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t jj = 0;
+    for (int64_t j = 0; j < V.nt(); ++j) {
+        int64_t ii = 0;
+        for (int64_t i = 0; i < V.mt(); ++i) {
+            if (V.tileIsLocal( i, j )) {
+                A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                V.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                auto Aij = A( i, j );
+                auto Vij = V( i, j );
+                for (int64_t c = 0; c < Vij.nb(); ++c) {
+                    for (int64_t r = 0; r < Vij.mb(); ++r) {
+                        int64_t gr = ii + r;
+                        int64_t gc = jj + c;
+                        Vij.at( r, c ) = gr > gc ? Aij( r, c )
+                                       : (gr == gc ? one : zero);
+                    }
+                }
+            }
+            ii += V.tileMb( i );
+        }
+        jj += V.tileNb( j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Returns flags of length n, where flag k is true if the upper
+/// quasi-triangular T has a 2-by-2 diagonal block in rows k-1 and k,
+/// that is, T(k, k-1) != 0. Always false for complex T.
+///
+template <typename scalar_t>
+std::vector<char> schur_subdiag(Matrix<scalar_t> T)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    int64_t n = T.m();
+    std::vector<char> cross( n, false );
+    if (is_complex<scalar_t>::value || n < 2)
+        return cross;
+
+    if (T.op() != Op::NoTrans)
+        T = conj_transpose( T );
+
+    // |T(k, k-1)| from diagonal tiles and the corner of subdiagonal tiles.
+    std::vector<real_t> local( n, 0.0 ), global( n, 0.0 );
+    int64_t ii = 0;
+    for (int64_t i = 0; i < T.mt(); ++i) {
+        int64_t mb = T.tileMb( i );
+        if (T.tileIsLocal( i, i )) {
+            T.tileGetForReading( i, i, LayoutConvert::ColMajor );
+            auto Tii = T( i, i );
+            for (int64_t r = 1; r < mb; ++r)
+                local[ ii + r ] = std::abs( Tii( r, r-1 ) );
+        }
+        if (i > 0 && T.tileIsLocal( i, i-1 )) {
+            T.tileGetForReading( i, i-1, LayoutConvert::ColMajor );
+            auto Tij = T( i, i-1 );
+            local[ ii ] = std::abs( Tij( 0, Tij.nb()-1 ) );
+        }
+        ii += mb;
+    }
+    slate_mpi_call(
+        MPI_Allreduce( local.data(), global.data(), n,
+                       mpi_type<real_t>::value, MPI_MAX, T.mpiComm() ) );
+
+    for (int64_t k = 1; k < n; ++k)
+        cross[ k ] = global[ k ] != 0;
+    return cross;
+}
+
+//------------------------------------------------------------------------------
+/// Recursive triangular Sylvester solve, op(A) X + sign X op(B) = C.
+/// The larger of A and B is split in half; after one half of X is solved,
+/// the coupling block is eliminated by gemm, then the other half is solved.
+/// Blocks that fit in one tile are gathered and solved by LAPACK trsyl
+/// on the owner of their first tile of C.
+///
+/// @param[in] a0, b0
+///     Global offsets of op(A) and op(B), to index cross_A and cross_B.
+///
+template <typename scalar_t>
+void trsyl_rec(
+    int sign,
+    Matrix<scalar_t> A, Matrix<scalar_t> B, Matrix<scalar_t> C,
+    int64_t a0, int64_t b0,
+    std::vector<char> const& cross_A, std::vector<char> const& cross_B,
+    int64_t nb, Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t one = 1.0;
+    const scalar_t neg_sign = -sign;
+
+    int64_t m = C.m();
+    int64_t n = C.n();
+    if (m == 0 || n == 0)
+        return;
+
+    // A 2-by-2 block split by a tile boundary can give a block of size
+    // nb+1, so allow at least 2 in the base case.
+    int64_t nb_base = std::max( nb, int64_t( 2 ) );
+    if (m <= nb_base && n <= nb_base) {
+        // Base case: gather, solve, and scatter.
+        int root = C.tileRank( 0, 0 );
+        Op opA = A.op();
+        Op opB = B.op();
+        Matrix<scalar_t> A_ = (opA == Op::NoTrans) ? A : conj_transpose( A );
+        Matrix<scalar_t> B_ = (opB == Op::NoTrans) ? B : conj_transpose( B );
+
+        std::vector<scalar_t> A_data, B_data, C_data;
+        if (C.mpiRank() == root) {
+            A_data.resize( m*m );
+            B_data.resize( n*n );
+            C_data.resize( m*n );
+        }
+        copy_block( A_, A_data.data(), m, root, false );
+        copy_block( B_, B_data.data(), n, root, false );
+        copy_block( C,  C_data.data(), m, root, false );
+
+        if (C.mpiRank() == root) {
+            real_t scale = 1.0;
+            lapack::trsyl( opA, opB, sign, m, n,
+                           A_data.data(), m, B_data.data(), n,
+                           C_data.data(), m, &scale );
+            // LAPACK scales the solution by scale < 1 to avoid overflow;
+            // undo it, so overflow gives Inf as in the gemm updates.
+            if (scale != 1) {
+                blas::scal( m*n, scalar_t( 1 / scale ), C_data.data(), 1 );
+            }
+        }
+        copy_block( C, C_data.data(), m, root, true );
+        return;
+    }
+
+    if (m >= n) {
+        int64_t k = schur_split( m, a0, nb, cross_A );
+        auto A11 = A.slice( 0, k-1, 0, k-1 );
+        auto A22 = A.slice( k, m-1, k, m-1 );
+        auto C1  = C.slice( 0, k-1, 0, n-1 );
+        auto C2  = C.slice( k, m-1, 0, n-1 );
+        if (A.op() == Op::NoTrans) {
+            // A is upper: solve for X2, then C1 -= A12 X2.
+            auto A12 = A.slice( 0, k-1, k, m-1 );
+            trsyl_rec( sign, A22, B, C2, a0+k, b0, cross_A, cross_B, nb, opts );
+            slate::gemm( -one, A12, C2, one, C1, opts );
+            trsyl_rec( sign, A11, B, C1, a0, b0, cross_A, cross_B, nb, opts );
+        }
+        else {
+            // A is lower: solve for X1, then C2 -= A21 X1.
+            auto A21 = A.slice( k, m-1, 0, k-1 );
+            trsyl_rec( sign, A11, B, C1, a0, b0, cross_A, cross_B, nb, opts );
+            slate::gemm( -one, A21, C1, one, C2, opts );
+            trsyl_rec( sign, A22, B, C2, a0+k, b0, cross_A, cross_B, nb, opts );
+        }
+    }
+    else {
+        int64_t k = schur_split( n, b0, nb, cross_B );
+        auto B11 = B.slice( 0, k-1, 0, k-1 );
+        auto B22 = B.slice( k, n-1, k, n-1 );
+        auto C1  = C.slice( 0, m-1, 0, k-1 );
+        auto C2  = C.slice( 0, m-1, k, n-1 );
+        if (B.op() == Op::NoTrans) {
+            // B is upper: solve for X1, then C2 -= sign X1 B12.
+            auto B12 = B.slice( 0, k-1, k, n-1 );
+            trsyl_rec( sign, A, B11, C1, a0, b0, cross_A, cross_B, nb, opts );
+            slate::gemm( neg_sign, C1, B12, one, C2, opts );
+            trsyl_rec( sign, A, B22, C2, a0, b0+k, cross_A, cross_B, nb, opts );
+        }
+        else {
+            // B is lower: solve for X2, then C1 -= sign X2 B21.
+            auto B21 = B.slice( k, n-1, 0, k-1 );
+            trsyl_rec( sign, A, B22, C2, a0, b0+k, cross_A, cross_B, nb, opts );
+            slate::gemm( neg_sign, C2, B21, one, C1, opts );
+            trsyl_rec( sign, A, B11, C1, a0, b0, cross_A, cross_B, nb, opts );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void copy_block<float>(
+    Matrix<float>& M, float* data, int64_t ld, int root, bool to_matrix);
+
+template
+void copy_block<double>(
+    Matrix<double>& M, double* data, int64_t ld, int root, bool to_matrix);
+
+template
+void copy_block< std::complex<float> >(
+    Matrix< std::complex<float> >& M, std::complex<float>* data, int64_t ld, int root, bool to_matrix);
+
+template
+void copy_block< std::complex<double> >(
+    Matrix< std::complex<double> >& M, std::complex<double>* data, int64_t ld, int root, bool to_matrix);
+
+// ----------------------------------------
+template
+void copy_reflectors<float>(Matrix<float> A, Matrix<float> V);
+
+template
+void copy_reflectors<double>(Matrix<double> A, Matrix<double> V);
+
+template
+void copy_reflectors< std::complex<float> >(
+    Matrix< std::complex<float> > A, Matrix< std::complex<float> > V);
+
+template
+void copy_reflectors< std::complex<double> >(
+    Matrix< std::complex<double> > A, Matrix< std::complex<double> > V);
+
+// ----------------------------------------
+template
+std::vector<char> schur_subdiag<float>(Matrix<float> T);
+
+template
+std::vector<char> schur_subdiag<double>(Matrix<double> T);
+
+template
+std::vector<char> schur_subdiag< std::complex<float> >(Matrix< std::complex<float> > T);
+
+template
+std::vector<char> schur_subdiag< std::complex<double> >(Matrix< std::complex<double> > T);
+
+// ----------------------------------------
+template
+void trsyl_rec<float>(
+    int sign,
+    Matrix<float> A, Matrix<float> B, Matrix<float> C,
+    int64_t a0, int64_t b0,
+    std::vector<char> const& cross_A, std::vector<char> const& cross_B,
+    int64_t nb, Options const& opts);
+
+template
+void trsyl_rec<double>(
+    int sign,
+    Matrix<double> A, Matrix<double> B, Matrix<double> C,
+    int64_t a0, int64_t b0,
+    std::vector<char> const& cross_A, std::vector<char> const& cross_B,
+    int64_t nb, Options const& opts);
+
+template
+void trsyl_rec< std::complex<float> >(
+    int sign,
+    Matrix< std::complex<float> > A, Matrix< std::complex<float> > B, Matrix< std::complex<float> > C,
+    int64_t a0, int64_t b0,
+    std::vector<char> const& cross_A, std::vector<char> const& cross_B,
+    int64_t nb, Options const& opts);
+
+template
+void trsyl_rec< std::complex<double> >(
+    int sign,
+    Matrix< std::complex<double> > A, Matrix< std::complex<double> > B, Matrix< std::complex<double> > C,
+    int64_t a0, int64_t b0,
+    std::vector<char> const& cross_A, std::vector<char> const& cross_B,
+    int64_t nb, Options const& opts);
+
+} // namespace internal
+} // namespace slate
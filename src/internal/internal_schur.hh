@@ -0,0 +1,65 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_INTERNAL_SCHUR_HH
+#define SLATE_INTERNAL_SCHUR_HH
+
+#include "slate/Matrix.hh"
+#include "slate/types.hh"
+
+#include <cstdint>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Helpers shared by the Hessenberg and Schur routines:
+// gehrd, unmhr, hseqr, trevc, trsyl.
+
+template <typename scalar_t>
+void copy_block(
+    Matrix<scalar_t>& M, scalar_t* data, int64_t ld, int root, bool to_matrix);
+
+template <typename scalar_t>
+void copy_reflectors(Matrix<scalar_t> A, Matrix<scalar_t> V);
+
+template <typename scalar_t>
+std::vector<char> schur_subdiag(Matrix<scalar_t> T);
+
+//------------------------------------------------------------------------------
+/// Returns where to split a range of length m starting at global index
+/// offset: on a tile boundary near the middle if possible, but not
+/// splitting a 2-by-2 diagonal block.
+///
+/// @param[in] cross
+///     Flags from schur_subdiag.
+///
+inline int64_t schur_split(
+    int64_t m, int64_t offset, int64_t nb, std::vector<char> const& cross)
+{
+    int64_t k = ((offset + m/2 + nb/2) / nb) * nb - offset;
+    if (k <= 0 || k >= m)
+        k = m/2;
+    if (cross[ offset + k ])
+        k = (k+1 < m) ? k+1 : k-1;
+    return k;
+}
+
+template <typename scalar_t>
+void trsyl_rec(
+    int sign,
+    Matrix<scalar_t> A, Matrix<scalar_t> B, Matrix<scalar_t> C,
+    int64_t a0, int64_t b0,
+    std::vector<char> const& cross_A, std::vector<char> const& cross_B,
+    int64_t nb, Options const& opts);
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_SCHUR_HH
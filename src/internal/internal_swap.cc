@@ -8,6 +8,8 @@
 #include "internal/internal.hh"
 #include "internal/internal_swap.hh"
 
+#include <algorithm>
+#include <climits>
 #include <map>
 #include <vector>
 
@@ -76,6 +78,42 @@ void makeParallelPivot(
 */
 }
 
+//------------------------------------------------------------------------------
+/// Composes the pivots of one panel onto a parallel pivot map, so the pivots
+/// of several panels can be applied as a single out-of-place permutation,
+/// moving each row at most once.
+///
+/// @param[in] tile_offset
+///     Tile row of the panel's diagonal block, relative to the first tile row
+///     of the matrix the map applies to.
+///
+/// @param[in] pivot
+///     Serial (LAPACK-style) pivot vector of the panel, relative to its
+///     diagonal block, applied forward.
+///
+/// @param[in,out] pivot_map
+///     Parallel pivot for out-of-place pivoting: pivot_map[ dst ] = src
+///     means row src is moved to row dst. Composed with pivot on exit.
+///
+/// @ingroup permute_internal
+///
+void composeParallelPivot(
+    int64_t tile_offset, std::vector<Pivot> const& pivot,
+    std::map<Pivot, Pivot>& pivot_map)
+{
+    for (int64_t i = 0; i < int64_t( pivot.size() ); ++i) {
+        Pivot row1( tile_offset, i );
+        Pivot row2( tile_offset + pivot[i].tileIndex(),
+                    pivot[i].elementOffset() );
+        if (row1 != row2) {
+            // Rows not yet in the map are in their original place.
+            pivot_map.insert( { row1, row1 } );
+            pivot_map.insert( { row2, row2 } );
+            std::swap( pivot_map[ row1 ], pivot_map[ row2 ] );
+        }
+    }
+}
+
 /*
 //------------------------------------------------------------------------------
 template <Target target, typename scalar_t>
@@ -190,6 +228,13 @@ void permuteRows(
 //------------------------------------------------------------------------------
 /// Permutes rows of a general matrix according to the pivot vector.
 /// Host implementation.
+///
+/// Communication is aggregated over all tile columns: each non-root rank
+/// packs the pivot rows it owns, for every tile column rooted on a given
+/// rank, into one contiguous buffer and exchanges it with that root in a
+/// single message each way. The root applies the swaps of each column
+/// sequentially, as in LAPACK's laswp, against its local rows and the
+/// received rows, then returns the updated rows.
 /// todo: Restructure similarly to Hermitian permuteRowsCols
 ///       (use the auxiliary swap functions).
 ///
@@ -209,213 +254,207 @@ void permuteRows(
     MPI_Comm comm = A.mpiComm();
     int comm_size;
     MPI_Comm_size(comm, &comm_size);
+    int mpi_rank = A.mpiRank();
 
-    {
-        trace::Block trace_block("internal::permuteRows");
+    trace::Block trace_block("internal::permuteRows");
 
-        MPI_Datatype mpi_scalar = mpi_type<scalar_t>::value;
-
-        // todo: what about parallelizing this? MPI blocking?
-        for (int64_t j = 0; j < A.nt(); ++j) {
-            int root_rank = A.tileRank(0, j);
-            bool root = A.mpiRank() == A.tileRank(0, j);
+    MPI_Datatype mpi_scalar = mpi_type<scalar_t>::value;
+    int tag = tag_base;
 
-            int tag = tag_base + j;
+    // Apply pivots forward (0, ..., k-1) or reverse (k-1, ..., 0)
+    int64_t begin, end, inc;
+    if (direction == Direction::Forward) {
+        begin = 0;
+        end   = pivot.size();
+        inc   = 1;
+    }
+    else {
+        begin = pivot.size() - 1;
+        end   = -1;
+        inc   = -1;
+    }
 
-            // Apply pivots forward (0, ..., k-1) or reverse (k-1, ..., 0)
-            int64_t begin, end, inc;
-            if (direction == Direction::Forward) {
-                begin = 0;
-                end   = pivot.size();
-                inc   = 1;
+    // Distinct pivot rows below the first block row, in order of use.
+    // Rows in the first block row are always on the root of their column.
+    //
+    // rows[ ii ] is the ii-th distinct pivot row.
+    // pivot_row[ i ] is the index ii in rows of pivot[ i ], or -1.
+    std::vector<Pivot> rows;
+    std::vector<int64_t> pivot_row( pivot.size(), -1 );
+    {
+        std::map<Pivot, int64_t> row_index;
+        for (int64_t i = begin; i != end; i += inc) {
+            if (pivot[i].tileIndex() > 0) {
+                auto iter = row_index.find( pivot[i] );
+                if (iter == row_index.end()) {
+                    iter = row_index.insert(
+                        { pivot[i], int64_t( rows.size() ) } ).first;
+                    rows.push_back( pivot[i] );
+                }
+                pivot_row[i] = iter->second;
             }
-            else {
-                begin = pivot.size() - 1;
-                end   = -1;
-                inc   = -1;
+        }
+    }
+    int64_t nrows = rows.size();
+    int64_t nt = A.nt();
+
+    // Build tables mapping exchanged rows to their index in the workspaces.
+    // A root receives from rank r the rows that r owns in all the columns
+    // rooted on this rank, ordered by column, then by index in rows;
+    // a non-root sends to each root its rows in the same order.
+    //
+    // recv_offsets[ r ] is index in recv_rows of first element from rank r.
+    // send_offsets[ r ] is index in send_rows of first element to rank r.
+    // row_pos[ ii + j*nrows ] is index in recv_rows (if this rank is root
+    //                         of column j) or send_rows (otherwise) of
+    //                         rows[ ii ] in column j; -1 if not exchanged.
+    std::vector<int64_t> recv_offsets( comm_size + 1, 0 );
+    std::vector<int64_t> send_offsets( comm_size + 1, 0 );
+    std::vector<int64_t> row_pos( nrows*nt, -1 );
+    for (int64_t j = 0; j < nt; ++j) {
+        int root_rank = A.tileRank(0, j);
+        int64_t nb = A.tileNb(j);
+        for (int64_t ii = 0; ii < nrows; ++ii) {
+            int row_rank = A.tileRank(rows[ii].tileIndex(), j);
+            if (row_rank != root_rank) {
+                if (root_rank == mpi_rank)
+                    recv_offsets[ row_rank+1 ] += nb;
+                else if (row_rank == mpi_rank)
+                    send_offsets[ root_rank+1 ] += nb;
             }
-
-            // process pivots
-            int64_t nb = A.tileNb(j);
-
-            MPI_Datatype row_type;
-            MPI_Type_contiguous(nb, mpi_scalar, &row_type);
-            MPI_Type_commit(&row_type);
-
-            if (root) {
-                // Build table mapping remote pivots to row index in workspace.
-                //
-                // remote_count  [ r ] is # rows swapped with rank r.
-                // remote_offsets[ r ] is index in workspace of first row
-                //                     swapped with rank r.
-                // remote_index  [ r ] tracks the next row swapped with rank r;
-                //                     initially equals remote_offsets[ r ].
-                // remote_pivot_table[ pivot[ i ] ] = remote_index for pivot[ i ].
-                //
-                // row indices are stored in int b/c gather/scatter can't use int64_t's
-                std::vector<int> remote_count(comm_size + 1);
-                for (int64_t i = begin; i != end; i += inc) {
-                    auto piv = pivot[i];
-                    auto swap_rank = A.tileRank(piv.tileIndex(), j);
-                    if (root_rank != swap_rank) {
-                        ++remote_count[swap_rank];
-                    }
-                }
-                std::vector<int> remote_index(comm_size);
-                std::vector<int> remote_offsets(comm_size+1);
-                for (int r = 0; r < comm_size; ++r) {
-                    remote_offsets[r+1] += remote_offsets[r] + remote_count[r];
-                    remote_index[r] = remote_offsets[r];
-                }
-                std::map<Pivot, int> remote_pivot_table;
-                for (int64_t i = begin; i != end; i += inc) {
-                    auto piv = pivot[i];
-                    auto swap_rank = A.tileRank(piv.tileIndex(), j);
-                    if (root_rank != swap_rank
-                        && remote_pivot_table.find(piv) == remote_pivot_table.end()) {
-                        int index = remote_index[swap_rank];
-                        ++remote_index[swap_rank];
-                        remote_pivot_table.insert({piv, index});
-                    }
+        }
+    }
+    for (int r = 0; r < comm_size; ++r) {
+        recv_offsets[ r+1 ] += recv_offsets[ r ];
+        send_offsets[ r+1 ] += send_offsets[ r ];
+    }
+    std::vector<int64_t> recv_index( recv_offsets.begin(), recv_offsets.end() - 1 );
+    std::vector<int64_t> send_index( send_offsets.begin(), send_offsets.end() - 1 );
+    for (int64_t j = 0; j < nt; ++j) {
+        int root_rank = A.tileRank(0, j);
+        int64_t nb = A.tileNb(j);
+        for (int64_t ii = 0; ii < nrows; ++ii) {
+            int row_rank = A.tileRank(rows[ii].tileIndex(), j);
+            if (row_rank != root_rank) {
+                if (root_rank == mpi_rank) {
+                    row_pos[ ii + j*nrows ] = recv_index[ row_rank ];
+                    recv_index[ row_rank ] += nb;
                 }
-                for (int r = 0; r < comm_size; ++r) {
-                    // trim the lengths to their actual values
-                    // since a pivot can be repeated.
-                    remote_count[r] = remote_index[r] - remote_offsets[r];
+                else if (row_rank == mpi_rank) {
+                    row_pos[ ii + j*nrows ] = send_index[ root_rank ];
+                    send_index[ root_rank ] += nb;
                 }
+            }
+        }
+    }
 
-                std::vector<scalar_t> remote_rows_vect (remote_offsets[comm_size]*nb);
-                scalar_t* remote_rows = remote_rows_vect.data();
-
-                // Gather remote rows to root.
-                std::vector<MPI_Request> requests (comm_size);
-                int request_count = 0;
-                for (int r = 0; r < comm_size; ++r) {
-                    // Assumes remote_count[root_rank] == 0
-                    if (remote_count[r] != 0) {
-                        scalar_t* rows_r = remote_rows + nb*remote_offsets[r];
-                        MPI_Irecv(rows_r, remote_count[r], row_type,
-                                  r, tag, comm, &requests[request_count]);
-                        ++request_count;
-                    }
+    std::vector<scalar_t> recv_rows( recv_offsets[ comm_size ] );
+    std::vector<scalar_t> send_rows( send_offsets[ comm_size ] );
+
+    // Exchanges one message each way with every peer that has a non-empty
+    // segment in recv_buf or send_buf.
+    std::vector<MPI_Request> requests( 2*comm_size );
+    auto exchange = [&](
+        scalar_t* recv_buf, std::vector<int64_t> const& recv_off,
+        scalar_t* send_buf, std::vector<int64_t> const& send_off)
+    {
+        int request_count = 0;
+        for (int r = 0; r < comm_size; ++r) {
+            int64_t count = recv_off[ r+1 ] - recv_off[ r ];
+            if (count > 0) {
+                slate_assert(count <= INT_MAX);
+                slate_mpi_call(
+                    MPI_Irecv(recv_buf + recv_off[ r ], count, mpi_scalar,
+                              r, tag, comm, &requests[ request_count ]));
+                ++request_count;
+            }
+        }
+        for (int r = 0; r < comm_size; ++r) {
+            int64_t count = send_off[ r+1 ] - send_off[ r ];
+            if (count > 0) {
+                slate_assert(count <= INT_MAX);
+                slate_mpi_call(
+                    MPI_Isend(send_buf + send_off[ r ], count, mpi_scalar,
+                              r, tag, comm, &requests[ request_count ]));
+                ++request_count;
+            }
+        }
+        slate_mpi_call(
+            MPI_Waitall(request_count, requests.data(),
+                        MPI_STATUSES_IGNORE));
+    };
+
+    // Pack my pivot rows of columns rooted elsewhere into workspace.
+    for (int64_t j = 0; j < nt; ++j) {
+        if (A.tileRank(0, j) != mpi_rank) {
+            int64_t nb = A.tileNb(j);
+            for (int64_t ii = 0; ii < nrows; ++ii) {
+                int64_t pos = row_pos[ ii + j*nrows ];
+                if (pos >= 0) {
+                    auto T = A(rows[ii].tileIndex(), j);
+                    blas::copy(
+                        nb,
+                        &T.at(rows[ii].elementOffset(), 0), T.rowIncrement(),
+                        &send_rows[ pos ], 1);
                 }
-                MPI_Waitall(request_count, requests.data(), MPI_STATUSES_IGNORE);
+            }
+        }
+    }
 
-                int64_t stride_0j = A(0, j).rowIncrement();
+    // Gather remote rows to roots.
+    exchange( recv_rows.data(), recv_offsets, send_rows.data(), send_offsets );
 
-                // Swap rows locally.
+    // Swap rows of columns rooted here.
+    for (int64_t j = 0; j < nt; ++j) {
+        if (A.tileRank(0, j) == mpi_rank) {
+            int64_t nb = A.tileNb(j);
+            auto T0 = A(0, j);
+            int64_t stride_0j = T0.rowIncrement();
             for (int64_t i = begin; i != end; i += inc) {
-                int pivot_rank = A.tileRank(pivot[i].tileIndex(), j);
-
-                    if (pivot_rank == root_rank) {
-                        // If pivot not on the diagonal.
-                        if (pivot[i].tileIndex() > 0 ||
-                            pivot[i].elementOffset() > i)
-                        {
-                            // todo: assumes 1-D block cyclic distribution on devices
-                            int64_t i1 = i;
-                            int64_t i2 = pivot[i].elementOffset();
-                            int64_t idx2 = pivot[i].tileIndex();
-
-                            int64_t stride_idx2j = A(idx2, j).rowIncrement();
-
-                            blas::swap(
-                                A.tileNb(j),
-                                &A(0,    j).at(i1, 0), stride_0j,
-                                &A(idx2, j).at(i2, 0), stride_idx2j);
-                        }
-                    }
-                    else {
-                        auto remote_idx = remote_pivot_table[pivot[i]];
+                int64_t ii = pivot_row[ i ];
+                if (ii < 0) {
+                    // If pivot not on the diagonal.
+                    if (pivot[i].elementOffset() > i) {
                         blas::swap(
-                            A.tileNb(j),
-                            &A(0, j).at(i, 0), stride_0j,
-                            remote_rows + nb*remote_idx, 1);
+                            nb,
+                            &T0.at(i, 0), stride_0j,
+                            &T0.at(pivot[i].elementOffset(), 0), stride_0j);
                     }
                 }
-
-                // Scatter remote rows.
-                // reuse requests array from before
-                request_count = 0;
-                for (int r = 0; r < comm_size; ++r) {
-                    // Assumes remote_count[root_rank] == 0
-                    if (remote_count[r] != 0) {
-                        scalar_t* rows_r = remote_rows + nb*remote_offsets[r];
-                        MPI_Isend(rows_r, remote_count[r], row_type,
-                                  r, tag, comm, &requests[request_count]);
-                        ++request_count;
-                    }
+                else if (row_pos[ ii + j*nrows ] < 0) {
+                    auto T = A(pivot[i].tileIndex(), j);
+                    blas::swap(
+                        nb,
+                        &T0.at(i, 0), stride_0j,
+                        &T.at(pivot[i].elementOffset(), 0), T.rowIncrement());
                 }
-                MPI_Waitall(request_count, requests.data(), MPI_STATUSES_IGNORE);
-            }
-            else { // not root
-                // Build table mapping my pivots to row index in workspace.
-                std::map<Pivot, int> remote_pivot_table;
-                int remote_length = 0;
-                for (int64_t i = begin; i != end; i += inc) {
-                    auto piv = pivot[i];
-                    auto swap_rank = A.tileRank(piv.tileIndex(), j);
-                    if (swap_rank == A.mpiRank()
-                        && remote_pivot_table.find(piv) == remote_pivot_table.end()) {
-
-                        remote_pivot_table.insert({piv, remote_length});
-                        ++remote_length;
-                    }
+                else {
+                    blas::swap(
+                        nb,
+                        &T0.at(i, 0), stride_0j,
+                        &recv_rows[ row_pos[ ii + j*nrows ] ], 1);
                 }
+            }
+        }
+    }
 
-                if (remote_length > 0) {
-                    std::vector<scalar_t> remote_rows_vect (nb*remote_length);
-                    scalar_t* remote_rows = remote_rows_vect.data();
-
-                    // Pack pivot rows into workspace.
-                    int64_t count = 0;
-                    for (int64_t i = begin; i != end; i += inc) {
-                        int pivot_rank = A.tileRank(pivot[i].tileIndex(), j);
-                        if (pivot_rank == A.mpiRank()) {
-                            auto remote_idx = remote_pivot_table[pivot[i]];
-                            auto tile_index = pivot[i].tileIndex();
-                            auto tile_offset = pivot[i].elementOffset();
-
-                            if (remote_idx >= count) {
-                                int64_t stride_idxj = A(tile_index, j).rowIncrement();
-                                blas::copy(
-                                    A.tileNb(j),
-                                    &A(tile_index, j).at(tile_offset, 0), stride_idxj,
-                                    remote_rows + nb*remote_idx, 1);
-                                ++count;
-                            }
-                        }
-                    }
+    // Scatter updated rows back from roots.
+    exchange( send_rows.data(), send_offsets, recv_rows.data(), recv_offsets );
 
-                    // Send rows, then recv updated rows.
-                    MPI_Send(remote_rows, remote_length, row_type,
-                             root_rank, tag, comm);
-                    MPI_Recv(remote_rows, remote_length, row_type,
-                             root_rank, tag, comm, MPI_STATUS_IGNORE);
-
-                    // Unpack pivot rows from workspace.
-                    count = 0;
-                    for (int64_t i = begin; i != end; i += inc) {
-                        int pivot_rank = A.tileRank(pivot[i].tileIndex(), j);
-                        if (pivot_rank == A.mpiRank()) {
-                            auto remote_idx = remote_pivot_table[pivot[i]];
-                            auto tile_index = pivot[i].tileIndex();
-                            auto tile_offset = pivot[i].elementOffset();
-
-                            if (remote_idx >= count) {
-                                int64_t stride_idxj = A(tile_index, j).rowIncrement();
-                                blas::copy(
-                                    A.tileNb(j),
-                                    remote_rows + nb*remote_idx, 1,
-                                    &A(tile_index, j).at(tile_offset, 0), stride_idxj);
-                                ++count;
-                            }
-                        }
-                    }
+    // Unpack my pivot rows from workspace.
+    for (int64_t j = 0; j < nt; ++j) {
+        if (A.tileRank(0, j) != mpi_rank) {
+            int64_t nb = A.tileNb(j);
+            for (int64_t ii = 0; ii < nrows; ++ii) {
+                int64_t pos = row_pos[ ii + j*nrows ];
+                if (pos >= 0) {
+                    auto T = A(rows[ii].tileIndex(), j);
+                    blas::copy(
+                        nb,
+                        &send_rows[ pos ], 1,
+                        &T.at(rows[ii].elementOffset(), 0), T.rowIncrement());
                 }
             }
-
-            MPI_Type_free(&row_type);
         }
     }
 }
@@ -467,7 +506,9 @@ void permuteRows(
 ///     The priority to use for internal tasks
 ///
 /// @param[in] tag_base
-///     The communication for the jth tile column of A uses the MPI tag tag_base+j
+///     MPI tag for the communication. The host implementation exchanges
+///     all tile columns at once with tag tag_base; the device
+///     implementation uses tag tag_base+j for the jth tile column of A.
 ///
 /// @param[in] queue_index
 ///     For Target::Devices, which BLAS++ queue to use
@@ -487,6 +528,10 @@ void permuteRows(
 //------------------------------------------------------------------------------
 /// Permutes rows of a general matrix according to the pivot vector.
 /// GPU device implementation.
+/// Rows are swapped in place with strided BLAS calls, so tiles can be
+/// RowMajor (unit stride rows, fastest) or ColMajor (rows with stride
+/// equal to the tile's stride), e.g., to avoid converting tiles that point
+/// into a ScaLAPACK matrix.
 /// todo: Restructure similarly to Hermitian permute
 ///       (use the auxiliary swap functions).
 /// todo: Just one function forwarding target.
@@ -500,8 +545,7 @@ void permuteRows(
     Matrix<scalar_t>& A, std::vector<Pivot>& pivot,
     Layout layout, int priority, int tag_base, int queue_index)
 {
-    // GPU uses RowMajor
-    assert(layout == Layout::RowMajor);
+    assert(layout == Layout::RowMajor || layout == Layout::ColMajor);
 
     // todo: for performance optimization, merge with the loops below,
     // at least with lookahead, probably selectively
@@ -635,22 +679,24 @@ void permuteRows(
                                     pivot[i].elementOffset() > i)
                                     {
                                         // todo: assumes 1-D block cyclic
-                                        assert(A(0, j, device).layout() == Layout::RowMajor);
                                         int64_t i1 = i;
                                         int64_t i2 = pivot[i].elementOffset();
                                         int64_t idx2 = pivot[i].tileIndex();
+                                        auto T1 = A(0,    j, device);
+                                        auto T2 = A(idx2, j, device);
                                         blas::swap(
                                                    A.tileNb(j),
-                                                   &A(0,    j, device).at(i1, 0), 1,
-                                                   &A(idx2, j, device).at(i2, 0), 1,
+                                                   &T1.at(i1, 0), T1.rowIncrement(),
+                                                   &T2.at(i2, 0), T2.rowIncrement(),
                                                    *compute_queue);
                                     }
                             }
                             else {
                                 auto remote_idx = remote_pivot_table[pivot[i]];
+                                auto T1 = A(0, j, device);
                                 blas::swap(
                                            A.tileNb(j),
-                                           &A(0, j, device).at(i, 0), 1,
+                                           &T1.at(i, 0), T1.rowIncrement(),
                                            remote_rows_dev + nb*remote_idx, 1,
                                            *compute_queue);
                             }
@@ -704,9 +750,10 @@ void permuteRows(
                                     auto tile_offset = pivot[i].elementOffset();
 
                                     if (remote_idx >= count) {
+                                        auto T = A(tile_index, j, device);
                                         blas::copy(
                                             nb,
-                                            &A(tile_index, j, device).at(tile_offset, 0), 1,
+                                            &T.at(tile_offset, 0), T.rowIncrement(),
                                             remote_rows_dev + nb*remote_idx, 1,
                                             *compute_queue);
                                         ++count; // only swap the first time
@@ -748,10 +795,11 @@ void permuteRows(
                                     auto tile_offset = pivot[i].elementOffset();
 
                                     if (remote_idx >= count) {
+                                        auto T = A(tile_index, j, device);
                                         blas::copy(
                                             A.tileNb(j),
                                             remote_rows_dev + nb*remote_idx, 1,
-                                            &A(tile_index, j, device).at(tile_offset, 0), 1,
+                                            &T.at(tile_offset, 0), T.rowIncrement(),
                                             *compute_queue);
                                         ++count; // only swap the first time
                                     }
@@ -770,6 +818,196 @@ void permuteRows(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Permutes rows of a general matrix out-of-place, according to a parallel
+/// pivot map, e.g., the composed pivots of several panels.
+/// Host implementation.
+///
+/// All source rows are read before any destination row is written, so each
+/// row is moved at most once. As in permuteRows, communication is aggregated
+/// over all tile columns, with one message to each peer rank.
+///
+/// @ingroup permute_internal
+///
+template <typename scalar_t>
+void permuteRowsMap(
+    internal::TargetType<Target::HostTask>,
+    std::map<Pivot, Pivot> const& pivot_map,
+    Matrix<scalar_t>& A, Layout layout, int priority, int tag)
+{
+    A.tileGetAllForWriting( HostNum, LayoutConvert(layout) );
+
+    MPI_Comm comm = A.mpiComm();
+    int comm_size;
+    MPI_Comm_size(comm, &comm_size);
+    int mpi_rank = A.mpiRank();
+
+    trace::Block trace_block("internal::permuteRowsMap");
+
+    MPI_Datatype mpi_scalar = mpi_type<scalar_t>::value;
+
+    // Rows that move, as (dst, src) pairs.
+    std::vector< std::pair<Pivot, Pivot> > moves;
+    for (auto const& move : pivot_map) {
+        if (move.first != move.second)
+            moves.push_back( move );
+    }
+    int64_t nt = A.nt();
+
+    // Rows are packed for, and unpacked from, each rank in the same order,
+    // by column, then by move.
+    //
+    // recv_offsets[ r ] is index in recv_rows of first element from rank r.
+    // send_offsets[ r ] is index in send_rows of first element to rank r.
+    // recv_index[ j*comm_size + r ] is index in recv_rows of first element
+    // of column j from rank r; likewise send_index.
+    std::vector<int64_t> recv_offsets( comm_size + 1, 0 );
+    std::vector<int64_t> send_offsets( comm_size + 1, 0 );
+    std::vector<int64_t> recv_index( nt*comm_size, 0 );
+    std::vector<int64_t> send_index( nt*comm_size, 0 );
+    for (int64_t j = 0; j < nt; ++j) {
+        int64_t nb = A.tileNb(j);
+        for (auto const& move : moves) {
+            int dst_rank = A.tileRank(move.first.tileIndex(), j);
+            int src_rank = A.tileRank(move.second.tileIndex(), j);
+            if (dst_rank == mpi_rank)
+                recv_index[ j*comm_size + src_rank ] += nb;
+            if (src_rank == mpi_rank)
+                send_index[ j*comm_size + dst_rank ] += nb;
+        }
+    }
+    // Convert counts to offsets.
+    for (int r = 0; r < comm_size; ++r) {
+        int64_t recv_pos = recv_offsets[ r ];
+        int64_t send_pos = send_offsets[ r ];
+        for (int64_t j = 0; j < nt; ++j) {
+            int64_t recv_count = recv_index[ j*comm_size + r ];
+            int64_t send_count = send_index[ j*comm_size + r ];
+            recv_index[ j*comm_size + r ] = recv_pos;
+            send_index[ j*comm_size + r ] = send_pos;
+            recv_pos += recv_count;
+            send_pos += send_count;
+        }
+        recv_offsets[ r+1 ] = recv_pos;
+        send_offsets[ r+1 ] = send_pos;
+    }
+
+    std::vector<scalar_t> recv_rows( recv_offsets[ comm_size ] );
+    std::vector<scalar_t> send_rows( send_offsets[ comm_size ] );
+
+    // Pack source rows into workspace, a task per column.
+    #pragma omp taskgroup
+    for (int64_t j = 0; j < nt; ++j) {
+        #pragma omp task slate_omp_default_none \
+            shared( A, moves, send_index, send_rows ) \
+            firstprivate( j, comm_size, mpi_rank ) priority( priority )
+        {
+            int64_t nb = A.tileNb(j);
+            int64_t* index = &send_index[ j*comm_size ];
+            for (auto const& move : moves) {
+                if (A.tileRank(move.second.tileIndex(), j) == mpi_rank) {
+                    int dst_rank = A.tileRank(move.first.tileIndex(), j);
+                    auto T = A(move.second.tileIndex(), j);
+                    blas::copy(
+                        nb,
+                        &T.at(move.second.elementOffset(), 0), T.rowIncrement(),
+                        &send_rows[ index[ dst_rank ] ], 1);
+                    index[ dst_rank ] += nb;
+                }
+            }
+        }
+    }
+
+    // Local rows need no communication.
+    std::copy( send_rows.data() + send_offsets[ mpi_rank ],
+               send_rows.data() + send_offsets[ mpi_rank+1 ],
+               recv_rows.data() + recv_offsets[ mpi_rank ] );
+
+    // Exchange one message each way with every peer.
+    {
+        std::vector<MPI_Request> requests( 2*comm_size );
+        int request_count = 0;
+        for (int r = 0; r < comm_size; ++r) {
+            int64_t count = recv_offsets[ r+1 ] - recv_offsets[ r ];
+            if (r != mpi_rank && count > 0) {
+                slate_assert(count <= INT_MAX);
+                slate_mpi_call(
+                    MPI_Irecv(&recv_rows[ recv_offsets[ r ] ], count, mpi_scalar,
+                              r, tag, comm, &requests[ request_count ]));
+                ++request_count;
+            }
+        }
+        for (int r = 0; r < comm_size; ++r) {
+            int64_t count = send_offsets[ r+1 ] - send_offsets[ r ];
+            if (r != mpi_rank && count > 0) {
+                slate_assert(count <= INT_MAX);
+                slate_mpi_call(
+                    MPI_Isend(&send_rows[ send_offsets[ r ] ], count, mpi_scalar,
+                              r, tag, comm, &requests[ request_count ]));
+                ++request_count;
+            }
+        }
+        slate_mpi_call(
+            MPI_Waitall(request_count, requests.data(),
+                        MPI_STATUSES_IGNORE));
+    }
+
+    // Unpack destination rows from workspace, a task per column.
+    #pragma omp taskgroup
+    for (int64_t j = 0; j < nt; ++j) {
+        #pragma omp task slate_omp_default_none \
+            shared( A, moves, recv_index, recv_rows ) \
+            firstprivate( j, comm_size, mpi_rank ) priority( priority )
+        {
+            int64_t nb = A.tileNb(j);
+            int64_t* index = &recv_index[ j*comm_size ];
+            for (auto const& move : moves) {
+                if (A.tileRank(move.first.tileIndex(), j) == mpi_rank) {
+                    int src_rank = A.tileRank(move.second.tileIndex(), j);
+                    auto T = A(move.first.tileIndex(), j);
+                    blas::copy(
+                        nb,
+                        &recv_rows[ index[ src_rank ] ], 1,
+                        &T.at(move.first.elementOffset(), 0), T.rowIncrement());
+                    index[ src_rank ] += nb;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Permutes rows out-of-place according to a parallel pivot map.
+/// Dispatches to target implementations.
+///
+/// @param[in] pivot_map
+///     Parallel pivot: pivot_map[ dst ] = src means row src is moved to
+///     row dst. Rows are relative to the first tile row of A.
+///     See composeParallelPivot.
+///
+/// @param[in,out] A
+///     The matrix to permute.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) to operate with.
+///
+/// @param[in] priority
+///     The priority to use for internal tasks.
+///
+/// @param[in] tag
+///     MPI tag for the communication.
+///
+/// @ingroup permute_internal
+///
+template <Target target, typename scalar_t>
+void permuteRowsMap(
+    std::map<Pivot, Pivot> const& pivot_map,
+    Matrix<scalar_t>&& A, Layout layout, int priority, int tag)
+{
+    permuteRowsMap(internal::TargetType<target>(), pivot_map, A,
+                   layout, priority, tag);
+}
+
 //------------------------------------------------------------------------------
 /// Swap a partial row of two tiles, either locally or remotely. Swaps
 ///     op1( A( ij_tuple_1 ) )[ offset_i1, j_offset : j_offset+n-1 ] and
@@ -1166,6 +1404,27 @@ void permuteRows< Target::Devices, std::complex<double> >(
     std::vector<Pivot>& pivot,
     Layout layout, int priority, int tag, int queue_index);
 
+// ----------------------------------------
+template
+void permuteRowsMap<Target::HostTask, float>(
+    std::map<Pivot, Pivot> const& pivot_map,
+    Matrix<float>&& A, Layout layout, int priority, int tag);
+
+template
+void permuteRowsMap<Target::HostTask, double>(
+    std::map<Pivot, Pivot> const& pivot_map,
+    Matrix<double>&& A, Layout layout, int priority, int tag);
+
+template
+void permuteRowsMap< Target::HostTask, std::complex<float> >(
+    std::map<Pivot, Pivot> const& pivot_map,
+    Matrix< std::complex<float> >&& A, Layout layout, int priority, int tag);
+
+template
+void permuteRowsMap< Target::HostTask, std::complex<double> >(
+    std::map<Pivot, Pivot> const& pivot_map,
+    Matrix< std::complex<double> >&& A, Layout layout, int priority, int tag);
+
 //------------------------------------------------------------------------------
 // Explicit instantiations for HermitianMatrix.
 // ----------------------------------------
@@ -0,0 +1,246 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Matrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "slate/types.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Copies op(X) into the column-major workspace tile W. If X is a diagonal
+/// tile of a triangular matrix, entries outside its triangle are set to
+/// zero, and for diag = Unit the diagonal is set to one; the stored entries
+/// there may belong to another factor, as in LU.
+/// @ingroup trmm_internal
+///
+template <typename scalar_t>
+void trtrmm_copy( Tile<scalar_t> const& X, Diag diag, Tile<scalar_t>& W )
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    Uplo uplo = X.uplo();
+    for (int64_t j = 0; j < X.nb(); ++j) {
+        for (int64_t i = 0; i < X.mb(); ++i) {
+            if (uplo != Uplo::General && i == j && diag == Diag::Unit)
+                W.at( i, j ) = one;
+            else if (uplo == Uplo::General
+                     || (uplo == Uplo::Lower && i >= j)
+                     || (uplo == Uplo::Upper && i <= j))
+                W.at( i, j ) = X( i, j );
+            else
+                W.at( i, j ) = zero;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Triangular matrix multiply, accumulated into a separate matrix:
+///     $C = \alpha op(A) B + C$ or
+///     $C = \alpha B op(A) + C$,
+/// where $A$ is a single triangular tile, and $B$ and $C$ are a block row
+/// (side = Left) or a block column (side = Right).
+/// Unlike gemm, this skips the zero triangle of $A$.
+/// Remote tiles are not released; the caller erases them.
+/// Dispatches to target implementations.
+/// @ingroup trmm_internal
+///
+template <Target target, typename scalar_t>
+void trmm_add(Side side,
+              scalar_t alpha, TriangularMatrix<scalar_t>&& A,
+                                        Matrix<scalar_t>&& B,
+                                        Matrix<scalar_t>&& C,
+              int priority)
+{
+    trmm_add(internal::TargetType<target>(),
+             side,
+             alpha, A, B, C,
+             priority);
+}
+
+//------------------------------------------------------------------------------
+/// Triangular matrix multiply, accumulated into a separate matrix.
+/// Host OpenMP task implementation.
+/// @ingroup trmm_internal
+///
+template <typename scalar_t>
+void trmm_add(internal::TargetType<Target::HostTask>,
+              Side side,
+              scalar_t alpha, TriangularMatrix<scalar_t>& A,
+                                        Matrix<scalar_t>& B,
+                                        Matrix<scalar_t>& C,
+              int priority)
+{
+    const scalar_t one = 1.0;
+    const Layout layout = Layout::ColMajor;
+
+    assert(A.mt() == 1 && A.nt() == 1);
+    assert(B.mt() == C.mt() && B.nt() == C.nt());
+    assert(side == Side::Left ? B.mt() == 1 : B.nt() == 1);
+
+    #pragma omp taskgroup
+    for (int64_t i = 0; i < C.mt(); ++i) {
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            if (C.tileIsLocal( i, j )) {
+                #pragma omp task slate_omp_default_none \
+                    shared( A, B, C ) \
+                    firstprivate( i, j, layout, side, alpha, one ) \
+                    priority( priority )
+                {
+                    A.tileGetForReading( 0, 0, LayoutConvert( layout ) );
+                    B.tileGetForReading( i, j, LayoutConvert( layout ) );
+                    C.tileGetForWriting( i, j, LayoutConvert( layout ) );
+
+                    auto Cij = C( i, j );
+                    int64_t mb = Cij.mb();
+                    int64_t nb = Cij.nb();
+                    std::vector<scalar_t> W_data( mb * nb );
+                    Tile<scalar_t> W( mb, nb, W_data.data(), mb,
+                                      HostNum, TileKind::UserOwned );
+
+                    // C += alpha op(A) B, or alpha B op(A).
+                    trtrmm_copy( B( i, j ), Diag::NonUnit, W );
+                    tile::trmm( side, A.diag(), alpha, A( 0, 0 ), W );
+                    tile::add( one, W, Cij );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Product of single triangular tiles, accumulated:
+///     $C = \alpha op(A) op(B) + C$.
+/// Only the triangles of $A$ and $B$ are read.
+/// Dispatches to target implementations.
+/// @ingroup trmm_internal
+///
+template <Target target, typename scalar_t>
+void trtrmm(scalar_t alpha, TriangularMatrix<scalar_t>&& A,
+                            TriangularMatrix<scalar_t>&& B,
+                                      Matrix<scalar_t>&& C,
+            int priority)
+{
+    trtrmm(internal::TargetType<target>(),
+           alpha, A, B, C,
+           priority);
+}
+
+//------------------------------------------------------------------------------
+/// Product of single triangular tiles, accumulated.
+/// Host implementation.
+/// @ingroup trmm_internal
+///
+template <typename scalar_t>
+void trtrmm(internal::TargetType<Target::HostTask>,
+            scalar_t alpha, TriangularMatrix<scalar_t>& A,
+                            TriangularMatrix<scalar_t>& B,
+                                      Matrix<scalar_t>& C,
+            int priority)
+{
+    const scalar_t one = 1.0;
+    const Layout layout = Layout::ColMajor;
+
+    assert(A.mt() == 1 && A.nt() == 1);
+    assert(B.mt() == 1 && B.nt() == 1);
+    assert(C.mt() == 1 && C.nt() == 1);
+
+    if (C.tileIsLocal( 0, 0 )) {
+        A.tileGetForReading( 0, 0, LayoutConvert( layout ) );
+        B.tileGetForReading( 0, 0, LayoutConvert( layout ) );
+        C.tileGetForWriting( 0, 0, LayoutConvert( layout ) );
+
+        auto C00 = C( 0, 0 );
+        int64_t mb = C00.mb();
+        int64_t nb = C00.nb();
+        std::vector<scalar_t> W_data( mb * nb );
+        Tile<scalar_t> W( mb, nb, W_data.data(), mb,
+                          HostNum, TileKind::UserOwned );
+
+        // W = op(B) with zero triangle; W = alpha op(A) W; C += W.
+        trtrmm_copy( B( 0, 0 ), B.diag(), W );
+        tile::trmm( Side::Left, A.diag(), alpha, A( 0, 0 ), W );
+        tile::add( one, W, C00 );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void trmm_add<Target::HostTask, float>(
+    Side side,
+    float alpha, TriangularMatrix<float>&& A,
+                           Matrix<float>&& B,
+                           Matrix<float>&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void trmm_add<Target::HostTask, double>(
+    Side side,
+    double alpha, TriangularMatrix<double>&& A,
+                            Matrix<double>&& B,
+                            Matrix<double>&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void trmm_add< Target::HostTask, std::complex<float> >(
+    Side side,
+    std::complex<float> alpha, TriangularMatrix< std::complex<float> >&& A,
+                                         Matrix< std::complex<float> >&& B,
+                                         Matrix< std::complex<float> >&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void trmm_add< Target::HostTask, std::complex<double> >(
+    Side side,
+    std::complex<double> alpha, TriangularMatrix< std::complex<double> >&& A,
+                                          Matrix< std::complex<double> >&& B,
+                                          Matrix< std::complex<double> >&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void trtrmm<Target::HostTask, float>(
+    float alpha, TriangularMatrix<float>&& A,
+                 TriangularMatrix<float>&& B,
+                           Matrix<float>&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void trtrmm<Target::HostTask, double>(
+    double alpha, TriangularMatrix<double>&& A,
+                  TriangularMatrix<double>&& B,
+                            Matrix<double>&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void trtrmm< Target::HostTask, std::complex<float> >(
+    std::complex<float> alpha, TriangularMatrix< std::complex<float> >&& A,
+                               TriangularMatrix< std::complex<float> >&& B,
+                                         Matrix< std::complex<float> >&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void trtrmm< Target::HostTask, std::complex<double> >(
+    std::complex<double> alpha, TriangularMatrix< std::complex<double> >&& A,
+                                TriangularMatrix< std::complex<double> >&& B,
+                                          Matrix< std::complex<double> >&& C,
+    int priority);
+
+} // namespace internal
+} // namespace slate
@@ -9,6 +9,10 @@
 #include "internal/internal.hh"
 #include "internal/internal_util.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+
 namespace slate {
 namespace internal {
 
@@ -36,6 +40,9 @@ void ttmqr(Side side, Op op,
 //------------------------------------------------------------------------------
 /// Distributed multiply matrix by Q from QR triangle-triangle factorization of
 /// column of tiles, host implementation.
+/// Each local tile of C in the tree moves to its next level as soon as its
+/// exchange in the previous level completes, so block columns (or rows)
+/// are pipelined through the levels, with no synchronization per level.
 /// @ingroup geqrf_internal
 ///
 template <typename scalar_t>
@@ -103,8 +110,6 @@ void ttmqr(internal::TargetType<Target::HostTask>,
         step = 1;
 
     int64_t k_end;
-    int64_t i, j, i1, j1, i_dst, j_dst;
-
     if (side == Side::Left) {
         k_end = C.nt();
     }
@@ -112,150 +117,291 @@ void ttmqr(internal::TargetType<Target::HostTask>,
         k_end = C.mt();
     }
 
+    int mpi_rank = C.mpiRank();
+
+    // Exchange of a pair of tiles in one level, seen from the rank with
+    // local tile C(i, j), in block column (if side == left) or block row
+    // (if side == right) k of C. The other tile of the pair, C(i1, j1),
+    // is on rank pair_rank. The first node sends its tile to the second
+    // node, which applies Q from row rank_ind of A to both tiles, then
+    // sends the first tile back updated.
+    // Communication for block column or row k uses tag + k, so each one
+    // proceeds independently of the others. Messages of one block column
+    // between two ranks are sent and received in level order, so they
+    // match across levels.
+    struct PairTile {
+        int64_t i, j, i1, j1, k, rank_ind;
+        int level;
+        int pair_rank;
+        bool first;
+        int64_t partner;    ///< chain of C(i1, j1), if local
+        int64_t back;       ///< index of send back, for second node
+    };
+
+    // Each local tile of C in the tree is a chain of exchanges, one per
+    // level in which it takes part, in level order.
+    std::map< std::pair<int64_t, int64_t>, int64_t > chain_index;
+    std::vector< std::vector<PairTile> > chains;
+    int64_t nback = 0;
     for (int level = 0; level < nlevels; ++level) {
         for (int index = 0; index < nranks; index += step) {
+            bool first = index % (2*step) == 0;
+            if (first && index + step >= nranks)
+                continue;
+
             int64_t rank_ind = rank_indices[ index ].second;
-            // if (side == left), scan rows of C for local tiles;
-            // if (side == right), scan cols of C for local tiles
-            // Three for-loops: 1) send, receive 2) update 3) receive, send
+            int64_t pair_ind
+                = rank_indices[ first ? index + step : index - step ].second;
             for (int64_t k = 0; k < k_end; ++k) {
+                PairTile t;
+                t.k = k;
+                t.level = level;
+                t.first = first;
+                t.rank_ind = rank_ind;
+                t.partner = -1;
+                t.back = -1;
                 if (side == Side::Left) {
-                    i = rank_ind;
-                    j = k;
+                    t.i  = rank_ind;
+                    t.j  = k;
+                    t.i1 = pair_ind;
+                    t.j1 = k;
                 }
                 else {
-                    i = k;
-                    j = rank_ind;
+                    t.i  = k;
+                    t.j  = rank_ind;
+                    t.i1 = k;
+                    t.j1 = pair_ind;
+                }
+                if (C.tileIsLocal(t.i, t.j)) {
+                    t.pair_rank = C.tileRank(t.i1, t.j1);
+                    if (! first)
+                        t.back = nback++;
+                    auto ij = std::make_pair( t.i, t.j );
+                    if (chain_index.count( ij ) == 0) {
+                        chain_index[ ij ] = chains.size();
+                        chains.push_back( {} );
+                    }
+                    chains[ chain_index[ ij ] ].push_back( t );
+                }
+            }
+        }
+
+        if (descend)
+            step /= 2;
+        else
+            step *= 2;
+    }
+    for (auto& chain : chains) {
+        for (auto& t : chain) {
+            if (t.pair_rank == mpi_rank)
+                t.partner = chain_index[ std::make_pair( t.i1, t.j1 ) ];
+        }
+    }
+
+    // Pipeline the chains through the levels: each chain posts its next
+    // exchange as soon as its previous one completes, instead of all
+    // chains waiting for the slowest at each level.
+    // Stages of a chain's current exchange, which completes with its
+    // MPI request (send, recv_back, recv), its update task (update),
+    // or the update task of its local partner (wait_local).
+    // If this rank has several tiles in the tree of one block column,
+    // as with a non-2D-block-cyclic distribution, a chain is blocked
+    // until this rank's exchanges of earlier levels in that block column
+    // are done, so messages with the same tag match in level order.
+    enum {
+        stage_blocked, stage_start, stage_send, stage_recv_back, stage_recv,
+        stage_update, stage_wait_local, stage_done,
+    };
+    int64_t nchains = chains.size();
+    std::vector<size_t> pos( nchains, 0 );
+    std::vector<int> stage( nchains, stage_start );
+    std::vector<MPI_Request> requests( nchains, MPI_REQUEST_NULL );
+    std::vector<MPI_Request> back_requests( nback, MPI_REQUEST_NULL );
+    std::vector< std::atomic<int> > updated( nchains );
+    for (auto& u : updated)
+        u = 0;
+
+    std::vector<int64_t> ready( nchains );
+    for (int64_t c = 0; c < nchains; ++c)
+        ready[ c ] = c;
+    // pending[ k ][ level ] counts this rank's unfinished exchanges.
+    std::vector< std::vector<int> > pending(
+        k_end, std::vector<int>( nlevels, 0 ) );
+    std::vector< std::vector<int64_t> > blocked( k_end );
+    for (auto& chain : chains) {
+        for (auto& t : chain)
+            ++pending[ t.k ][ t.level ];
+    }
+
+    std::vector<int64_t> to_update;
+    int64_t nactive = nchains;
+    int64_t nupdating = 0;
+
+    #pragma omp taskgroup
+    {
+        while (nactive > 0) {
+            // Advance chains whose current stage completed.
+            while (! ready.empty()) {
+                int64_t c = ready.back();
+                ready.pop_back();
+                if (pos[ c ] == chains[ c ].size()) {
+                    stage[ c ] = stage_done;
+                    --nactive;
+                    continue;
                 }
-                if (C.tileIsLocal(i, j)) {
-                    if (index % (2*step) == 0) {
-                        if (index + step < nranks) {
-                            // Send tile to dst.
-                            int64_t k_dst = rank_indices[ index + step ].second;
-                            if (side == Side::Left) {
-                                i_dst = k_dst;
-                                j_dst = k;
+                PairTile& t = chains[ c ][ pos[ c ] ];
+                switch (stage[ c ]) {
+                    case stage_start:
+                        if (std::any_of( pending[ t.k ].begin(),
+                                         pending[ t.k ].begin() + t.level,
+                                         []( int n ) { return n > 0; } )) {
+                            stage[ c ] = stage_blocked;
+                            blocked[ t.k ].push_back( c );
+                            break;
+                        }
+                        if (t.first) {
+                            // GetForWriting because it will be received back.
+                            C.tileGetForWriting(t.i, t.j,
+                                                LayoutConvert(layout));
+                            if (t.pair_rank != mpi_rank) {
+                                C.tileIsend(t.i, t.j, t.pair_rank, tag + t.k,
+                                            &requests[ c ]);
+                                stage[ c ] = stage_send;
                             }
                             else {
-                                i_dst = k;
-                                j_dst = k_dst;
+                                stage[ c ] = stage_wait_local;
+                                int64_t p = t.partner;
+                                if (stage[ p ] == stage_wait_local
+                                    && chains[ p ][ pos[ p ] ].level == t.level)
+                                    to_update.push_back( p );
                             }
-                            int dst = C.tileRank(i_dst, j_dst);
-                            // GetForWriting because it will be received in the later loop
-                            C.tileGetForWriting(i, j, LayoutConvert(layout));
-                            C.tileSend(i, j, dst, tag);
                         }
-                    }
-                    else {
-                        // Receive tile from src.
-                        int64_t k_src = rank_indices[ index - step ].second;
-                        if (side == Side::Left) {
-                            i1 = k_src;
-                            j1 = k;
+                        else if (t.pair_rank != mpi_rank) {
+                            C.tileIrecv(t.i1, t.j1, t.pair_rank, layout,
+                                        tag + t.k, &requests[ c ]);
+                            stage[ c ] = stage_recv;
                         }
                         else {
-                            i1 = k;
-                            j1 = k_src;
+                            stage[ c ] = stage_wait_local;
+                            int64_t p = t.partner;
+                            if (stage[ p ] == stage_wait_local
+                                && chains[ p ][ pos[ p ] ].level == t.level)
+                                to_update.push_back( c );
                         }
+                        break;
 
-                        int     src   = C.tileRank(i1, j1);
-                        C.tileRecv(i1, j1, src, layout, tag);
-                    }
-                }
-            }
+                    case stage_send:
+                        // Once the tile is sent, receive it back updated.
+                        assert( (C.tileState( t.i, t.j, HostNum )
+                                 & MOSI::Modified) != 0 );
+                        C.tileIrecv(t.i, t.j, t.pair_rank, layout, tag + t.k,
+                                    &requests[ c ]);
+                        stage[ c ] = stage_recv_back;
+                        break;
 
-            #pragma omp taskgroup
-            for (int64_t k = 0; k < k_end; ++k) {
-                if (side == Side::Left) {
-                    i = rank_ind;
-                    j = k;
-                }
-                else {
-                    i = k;
-                    j = rank_ind;
-                }
-                if (C.tileIsLocal(i, j)) {
-                    if (!(index % (2*step) == 0)) {
-                        int64_t k_src = rank_indices[ index - step ].second;
-                        if (side == Side::Left) {
-                            i1 = k_src;
-                            j1 = k;
-                        }
-                        else {
-                            i1 = k;
-                            j1 = k_src;
+                    case stage_recv:
+                        to_update.push_back( c );
+                        break;
+
+                    case stage_update:
+                        if (t.pair_rank == mpi_rank) {
+                            // The first node's tile is back, too.
+                            stage[ t.partner ] = stage_recv_back;
+                            ready.push_back( t.partner );
                         }
+                        [[fallthrough]];
 
-                        #pragma omp task slate_omp_default_none \
-                            shared( A, T, C ) \
-                            firstprivate(i, j, layout, rank_ind, side, op, i1, j1)
-                        {
-                            A.tileGetForReading(rank_ind, 0, LayoutConvert(layout));
-                            T.tileGetForReading(rank_ind, 0, LayoutConvert(layout));
-                            C.tileGetForWriting(i, j, LayoutConvert(layout));
-
-                            // Apply Q.
-                            tpmqrt(side, op, std::min(A.tileMb(rank_ind), A.tileNb(0)),
-                                   A(rank_ind, 0), T(rank_ind, 0),
-                                   C(i1, j1), C(i, j));
-
-                            // todo: should tileRelease()?
-                            A.tileTick(rank_ind, 0);
-                            T.tileTick(rank_ind, 0);
+                    case stage_recv_back:
+                        if (--pending[ t.k ][ t.level ] == 0) {
+                            for (int64_t b : blocked[ t.k ]) {
+                                stage[ b ] = stage_start;
+                                ready.push_back( b );
+                            }
+                            blocked[ t.k ].clear();
                         }
-                    }
+                        ++pos[ c ];
+                        stage[ c ] = stage_start;
+                        ready.push_back( c );
+                        break;
                 }
             }
 
-            for (int64_t k = 0; k < k_end; ++k) {
-                if (side == Side::Left) {
-                    i = rank_ind;
-                    j = k;
+            // Apply Q to each pair whose tiles are both here, then send the
+            // updated tile back.
+            for (int64_t c : to_update) {
+                stage[ c ] = stage_update;
+                ++nupdating;
+                PairTile* t = &chains[ c ][ pos[ c ] ];
+                #pragma omp task slate_omp_default_none \
+                    shared( A, T, C, updated, back_requests ) \
+                    firstprivate( t, c, layout, side, op, tag )
+                {
+                    int64_t rank_ind = t->rank_ind;
+                    A.tileGetForReading(rank_ind, 0, LayoutConvert(layout));
+                    T.tileGetForReading(rank_ind, 0, LayoutConvert(layout));
+                    C.tileGetForWriting(t->i, t->j, LayoutConvert(layout));
+
+                    // Apply Q.
+                    tpmqrt(side, op, std::min(A.tileMb(rank_ind), A.tileNb(0)),
+                           A(rank_ind, 0), T(rank_ind, 0),
+                           C(t->i1, t->j1), C(t->i, t->j));
+
+                    // todo: should tileRelease()?
+                    A.tileTick(rank_ind, 0);
+                    T.tileTick(rank_ind, 0);
+
+                    // Send updated tile back.
+                    C.tileIsend(t->i1, t->j1, t->pair_rank, tag + t->k,
+                                &back_requests[ t->back ]);
+                    updated[ c ] = 1;
                 }
-                else {
-                    i = k;
-                    j = rank_ind;
+            }
+            to_update.clear();
+
+            if (nactive == 0)
+                break;
+
+            // Wait for the next completion: an update task, or a message.
+            for (int64_t c = 0; c < nchains; ++c) {
+                if (stage[ c ] == stage_update && updated[ c ]) {
+                    updated[ c ] = 0;
+                    --nupdating;
+                    ready.push_back( c );
                 }
-                if (C.tileIsLocal(i, j)) {
-                    if (index % (2*step) == 0) {
-                        if (index + step < nranks) {
-                            // Receive updated tile back.
-                            int64_t k_dst = rank_indices[ index + step ].second;
-                            if (side == Side::Left) {
-                                i_dst = k_dst;
-                                j_dst = k;
-                            }
-                            else {
-                                i_dst = k;
-                                j_dst = k_dst;
-                            }
-                            int dst = C.tileRank(i_dst, j_dst);
-                            assert( (C.tileState( i, j, HostNum ) & MOSI::Modified) != 0 );
-                            C.tileRecv(i, j, dst, layout, tag);
-                        }
-                    }
-                    else {
-                        int64_t k_src = rank_indices[ index - step ].second;
-                        if (side == Side::Left) {
-                            i1 = k_src;
-                            j1 = k;
-                        }
-                        else {
-                            i1 = k;
-                            j1 = k_src;
-                        }
-                        int     src   = C.tileRank(i1, j1);
-                        // Send updated tile back.
-                        C.tileSend(i1, j1, src, tag);
-                        C.tileTick(i1, j1);
-                    }
+            }
+            if (! ready.empty())
+                continue;
+
+            int index;
+            if (nupdating > 0) {
+                // Poll, so finished update tasks are seen promptly.
+                int flag;
+                slate_mpi_call(
+                    MPI_Testany(nchains, requests.data(), &index, &flag,
+                                MPI_STATUS_IGNORE));
+                if (! flag || index == MPI_UNDEFINED) {
+                    #pragma omp taskyield
+                    continue;
                 }
             }
+            else {
+                slate_mpi_call(
+                    MPI_Waitany(nchains, requests.data(), &index,
+                                MPI_STATUS_IGNORE));
+                slate_assert( index != MPI_UNDEFINED );
+            }
+            ready.push_back( index );
+        }
+    }
+
+    // Finish sending tiles back, then release the received copies.
+    slate_mpi_call(
+        MPI_Waitall(nback, back_requests.data(), MPI_STATUSES_IGNORE));
+    for (auto& chain : chains) {
+        for (auto& t : chain) {
+            if (! t.first && t.pair_rank != mpi_rank)
+                C.tileTick(t.i1, t.j1);
         }
-        if (descend)
-            step /= 2;
-        else
-            step *= 2;
     }
 }
 
@@ -32,7 +32,9 @@ void unmlq(Side side, Op op,
 /// C = op(Q) C for side = left, or
 /// C = C op(Q) for side = right.
 /// Assumes V and T are each a single block-row.
-/// Assumes W and C have the same dimensions and distribution.
+/// W is workspace from internal::unmqr_workspace: one tile row of W
+/// matching the columns of C (side = left), or one tile column of W
+/// matching the rows of C (side = right).
 /// This corresponds to larfb( ..., direct=Forward, storev=Rowwise, ... ).
 /// This does not include applying the distributed triangle-triangle reductions.
 /// @ingroup gelqf_internal
@@ -53,8 +55,10 @@ void unmlq(internal::TargetType<target>,
     assert(mt >= 1);
     assert(nt >= 1);
     assert(V.mt() == 1);
-    assert(W.mt() == mt);
-    assert(W.nt() == nt);
+    assert(side == Side::Left  || W.mt() == mt);
+    assert(side == Side::Left  || W.nt() == 1);
+    assert(side == Side::Right || W.mt() == 1);
+    assert(side == Side::Right || W.nt() == nt);
 
     // Assumes column major
     const Layout layout = Layout::ColMajor;
@@ -88,8 +92,8 @@ void unmlq(internal::TargetType<target>,
         assert(first < mt);
         assert(first >= 0);
 
-        // Get corresponding row of W to match the local matrix distribution.
-        auto Wr = W.sub(first, first, 0, nt-1);
+        // W holds one tile row, sized like row `first` of C.
+        auto Wr = W.slice(0, C.tileMb(first)-1, 0, W.n()-1);
         Wr.insertLocalTiles();
 
         // V = [ V0  V0b  V1 ]
@@ -265,8 +269,8 @@ void unmlq(internal::TargetType<target>,
         assert(first < nt);
         assert(first >= 0);
 
-        // Get corresponding col of W to match the local matrix distribution.
-        auto Wc = W.sub(0, mt-1, first, first);
+        // W holds one tile col, sized like col `first` of C.
+        auto Wc = W.slice(0, W.m()-1, 0, C.tileNb(first)-1);
         Wc.insertLocalTiles();
 
         // V = [ V0  V0b  V1 ]
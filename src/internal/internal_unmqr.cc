@@ -33,7 +33,9 @@ void unmqr(Side side, Op op,
 /// C = op(Q) C for side = left, or
 /// C = C op(Q) for side = right.
 /// Assumes V and T are each a single block-column.
-/// Assumes W and C have the same dimensions and distribution.
+/// W is workspace from internal::unmqr_workspace: one tile row of W
+/// matching the columns of C (side = left), or one tile column of W
+/// matching the rows of C (side = right).
 /// This corresponds to larfb( ..., direct=Forward, storev=Columnwise, ... ).
 /// This does not include applying the distributed triangle-triangle reductions.
 /// @ingroup geqrf_internal
@@ -55,8 +57,10 @@ void unmqr(internal::TargetType<target>,
     assert(mt >= 1);
     assert(nt >= 1);
     assert(V.nt() == 1);
-    assert(W.mt() == mt);
-    assert(W.nt() == nt);
+    assert(side == Side::Left  || W.mt() == mt);
+    assert(side == Side::Left  || W.nt() == 1);
+    assert(side == Side::Right || W.mt() == 1);
+    assert(side == Side::Right || W.nt() == nt);
 
     // Assumes column major
     const Layout layout = Layout::ColMajor;
@@ -90,8 +94,8 @@ void unmqr(internal::TargetType<target>,
         assert(first < mt);
         assert(first >= 0);
 
-        // Get corresponding row of W to match the local matrix distribution.
-        auto Wr = W.sub(first, first, 0, nt-1);
+        // W holds one tile row, sized like row `first` of C.
+        auto Wr = W.slice(0, C.tileMb(first)-1, 0, W.n()-1);
         Wr.insertLocalTiles(target);
 
         // V = [ V0  ]  triangular part (nb-by-nb)
@@ -272,8 +276,8 @@ void unmqr(internal::TargetType<target>,
         assert(first < nt);
         assert(first >= 0);
 
-        // Get corresponding col of W to match the local matrix distribution.
-        auto Wc = W.sub(0, mt-1, first, first);
+        // W holds one tile col, sized like col `first` of C.
+        auto Wc = W.slice(0, W.m()-1, 0, C.tileNb(first)-1);
         Wc.insertLocalTiles(target);
 
         // V = [ V0  ]  triangular part (nb-by-nb)
@@ -427,6 +431,70 @@ void unmqr(internal::TargetType<target>,
     }
 }
 
+//------------------------------------------------------------------------------
+/// Returns workspace W for internal::unmqr and internal::unmlq applied to C:
+/// one tile row with the column tiling of C (side = left), or one tile
+/// column with the row tiling of C (side = right). Each process computes
+/// W only for its own top-most row (left-most col) of C in the panel, so
+/// W is local to the process and is reused across panels. Tile j of W is
+/// local, and on the same device, if the process has tiles in col j
+/// (row j) of C. This assumes the process's tiles of C in a tile column
+/// (row) have the same ranks and devices, as in 2D block-cyclic layouts.
+/// Tiles are not allocated; internal::unmqr inserts and erases them.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+Matrix<scalar_t> unmqr_workspace(Side side, Matrix<scalar_t>& C)
+{
+    using ij_tuple = typename Matrix<scalar_t>::ij_tuple;
+
+    int mpi_rank = C.mpiRank();
+    bool left = (side == Side::Left);
+    int64_t mt = C.mt();
+    int64_t nt = C.nt();
+    int64_t kt = left ? nt : mt;   // tiles in W
+    int64_t lt = left ? mt : nt;   // tiles along the other dimension
+
+    // Size, rank, and device of each tile of W, from this process's
+    // first tile of C in that col (row), or from C's first tile if none.
+    std::vector<int64_t> size( kt );
+    std::vector<int> rank( kt ), device( kt, HostNum );
+    int64_t width = 1;
+    for (int64_t j = 0; j < kt; ++j) {
+        size[ j ] = left ? C.tileNb( j ) : C.tileMb( j );
+        rank[ j ] = left ? C.tileRank( 0, j ) : C.tileRank( j, 0 );
+        for (int64_t i = 0; i < lt; ++i) {
+            if (left ? C.tileIsLocal( i, j ) : C.tileIsLocal( j, i )) {
+                rank[ j ] = mpi_rank;
+                device[ j ] = left ? C.tileDevice( i, j ) : C.tileDevice( j, i );
+                break;
+            }
+        }
+    }
+    for (int64_t i = 0; i < lt; ++i)
+        width = std::max( width, left ? C.tileMb( i ) : C.tileNb( i ) );
+
+    std::function<int64_t (int64_t)> tileSize = [size]( int64_t j ) {
+        return size[ j ];
+    };
+    std::function<int64_t (int64_t)> tileWidth = [width]( int64_t i ) {
+        return width;
+    };
+    std::function<int (ij_tuple)> tileRank = [rank, left]( ij_tuple ij ) {
+        return rank[ left ? std::get<1>( ij ) : std::get<0>( ij ) ];
+    };
+    std::function<int (ij_tuple)> tileDevice = [device, left]( ij_tuple ij ) {
+        return device[ left ? std::get<1>( ij ) : std::get<0>( ij ) ];
+    };
+
+    if (left)
+        return Matrix<scalar_t>( width, C.n(), tileWidth, tileSize,
+                                 tileRank, tileDevice, C.mpiComm() );
+    else
+        return Matrix<scalar_t>( C.m(), width, tileSize, tileWidth,
+                                 tileRank, tileDevice, C.mpiComm() );
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 // ----------------------------------------
@@ -577,5 +645,22 @@ void unmqr< Target::Devices, std::complex<double> >(
     Matrix< std::complex<double> >&& W,
     int priority, int64_t queue_index);
 
+// ----------------------------------------
+template
+Matrix<float> unmqr_workspace<float>(
+    Side side, Matrix<float>& C);
+
+template
+Matrix<double> unmqr_workspace<double>(
+    Side side, Matrix<double>& C);
+
+template
+Matrix< std::complex<float> > unmqr_workspace< std::complex<float> >(
+    Side side, Matrix< std::complex<float> >& C);
+
+template
+Matrix< std::complex<double> > unmqr_workspace< std::complex<double> >(
+    Side side, Matrix< std::complex<double> >& C);
+
 } // namespace internal
 } // namespace slate
@@ -0,0 +1,188 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal_io.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel write of a matrix to a file, using MPI-IO.
+/// Each rank writes its local tiles directly through a file view matching
+/// the matrix distribution, with a single collective write.
+/// Collective over A's MPI communicator.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] filename
+///     File to write. Created, or truncated if it exists.
+///
+/// @param[in] A
+///     The m-by-n matrix A to write. Local tiles are converted to
+///     column-major on the host. Transposed matrices are not supported.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::FileFormat:
+///       - FileFormat::Tiled (default): SLATE tiled binary format,
+///         a 64 byte header with m, n, mb, nb, precision, and layout,
+///         followed by mb-by-nb tiles. The tile size is that of A's
+///         first tile. Block columns are stored one after another, tiles
+///         within a block column top to bottom, each tile column-major.
+///       - FileFormat::ColMajor: raw m-by-n column-major matrix with
+///         leading dimension m, without header, e.g., for interoperability
+///         with other codes.
+///
+///     Values are in native byte order.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void write(
+    const char* filename,
+    Matrix<scalar_t>& A,
+    Options const& opts)
+{
+    FileFormat format = get_option( opts, Option::FileFormat, FileFormat::Tiled );
+
+    internal::IORequest request;
+    internal::iwrite( filename, A, format, request );
+    request.wait();
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel read of a matrix from a file, using MPI-IO.
+/// Each rank reads its local tiles directly through a file view matching
+/// the matrix distribution, with a single collective read.
+/// The tile size and distribution of A need not match those used to write
+/// the file. Use read_header() to get the dimensions to create A.
+/// Collective over A's MPI communicator.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] filename
+///     File to read.
+///
+/// @param[in,out] A
+///     On entry, the m-by-n matrix A, with local tiles allocated.
+///     On exit, A is read from the file, with column-major local tiles.
+///     For FileFormat::Tiled, m, n, and precision must match the file.
+///     Transposed matrices are not supported.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::FileFormat:
+///       FileFormat::Tiled (default) or FileFormat::ColMajor.
+///       See write().
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void read(
+    const char* filename,
+    Matrix<scalar_t>& A,
+    Options const& opts)
+{
+    FileFormat format = get_option( opts, Option::FileFormat, FileFormat::Tiled );
+
+    internal::IORequest request;
+    internal::iread( filename, A, format, request );
+    request.wait();
+}
+
+//------------------------------------------------------------------------------
+/// Reads dimensions and tile size from a file in FileFormat::Tiled,
+/// e.g., to create the matrix passed to read().
+/// Collective over mpi_comm.
+///
+/// @param[in] filename
+///     File to read.
+///
+/// @param[out] m
+///     Number of rows of the matrix in the file.
+///
+/// @param[out] n
+///     Number of columns of the matrix in the file.
+///
+/// @param[out] mb
+///     Tile rows in the file.
+///
+/// @param[out] nb
+///     Tile columns in the file.
+///
+/// @param[in] mpi_comm
+///     MPI communicator of the ranks reading the file.
+///
+/// @ingroup io
+///
+void read_header(
+    const char* filename,
+    int64_t* m, int64_t* n, int64_t* mb, int64_t* nb,
+    MPI_Comm mpi_comm)
+{
+    internal::FileHeader header;
+    internal::read_header( filename, header, mpi_comm );
+    *m  = header.m;
+    *n  = header.n;
+    *mb = header.mb;
+    *nb = header.nb;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void write<float>(
+    const char* filename,
+    Matrix<float>& A,
+    Options const& opts);
+
+template
+void write<double>(
+    const char* filename,
+    Matrix<double>& A,
+    Options const& opts);
+
+template
+void write< std::complex<float> >(
+    const char* filename,
+    Matrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void write< std::complex<double> >(
+    const char* filename,
+    Matrix< std::complex<double> >& A,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void read<float>(
+    const char* filename,
+    Matrix<float>& A,
+    Options const& opts);
+
+template
+void read<double>(
+    const char* filename,
+    Matrix<double>& A,
+    Options const& opts);
+
+template
+void read< std::complex<float> >(
+    const char* filename,
+    Matrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void read< std::complex<double> >(
+    const char* filename,
+    Matrix< std::complex<double> >& A,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,121 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal_ooc.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Moves the local tiles of a matrix from memory to its per-rank
+/// out-of-core tile file, for use by the out-of-core drivers
+/// potrf_ooc, getrf_ooc, etc. The tiles are erased from memory.
+/// Each rank writes only its own file; there is no communication.
+///
+/// Tiles not in memory are skipped, so a matrix larger than memory can be
+/// stored a few block columns at a time: insert and fill the tiles of some
+/// block columns, call ooc_store, and repeat.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     The matrix to store, not transposed. For a trapezoid, triangular,
+///     symmetric, or Hermitian matrix, only the stored triangle is written.
+///     The file layout depends on the full matrix, so A must not be a
+///     submatrix; stored tiles that are not in memory are skipped.
+///     On exit, no stored tiles of A are in memory.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::OutOfCoreFile:
+///       Prefix of the tile file names, `<prefix>.<rank>`. Required.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void ooc_store(
+    BaseMatrix<scalar_t>& A,
+    Options const& opts)
+{
+    internal::TileFile<scalar_t> file( A, opts );
+    file.write( 0, A.mt()-1, 0, A.nt()-1 );
+    file.flush();
+}
+
+//------------------------------------------------------------------------------
+/// Loads the local tiles of a matrix from its per-rank out-of-core tile
+/// file into host memory, e.g., to access the factors computed by an
+/// out-of-core driver. The file is kept.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     The matrix to load, not transposed, with the same distribution and
+///     tile sizes as when stored. Stored tiles already in memory are kept.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::OutOfCoreFile:
+///       Prefix of the tile file names, `<prefix>.<rank>`. Required.
+///
+/// @ingroup io
+///
+template <typename scalar_t>
+void ooc_load(
+    BaseMatrix<scalar_t>& A,
+    Options const& opts)
+{
+    internal::TileFile<scalar_t> file( A, opts );
+    file.read( 0, A.mt()-1, 0, A.nt()-1 ).get();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ooc_store<float>(
+    BaseMatrix<float>& A,
+    Options const& opts);
+
+template
+void ooc_store<double>(
+    BaseMatrix<double>& A,
+    Options const& opts);
+
+template
+void ooc_store< std::complex<float> >(
+    BaseMatrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void ooc_store< std::complex<double> >(
+    BaseMatrix< std::complex<double> >& A,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void ooc_load<float>(
+    BaseMatrix<float>& A,
+    Options const& opts);
+
+template
+void ooc_load<double>(
+    BaseMatrix<double>& A,
+    Options const& opts);
+
+template
+void ooc_load< std::complex<float> >(
+    BaseMatrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void ooc_load< std::complex<double> >(
+    BaseMatrix< std::complex<double> >& A,
+    Options const& opts);
+
+} // namespace slate
@@ -9,6 +9,7 @@
 #include "slate/HermitianMatrix.hh"
 #include "slate/TriangularMatrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_checkpoint.hh"
 
 namespace slate {
 
@@ -23,7 +24,7 @@ namespace impl {
 template <Target target, typename scalar_t>
 void potrf(
     slate::internal::TargetType<target>,
-    HermitianMatrix<scalar_t> A,
+    HermitianMatrix<scalar_t> A, int64_t k_start,
     Options const& opts )
 {
     using real_t = blas::real_type<scalar_t>;
@@ -47,13 +48,23 @@ void potrf(
     std::vector< uint8_t > column_vector(A_nt);
     uint8_t* column = column_vector.data();
 
+    // Checkpoint every CheckpointInterval panels, if enabled.
+    internal::Checkpoint<scalar_t> checkpoint(
+        "potrf", opts, k_start, A.mpiComm() );
+
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
 
     #pragma omp parallel
     #pragma omp master
     {
-        for (int64_t k = 0; k < A_nt; ++k) {
+        for (int64_t k = k_start; k < A_nt; ++k) {
+            // Save A after panels 0:k-1 and their updates are complete.
+            if (checkpoint.due( k )) {
+                #pragma omp taskwait
+                checkpoint.save( k, A );
+            }
+
             // panel, high priority
             #pragma omp task depend(inout:column[k]) priority(1)
             {
@@ -126,6 +137,8 @@ void potrf(
         // A.tileUpdateAllOrigin();
     }
 
+    checkpoint.finish();
+
     // Debug::checkTilesLives(A);
     // Debug::printTilesLives(A);
     A.tileUpdateAllOrigin();
@@ -140,7 +153,7 @@ void potrf(
 template <typename scalar_t>
 void potrf(
     slate::internal::TargetType<Target::Devices>,
-    HermitianMatrix<scalar_t> A,
+    HermitianMatrix<scalar_t> A, int64_t k_start,
     Options const& opts )
 {
     using real_t = blas::real_type<scalar_t>;
@@ -199,13 +212,23 @@ void potrf(
         device_info_array[dev] = blas::device_malloc<device_info_int>( 1, *queue );
     }
 
+    // Checkpoint every CheckpointInterval panels, if enabled.
+    internal::Checkpoint<scalar_t> checkpoint(
+        "potrf", opts, k_start, A.mpiComm() );
+
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
 
     #pragma omp parallel
     #pragma omp master
     {
-        for (int64_t k = 0; k < A_nt; ++k) {
+        for (int64_t k = k_start; k < A_nt; ++k) {
+            // Save A after panels 0:k-1 and their updates are complete.
+            if (checkpoint.due( k )) {
+                #pragma omp taskwait
+                checkpoint.save( k, A );
+            }
+
             // Panel, normal priority
             #pragma omp task depend(inout:column[k])
             {
@@ -304,6 +327,8 @@ void potrf(
         #pragma omp taskwait
         A.tileUpdateAllOrigin();
     }
+    checkpoint.finish();
+
     if (hold_local_workspace == false) {
         A.releaseWorkspace();
     }
@@ -313,6 +338,40 @@ void potrf(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Distributed parallel Cholesky factorization, starting from panel k_start.
+/// Dispatches to target implementations.
+/// @ingroup posv_impl
+///
+template <typename scalar_t>
+void potrf(
+    HermitianMatrix<scalar_t>& A, int64_t k_start,
+    Options const& opts )
+{
+    using internal::TargetType;
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+            potrf( TargetType<Target::HostTask>(), A, k_start, opts );
+            break;
+
+        case Target::HostNest:
+            potrf( TargetType<Target::HostNest>(), A, k_start, opts );
+            break;
+
+        case Target::HostBatch:
+            potrf( TargetType<Target::HostBatch>(), A, k_start, opts );
+            break;
+
+        case Target::Devices:
+            potrf( TargetType<Target::Devices>(), A, k_start, opts );
+            break;
+    }
+}
+
 } // namespace impl
 
 //------------------------------------------------------------------------------
@@ -354,6 +413,14 @@ void potrf(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::CheckpointInterval:
+///       Save a checkpoint every interval panels, to restart with
+///       potrf_restart() after a failure. The checkpoint is written
+///       asynchronously using MPI-IO, while the factorization continues;
+///       it needs host memory equal to the local part of $A$.
+///       interval >= 0. Default 0, no checkpoints.
+///     - Option::CheckpointFile:
+///       Prefix of the checkpoint file names. Default "slate_checkpoint".
 ///
 /// TODO: return value
 /// @retval 0 successful exit
@@ -368,31 +435,43 @@ void potrf(
     HermitianMatrix<scalar_t>& A,
     Options const& opts)
 {
-    using internal::TargetType;
-
-    Target target = get_option( opts, Option::Target, Target::HostTask );
-
-    switch (target) {
-        case Target::Host:
-        case Target::HostTask:
-            impl::potrf( TargetType<Target::HostTask>(), A, opts );
-            break;
-
-        case Target::HostNest:
-            impl::potrf( TargetType<Target::HostNest>(), A, opts );
-            break;
-
-        case Target::HostBatch:
-            impl::potrf( TargetType<Target::HostBatch>(), A, opts );
-            break;
-
-        case Target::Devices:
-            impl::potrf( TargetType<Target::Devices>(), A, opts );
-            break;
-    }
+    impl::potrf( A, 0, opts );
     // todo: return value for errors?
 }
 
+//------------------------------------------------------------------------------
+/// Restarts a Cholesky factorization from its last checkpoint,
+/// saved by potrf() with Option::CheckpointInterval.
+/// The factorization resumes from the last completed block column.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, an n-by-n Hermitian matrix with the same dimensions,
+///     tile size, and uplo as the matrix passed to potrf(); its
+///     distribution may differ. Its values are ignored.
+///     On exit, the factor $U$ or $L$ from the Cholesky
+///     factorization $A = U^H U$ or $A = L L^H$, as for potrf().
+///
+/// @param[in] opts
+///     Additional options, as for potrf().
+///     Option::CheckpointFile must match the one passed to potrf().
+///     If Option::CheckpointInterval is set, checkpoints continue to be saved.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrf_restart(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts)
+{
+    int64_t k_start = internal::Checkpoint<scalar_t>::restore(
+        "potrf", opts, A );
+    impl::potrf( A, k_start, opts );
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
@@ -415,4 +494,25 @@ void potrf< std::complex<double> >(
     HermitianMatrix< std::complex<double> >& A,
     Options const& opts);
 
+//------------------------------------------------------------------------------
+template
+void potrf_restart<float>(
+    HermitianMatrix<float>& A,
+    Options const& opts);
+
+template
+void potrf_restart<double>(
+    HermitianMatrix<double>& A,
+    Options const& opts);
+
+template
+void potrf_restart< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void potrf_restart< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Options const& opts);
+
 } // namespace slate
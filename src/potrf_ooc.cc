@@ -0,0 +1,145 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal_ooc.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel out-of-core Cholesky factorization, for matrices
+/// larger than the aggregate memory of the ranks.
+///
+/// Performs the Cholesky factorization of a Hermitian positive definite
+/// matrix $A = L L^H$, where the local tiles of $A$ are held in a per-rank
+/// file (see Option::OutOfCoreFile) rather than in memory.
+///
+/// This is a left-looking algorithm over super-panels of block columns,
+/// sized so a super-panel fits in Option::OutOfCoreMemory. For each
+/// super-panel, the previously factored block columns are streamed
+/// through memory, with the next one read while the current one updates
+/// the super-panel; then the super-panel is factored in memory with
+/// potrf and trsm, and written back while the next super-panel is read.
+/// The matrix is read about $nt / w$ times for super-panels of $w$ block
+/// columns, so larger memory reduces I/O.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian positive definite matrix $A$,
+///     which must be lower, not transposed. Its local tiles are in the
+///     tile file, e.g., written by ooc_store; no tiles need to be in memory.
+///     On exit, the tile file holds the factor $L$, and no tiles of $A$
+///     are in memory.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::OutOfCoreFile:
+///       Prefix of the tile file names, `<prefix>.<rank>`. Required.
+///     - Option::OutOfCoreMemory:
+///       Host memory per rank for tiles of A, in bytes. Default 0,
+///       giving super-panels of one block column.
+///     - Other options, e.g., Option::Target, are passed to potrf, herk,
+///       gemm, and trsm, which do the computation on each super-panel.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrf_ooc(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t r_one = 1.0;
+
+    // Options
+    int64_t budget = get_option<int64_t>( opts, Option::OutOfCoreMemory, 0 );
+
+    if (A.uplo() != Uplo::Lower)
+        slate_not_implemented( "out-of-core potrf requires a lower matrix" );
+
+    internal::TileFile<scalar_t> file( A, opts );
+
+    int64_t A_nt = A.nt();
+    int64_t k1;
+    for (int64_t k0 = 0; k0 < A_nt; k0 = k1) {
+        k1 = k0 + file.panel_width( k0, k0, budget );
+
+        // Read super-panel A(k0:nt-1, k0:k1-1).
+        file.read( k0, A_nt-1, k0, k1-1 ).get();
+
+        auto Akk = A.sub( k0, k1-1 );
+        Matrix<scalar_t> Abelow;
+        if (k1 < A_nt)
+            Abelow = A.sub( k1, A_nt-1, k0, k1-1 );
+
+        // Stream L(k0:nt-1, j) for j = 0, ..., k0-1, reading the next
+        // block column while updating with the current one.
+        std::future<void> next;
+        if (k0 > 0)
+            next = file.read( k0, A_nt-1, 0, 0 );
+        for (int64_t j = 0; j < k0; ++j) {
+            next.get();
+            if (j+1 < k0)
+                next = file.read( k0, A_nt-1, j+1, j+1 );
+
+            // A(k0:k1-1, k0:k1-1) -= L(k0:k1-1, j) L(k0:k1-1, j)^H
+            auto Lkj = A.sub( k0, k1-1, j, j );
+            herk( -r_one, Lkj, r_one, Akk, opts );
+
+            // A(k1:nt-1, k0:k1-1) -= L(k1:nt-1, j) L(k0:k1-1, j)^H
+            if (k1 < A_nt) {
+                auto Lij = A.sub( k1, A_nt-1, j, j );
+                auto LkjH = conj_transpose( Lkj );
+                gemm( -one, Lij, LkjH, one, Abelow, opts );
+            }
+
+            file.release( k0, A_nt-1, j, j );
+        }
+
+        // Factor the super-panel in memory.
+        potrf( Akk, opts );
+        if (k1 < A_nt) {
+            auto Tkk = TriangularMatrix<scalar_t>( Diag::NonUnit, Akk );
+            auto TkkH = conj_transpose( Tkk );
+            trsm( Side::Right, one, TkkH, Abelow, opts );
+        }
+
+        // Write back, overlapped with reading the next super-panel.
+        file.write( k0, A_nt-1, k0, k1-1 );
+    }
+    file.flush();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrf_ooc<float>(
+    HermitianMatrix<float>& A,
+    Options const& opts);
+
+template
+void potrf_ooc<double>(
+    HermitianMatrix<double>& A,
+    Options const& opts);
+
+template
+void potrf_ooc< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void potrf_ooc< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,431 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+// Each column r of a tile column of L is modified by one transformation,
+// packed as kb + 3 scalars:
+//     tau, phase, c, s, h[ 1 : kb-1 ].
+// Applied to a row [ l, v ] of [ L(:, r), V ], it is
+//  1. a Householder reflector on v, v = v (I - tau h h^H), with h[ 0 ] = 1,
+//     which reduces v on the diagonal row to [ gamma, 0, ..., 0 ];
+//  2. l = phase l, to make L(r, r) real positive;
+//  3. a rotation of [ l, v[ 0 ] ] that zeros gamma: for an update, the Givens
+//         [ l, v0 ] = [ c l + s v0, -s l + c v0 ],
+//     for a downdate, the hyperbolic rotation with rho = s = gamma / L(r, r),
+//     c = 1 / sqrt( 1 - rho^2 ), in the mixed form, which is stable:
+//         l = c (l - rho v0),  v0 = v0 / c - rho l.
+
+//------------------------------------------------------------------------------
+/// Applies the transformation rot to rows of [ l, V ].
+///
+/// @param[in] sign
+///     +1 for an update, -1 for a downdate.
+///
+/// @param[in] rot
+///     The packed transformation.
+///
+/// @param[in] kb
+///     Number of columns of V.
+///
+/// @param[in] m
+///     Number of rows.
+///
+/// @param[in,out] l
+///     Column of m elements of L.
+///
+/// @param[in,out] V
+///     The m-by-kb matrix V, with leading dimension ldv.
+///
+/// @ingroup posv_impl
+///
+template <typename scalar_t>
+void potrf_modify_apply(
+    int sign, scalar_t const* rot, int64_t kb, int64_t m,
+    scalar_t* l, scalar_t* V, int64_t ldv,
+    std::vector<scalar_t>& work )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    if (m == 0)
+        return;
+
+    scalar_t tau   = rot[ 0 ];
+    scalar_t phase = rot[ 1 ];
+    real_t c = std::real( rot[ 2 ] );
+    real_t s = std::real( rot[ 3 ] );
+
+    // V = V (I - tau h h^H)
+    if (tau != zero) {
+        work.resize( kb + m );
+        scalar_t* h = work.data();
+        scalar_t* w = h + kb;
+        h[ 0 ] = one;
+        std::copy( rot + 4, rot + 3 + kb, h + 1 );
+        blas::gemv( Layout::ColMajor, Op::NoTrans, m, kb,
+                    one, V, ldv, h, 1, zero, w, 1 );
+        blas::gerc( Layout::ColMajor, m, kb, -tau, w, 1, h, 1, V, ldv );
+    }
+
+    blas::scal( m, phase, l, 1 );
+
+    if (sign > 0) {
+        for (int64_t i = 0; i < m; ++i) {
+            scalar_t x = l[ i ];
+            scalar_t y = V[ i ];
+            l[ i ] =  c*x + s*y;
+            V[ i ] = -s*x + c*y;
+        }
+    }
+    else {
+        for (int64_t i = 0; i < m; ++i) {
+            l[ i ] = c*(l[ i ] - s*V[ i ]);
+            V[ i ] = V[ i ]/c - s*l[ i ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Modifies the Cholesky factor L(j, j) of a diagonal tile by the
+/// corresponding rows of V, generating the packed transformations
+/// for the tile column.
+///
+/// @return 0, or r+1 if L(r, r) of the modified factor is not positive.
+///
+/// @ingroup posv_impl
+///
+template <typename scalar_t>
+int64_t potrf_modify_diag(
+    int sign, Tile<scalar_t>& L, Tile<scalar_t>& V,
+    std::vector<scalar_t>& rots )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using blas::conj;
+
+    int64_t nb = L.nb();
+    int64_t kb = V.nb();
+    int64_t ldv = V.stride();
+    int64_t rot_size = kb + 3;
+
+    rots.assign( nb * rot_size, scalar_t( 0.0 ) );
+    std::vector<scalar_t> x( kb ), work;
+
+    for (int64_t r = 0; r < nb; ++r) {
+        scalar_t* rot = &rots[ r * rot_size ];
+
+        // Householder reflector to reduce conj( V(r, :) ).
+        for (int64_t q = 0; q < kb; ++q)
+            x[ q ] = conj( V.at( r, q ) );
+        scalar_t alpha = x[ 0 ];
+        lapack::larfg( kb, &alpha, &x[ 1 ], 1, &rot[ 0 ] );
+        std::copy( &x[ 1 ], &x[ 0 ] + kb, rot + 4 );
+        real_t gamma = std::real( alpha );
+
+        real_t a = std::abs( L.at( r, r ) );
+        if (a == 0)
+            return r+1;
+        rot[ 1 ] = conj( L.at( r, r ) ) / a;
+
+        real_t diag;
+        if (sign > 0) {
+            diag = std::hypot( a, gamma );
+            rot[ 2 ] = a / diag;
+            rot[ 3 ] = gamma / diag;
+        }
+        else {
+            real_t rho = gamma / a;
+            if (std::abs( rho ) >= 1)
+                return r+1;
+            real_t c = 1 / std::sqrt( (1 - rho) * (1 + rho) );
+            diag = a / c;
+            rot[ 2 ] = c;
+            rot[ 3 ] = rho;
+        }
+
+        // Row r becomes [ diag, 0 ]; apply to rows below within the tile.
+        L.at( r, r ) = diag;
+        for (int64_t q = 0; q < kb; ++q)
+            V.at( r, q ) = 0;
+        potrf_modify_apply( sign, rot, kb, nb-r-1,
+                            &L.at( r+1, r ), &V.at( r+1, 0 ), ldv, work );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Cholesky rank-k update or downdate,
+/// $L L^H \pm V V^H$.
+/// Generic implementation; computed on host.
+///
+/// @ingroup posv_impl
+///
+template <typename scalar_t>
+void potrf_modify(
+    int sign,
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    Options const& opts )
+{
+    const Layout layout = Layout::ColMajor;
+
+    if (A.uplo() == Uplo::Upper)
+        slate_not_implemented( "potrf_update / potrf_downdate with Uplo::Upper" );
+
+    int64_t A_nt = A.nt();
+    int64_t V_nt = V.nt();
+    slate_assert( V.mt() == A_nt );
+
+    int mpi_rank = A.mpiRank();
+    MPI_Comm comm = A.mpiComm();
+
+    // Each tile column of V is a rank-kb modification, applied in turn.
+    // For a downdate, each intermediate matrix is also positive definite.
+    for (int64_t c = 0; c < V_nt; ++c) {
+        auto Vc = V.sub( 0, A_nt-1, c, c );
+        int64_t kb = Vc.tileNb( 0 );
+        int64_t row = 0;  // first row of tile column j
+
+        for (int64_t j = 0; j < A_nt; ++j) {
+            int64_t nb = A.tileNb( j );
+            int root = A.tileRank( j, j );
+
+            // Diagonal tile: modify L(j, j) and generate transformations.
+            Vc.tileBcast( j, 0, A.sub( j, j, j, j ), layout );
+
+            int64_t info = 0;
+            std::vector<scalar_t> rots( nb * (kb + 3) );
+            if (mpi_rank == root) {
+                A.tileGetForWriting( j, j, LayoutConvert::ColMajor );
+                Vc.tileGetForWriting( j, 0, LayoutConvert::ColMajor );
+                auto Ljj = A( j, j );
+                auto Vj = Vc( j, 0 );
+                info = potrf_modify_diag( sign, Ljj, Vj, rots );
+                if (! Vc.tileIsLocal( j, 0 ))
+                    Vc.tileTick( j, 0 );
+            }
+            slate_mpi_call(
+                MPI_Bcast( &info, 1, MPI_INT64_T, root, comm ) );
+            if (info != 0) {
+                slate_error( "potrf_update / potrf_downdate: modified matrix"
+                             " is not positive definite at row "
+                             + std::to_string( row + info ) );
+            }
+            slate_mpi_call(
+                MPI_Bcast( rots.data(), int( rots.size() ),
+                           mpi_type<scalar_t>::value,
+                           root, comm ) );
+
+            row += nb;
+            if (j+1 >= A_nt)
+                continue;
+
+            // Tile column: apply transformations to [ L(i, j), V(i) ]
+            // on the owner of L(i, j).
+            typename Matrix<scalar_t>::BcastList bcast_list_V;
+            for (int64_t i = j+1; i < A_nt; ++i)
+                bcast_list_V.push_back( {i, 0, {A.sub( i, i, j, j )}} );
+            Vc.listBcast( bcast_list_V, layout );
+
+            #pragma omp parallel
+            #pragma omp master
+            {
+                for (int64_t i = j+1; i < A_nt; ++i) {
+                    if (A.tileIsLocal( i, j )) {
+                        #pragma omp task shared( A, Vc, rots ) \
+                            firstprivate( i, j, nb, kb, sign )
+                        {
+                            A.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                            Vc.tileGetForWriting( i, 0, LayoutConvert::ColMajor );
+                            auto Lij = A( i, j );
+                            auto Vi = Vc( i, 0 );
+                            std::vector<scalar_t> work;
+                            for (int64_t r = 0; r < nb; ++r) {
+                                potrf_modify_apply(
+                                    sign, &rots[ r * (kb + 3) ], kb, Lij.mb(),
+                                    &Lij.at( 0, r ), Vi.data(), Vi.stride(),
+                                    work );
+                            }
+                        }
+                    }
+                }
+                #pragma omp taskwait
+            }
+
+            // Return the modified V(i) to its owner, in order of i.
+            for (int64_t i = j+1; i < A_nt; ++i) {
+                int src = A.tileRank( i, j );
+                int dst = Vc.tileRank( i, 0 );
+                if (src != dst) {
+                    if (mpi_rank == src) {
+                        Vc.tileSend( i, 0, dst );
+                        Vc.tileTick( i, 0 );
+                    }
+                    else if (mpi_rank == dst) {
+                        Vc.tileRecv( i, 0, src, layout );
+                    }
+                }
+            }
+        }
+    }
+
+    A.tileUpdateAllOrigin();
+    V.tileUpdateAllOrigin();
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Cholesky rank-k update.
+///
+/// Given the Cholesky factor $L$ of a Hermitian positive definite matrix
+/// $A = L L^H$, as computed by potrf, computes the Cholesky factor $\tilde{L}$
+/// of the rank-k update
+/// \[
+///     \tilde{L} \tilde{L}^H = L L^H + V V^H
+/// \]
+/// in $O(n^2 k)$ operations, instead of $O(n^3)$ to refactor.
+///
+/// Each tile column of $L$ is modified in turn. The diagonal tile owner
+/// generates, for each column, a Householder reflector on the rows of $V$
+/// and a Givens rotation; these are broadcast, and the owners of the tiles
+/// below the diagonal apply them to their tiles of $L$ and the
+/// corresponding rows of $V$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the factor $L$ computed by potrf.
+///     On exit, the factor $\tilde{L}$, with positive real diagonal.
+///     Currently, only Uplo::Lower is supported.
+///
+/// @param[in,out] V
+///     On entry, the n-by-k matrix $V$, with the same row tiles and
+///     distribution as the rows of $A$. Each tile column of $V$ is applied
+///     in turn. On exit, $V$ is destroyed.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrf_update(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    Options const& opts)
+{
+    impl::potrf_modify( +1, A, V, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Cholesky rank-k downdate.
+///
+/// Given the Cholesky factor $L$ of a Hermitian positive definite matrix
+/// $A = L L^H$, as computed by potrf, computes the Cholesky factor $\tilde{L}$
+/// of the rank-k downdate
+/// \[
+///     \tilde{L} \tilde{L}^H = L L^H - V V^H
+/// \]
+/// in $O(n^2 k)$ operations, instead of $O(n^3)$ to refactor.
+/// This is as potrf_update, using hyperbolic rotations, in the mixed form
+/// that is numerically stable, in place of Givens rotations.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the factor $L$ computed by potrf.
+///     On exit, the factor $\tilde{L}$, with positive real diagonal.
+///     Currently, only Uplo::Lower is supported.
+///
+/// @param[in,out] V
+///     On entry, the n-by-k matrix $V$, with the same row tiles and
+///     distribution as the rows of $A$. Each tile column of $V$ is applied
+///     in turn. On exit, $V$ is destroyed.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// Throws an exception if $L L^H - V V^H$ is not positive definite;
+/// then $A$ is partially modified.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrf_downdate(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    Options const& opts)
+{
+    impl::potrf_modify( -1, A, V, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrf_update<float>(
+    HermitianMatrix<float>& A,
+    Matrix<float>& V,
+    Options const& opts);
+
+template
+void potrf_update<double>(
+    HermitianMatrix<double>& A,
+    Matrix<double>& V,
+    Options const& opts);
+
+template
+void potrf_update< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& V,
+    Options const& opts);
+
+template
+void potrf_update< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& V,
+    Options const& opts);
+
+//------------------------------------------------------------------------------
+template
+void potrf_downdate<float>(
+    HermitianMatrix<float>& A,
+    Matrix<float>& V,
+    Options const& opts);
+
+template
+void potrf_downdate<double>(
+    HermitianMatrix<double>& A,
+    Matrix<double>& V,
+    Options const& opts);
+
+template
+void potrf_downdate< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& V,
+    Options const& opts);
+
+template
+void potrf_downdate< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& V,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,136 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal_ooc.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel out-of-core Cholesky solve.
+///
+/// Solves a system of linear equations
+/// \[
+///     A X = B
+/// \]
+/// using the Cholesky factor $L$ computed by potrf_ooc, held in the
+/// per-rank tile file. Each block column of $L$ is read once for the
+/// forward substitution and once for the backward substitution, with the
+/// next block column read while the current one is applied. $B$ is in
+/// memory.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-n lower triangular factor $L$ computed by potrf_ooc,
+///     in the tile file. No tiles of $A$ are in memory on exit.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$.
+///     On exit, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::OutOfCoreFile:
+///       Prefix of the tile file names, `<prefix>.<rank>`. Required.
+///     - Other options, e.g., Option::Target, are passed to trsm and gemm.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrs_ooc(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    // Constants
+    const scalar_t one = 1.0;
+
+    if (A.uplo() != Uplo::Lower)
+        slate_not_implemented( "out-of-core potrs requires a lower matrix" );
+    assert(B.mt() == A.mt());
+
+    internal::TileFile<scalar_t> file( A, opts );
+
+    int64_t A_nt = A.nt();
+    int64_t B_nt = B.nt();
+
+    // Forward substitution, Y = L^{-1} B, with L(j:nt-1, j) for j = 0, ...
+    std::future<void> next = file.read( 0, A_nt-1, 0, 0 );
+    for (int64_t j = 0; j < A_nt; ++j) {
+        next.get();
+        if (j+1 < A_nt)
+            next = file.read( j+1, A_nt-1, j+1, j+1 );
+
+        auto Ajj = A.sub( j, j );
+        auto Tjj = TriangularMatrix<scalar_t>( Diag::NonUnit, Ajj );
+        auto Bj = B.sub( j, j, 0, B_nt-1 );
+        trsm( Side::Left, one, Tjj, Bj, opts );
+
+        if (j+1 < A_nt) {
+            auto Lij = A.sub( j+1, A_nt-1, j, j );
+            auto Bi = B.sub( j+1, A_nt-1, 0, B_nt-1 );
+            gemm( -one, Lij, Bj, one, Bi, opts );
+        }
+
+        // Keep the last block column for the backward substitution.
+        if (j+1 < A_nt)
+            file.release( j, A_nt-1, j, j );
+    }
+
+    // Backward substitution, X = L^{-H} Y, with L(j:nt-1, j) for j = nt-1, ...
+    for (int64_t j = A_nt-1; j >= 0; --j) {
+        if (j < A_nt-1)
+            next.get();
+        if (j > 0)
+            next = file.read( j-1, A_nt-1, j-1, j-1 );
+
+        auto Bj = B.sub( j, j, 0, B_nt-1 );
+        if (j+1 < A_nt) {
+            auto LijH = conj_transpose( A.sub( j+1, A_nt-1, j, j ) );
+            auto Bi = B.sub( j+1, A_nt-1, 0, B_nt-1 );
+            gemm( -one, LijH, Bi, one, Bj, opts );
+        }
+
+        auto Ajj = A.sub( j, j );
+        auto Tjj = TriangularMatrix<scalar_t>( Diag::NonUnit, Ajj );
+        auto TjjH = conj_transpose( Tjj );
+        trsm( Side::Left, one, TjjH, Bj, opts );
+
+        file.release( j, A_nt-1, j, j );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrs_ooc<float>(
+    HermitianMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+void potrs_ooc<double>(
+    HermitianMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+void potrs_ooc< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+void potrs_ooc< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,197 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal_alltoall.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Calls func( ia, ja, ib, jb, ii, jj, mb, nb ) for each pair of a tile
+/// A( ia, ja ) and a tile B( ib, jb ) that overlap, where the overlap is
+/// rows [ ii, ii + mb ) and cols [ jj, jj + nb ) of the global matrix.
+/// The pairs are visited in the same order on every rank, so the packed
+/// data between any two ranks can be exchanged without indices.
+/// The cost is proportional to the number of overlapping tile pairs,
+/// not to the matrix size.
+///
+template <typename scalar_t, typename func_t>
+void for_each_overlap(
+    Matrix<scalar_t>& A, Matrix<scalar_t>& B, func_t func )
+{
+    for (int64_t ja = 0; ja < A.nt(); ++ja) {
+        int64_t a_col0 = A.tileColOffset( ja );
+        int64_t a_col1 = a_col0 + A.tileNb( ja );
+        for (int64_t jb = B.tileColIndex( a_col0 );
+             jb < B.nt() && B.tileColOffset( jb ) < a_col1; ++jb)
+        {
+            int64_t b_col0 = B.tileColOffset( jb );
+            int64_t jj = std::max( a_col0, b_col0 );
+            int64_t nb = std::min( a_col1, b_col0 + B.tileNb( jb ) ) - jj;
+            for (int64_t ia = 0; ia < A.mt(); ++ia) {
+                int64_t a_row0 = A.tileRowOffset( ia );
+                int64_t a_row1 = a_row0 + A.tileMb( ia );
+                for (int64_t ib = B.tileRowIndex( a_row0 );
+                     ib < B.mt() && B.tileRowOffset( ib ) < a_row1; ++ib)
+                {
+                    int64_t b_row0 = B.tileRowOffset( ib );
+                    int64_t ii = std::max( a_row0, b_row0 );
+                    int64_t mb = std::min( a_row1, b_row0 + B.tileMb( ib ) ) - ii;
+                    func( ia, ja, ib, jb, ii, jj, mb, nb );
+                }
+            }
+        }
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Redistributes A into B, where A and B may have different tile sizes and
+/// different distributions, e.g., from a 2D block cyclic distribution with
+/// large tiles to a 1D column distribution with small tiles.
+/// This is a general redistribution, similar to ScaLAPACK's pxgemr2d.
+///
+/// Each rank computes the overlaps of A's and B's tiles from the tile
+/// sizes and distribution functions, so no metadata is exchanged.
+/// The overlaps are packed column-major by destination rank and exchanged
+/// with a single all-to-all, then unpacked directly into B's tiles.
+/// Memory overhead is one send and one receive buffer, each the size of
+/// the local part of the matrix.
+///
+/// Unlike Matrix::redistribute, which copies tile by tile and requires the
+/// same tiling, this can change the tile size between phases of an
+/// application, e.g., large tiles for gemm and small tiles for eigensolvers.
+/// Collective over the MPI communicator of A and B.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The m-by-n matrix A. Transposed matrices are not supported.
+///
+/// @param[in,out] B
+///     On entry, the m-by-n matrix B, with local tiles allocated.
+///     B must be distributed over the same ranks of the same communicator
+///     as A, but may have any tile sizes and tile to rank mapping.
+///     On exit, B = A.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup copy
+///
+template <typename scalar_t>
+void redistribute(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    if (A.op() != Op::NoTrans || B.op() != Op::NoTrans)
+        slate_not_implemented( "redistributing transposed matrices" );
+    slate_assert( A.m() == B.m() );
+    slate_assert( A.n() == B.n() );
+
+    MPI_Comm comm = A.mpiComm();
+    int mpi_size, mpi_rank = A.mpiRank();
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ));
+    int b_size;
+    slate_mpi_call(
+        MPI_Comm_size( B.mpiComm(), &b_size ));
+    slate_assert( b_size == mpi_size && B.mpiRank() == mpi_rank );
+
+    A.tileGetAllForReading( HostNum, LayoutConvert::ColMajor );
+    B.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+
+    // Count and pack overlaps of local A tiles, by destination rank.
+    std::vector<int64_t> send_offsets( mpi_size + 1, 0 );
+    impl::for_each_overlap( A, B,
+        [&]( int64_t ia, int64_t ja, int64_t ib, int64_t jb,
+             int64_t ii, int64_t jj, int64_t mb, int64_t nb ) {
+            if (A.tileIsLocal( ia, ja ))
+                send_offsets[ B.tileRank( ib, jb ) + 1 ] += mb*nb;
+        });
+    for (int r = 0; r < mpi_size; ++r)
+        send_offsets[ r+1 ] += send_offsets[ r ];
+
+    std::vector<scalar_t> send( send_offsets[ mpi_size ] );
+    std::vector<int64_t> next( send_offsets.begin(), send_offsets.end() - 1 );
+    impl::for_each_overlap( A, B,
+        [&]( int64_t ia, int64_t ja, int64_t ib, int64_t jb,
+             int64_t ii, int64_t jj, int64_t mb, int64_t nb ) {
+            if (! A.tileIsLocal( ia, ja ))
+                return;
+            int64_t& pos = next[ B.tileRank( ib, jb ) ];
+            auto T = A( ia, ja );
+            int64_t row = ii - A.tileRowOffset( ia );
+            int64_t col = jj - A.tileColOffset( ja );
+            for (int64_t c = 0; c < nb; ++c) {
+                scalar_t const* src = &T.at( row, col + c );
+                std::copy( src, src + mb, &send[ pos ] );
+                pos += mb;
+            }
+        });
+
+    std::vector<scalar_t> recv;
+    std::vector<int64_t> recv_offsets;
+    internal::alltoallv( send, send_offsets, recv, recv_offsets, comm );
+    send.clear();
+    send.shrink_to_fit();
+
+    // Unpack into local B tiles, in the same order, from each source rank.
+    next.assign( recv_offsets.begin(), recv_offsets.end() - 1 );
+    impl::for_each_overlap( A, B,
+        [&]( int64_t ia, int64_t ja, int64_t ib, int64_t jb,
+             int64_t ii, int64_t jj, int64_t mb, int64_t nb ) {
+            if (! B.tileIsLocal( ib, jb ))
+                return;
+            int64_t& pos = next[ A.tileRank( ia, ja ) ];
+            auto T = B( ib, jb );
+            int64_t row = ii - B.tileRowOffset( ib );
+            int64_t col = jj - B.tileColOffset( jb );
+            for (int64_t c = 0; c < nb; ++c) {
+                std::copy( &recv[ pos ], &recv[ pos ] + mb,
+                           &T.at( row, col + c ) );
+                pos += mb;
+            }
+        });
+
+    B.tileUpdateAllOrigin();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void redistribute<float>(
+    Matrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+void redistribute<double>(
+    Matrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+void redistribute< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+void redistribute< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
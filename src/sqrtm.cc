@@ -0,0 +1,246 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "internal/internal.hh"
+
+#include <cmath>
+#include <limits>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Coupled Newton-Schulz iteration for the square root and inverse square
+/// root of a Hermitian positive definite matrix. With $c = \|A\|_F$,
+/// $Y_0 = A / c$, and $Z_0 = I$, iterates
+/// \[
+///     T_k = \frac{1}{2} (3 I - Z_k Y_k),
+///     \quad
+///     Y_{k+1} = Y_k T_k,
+///     \quad
+///     Z_{k+1} = T_k Z_k,
+/// \]
+/// so $Y_k \to (A/c)^{1/2}$ and $Z_k \to (A/c)^{-1/2}$.
+/// Since $c \ge \|A\|_2$, the eigenvalues of $A/c$ are in (0, 1], where the
+/// iteration converges. Each iteration is 3 gemm.
+///
+/// @param[out] Y
+///     On exit, $A^{1/2}$, if Y is not empty.
+///
+/// @param[out] Z
+///     On exit, $A^{-1/2}$, if Z is not empty.
+///
+/// @ingroup matfun_impl
+///
+template <typename scalar_t>
+void sqrtm_newton_schulz(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& Y_out,
+    Matrix<scalar_t>& Z_out,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const scalar_t half = 0.5;
+    const int itermax = 100;
+
+    real_t tol = get_option<double>(
+        opts, Option::Tolerance,
+        std::sqrt( std::numeric_limits<real_t>::epsilon() ) );
+
+    // Workspace of the same shape and distribution as the output.
+    Matrix<scalar_t>& X = Y_out.mt() > 0 ? Y_out : Z_out;
+    auto Y = X.emptyLike();
+    auto Z = X.emptyLike();
+    auto T = X.emptyLike();
+    auto W = X.emptyLike();
+    Y.insertLocalTiles();
+    Z.insertLocalTiles();
+    T.insertLocalTiles();
+    W.insertLocalTiles();
+
+    // Y = A / c, expanding Hermitian storage to a general matrix
+    // by multiplying by I.
+    real_t c = norm( Norm::Fro, A, opts );
+    set( zero, one, Z, opts );
+    hemm( Side::Left, scalar_t( 1 / c ), A, Z, zero, Y, opts );
+
+    bool converged = false;
+    for (int iter = 0; iter < itermax; ++iter) {
+        // T = (3 I - Z Y) / 2.
+        set( zero, scalar_t( 1.5 ), T, opts );
+        gemm( -half, Z, Y, one, T, opts );
+
+        // Y = Y T, with the change Y_old - Y_new in Y_old to test convergence.
+        gemm( one, Y, T, zero, W, opts );
+        add( -one, W, one, Y, opts );
+        real_t delta = norm( Norm::Fro, Y, opts ) / norm( Norm::Fro, W, opts );
+        std::swap( Y, W );
+
+        // Z = T Z.
+        gemm( one, T, Z, zero, W, opts );
+        std::swap( Z, W );
+
+        // Convergence is quadratic, so do one more iteration after
+        // the change is below tol.
+        if (converged)
+            break;
+        converged = delta <= tol;
+    }
+    if (! converged)
+        slate_error( "sqrtm did not converge; A must be positive definite" );
+
+    real_t sqrt_c = std::sqrt( c );
+    if (Y_out.mt() > 0) {
+        slate::copy( Y, Y_out, opts );
+        scale( sqrt_c, real_t( 1.0 ), Y_out, opts );
+    }
+    if (Z_out.mt() > 0) {
+        slate::copy( Z, Z_out, opts );
+        scale( real_t( 1.0 ), sqrt_c, Z_out, opts );
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel square root of a Hermitian positive definite matrix.
+///
+/// Computes $X = A^{1/2}$, the Hermitian positive definite square root,
+/// by the coupled Newton-Schulz iteration, which uses only gemm.
+/// The number of iterations grows with log of the condition number of $A$;
+/// for very ill-conditioned $A$, use hefunm with std::sqrt instead.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-n Hermitian positive definite matrix $A$.
+///
+/// @param[out] X
+///     The n-by-n matrix $X = A^{1/2}$.
+///     Must have the same distribution as $A$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Tolerance:
+///       Iteration stops after the relative change in $X$ is below tol,
+///       plus one more iteration. Default sqrt(epsilon).
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @throws slate::Exception if the iteration does not converge.
+///
+/// @ingroup matfun
+///
+template <typename scalar_t>
+void sqrtm(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& X,
+    Options const& opts)
+{
+    Matrix<scalar_t> Z;
+    impl::sqrtm_newton_schulz( A, X, Z, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel inverse square root of a Hermitian positive definite
+/// matrix.
+///
+/// Computes $X = A^{-1/2}$ by the coupled Newton-Schulz iteration,
+/// which uses only gemm. See sqrtm.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-n Hermitian positive definite matrix $A$.
+///
+/// @param[out] X
+///     The n-by-n matrix $X = A^{-1/2}$.
+///     Must have the same distribution as $A$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. See sqrtm.
+///
+/// @throws slate::Exception if the iteration does not converge.
+///
+/// @ingroup matfun
+///
+template <typename scalar_t>
+void invsqrtm(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& X,
+    Options const& opts)
+{
+    Matrix<scalar_t> Y;
+    impl::sqrtm_newton_schulz( A, Y, X, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void sqrtm<float>(
+    HermitianMatrix<float>& A,
+    Matrix<float>& X,
+    Options const& opts);
+
+template
+void sqrtm<double>(
+    HermitianMatrix<double>& A,
+    Matrix<double>& X,
+    Options const& opts);
+
+template
+void sqrtm< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& X,
+    Options const& opts);
+
+template
+void sqrtm< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& X,
+    Options const& opts);
+
+//--------------------
+template
+void invsqrtm<float>(
+    HermitianMatrix<float>& A,
+    Matrix<float>& X,
+    Options const& opts);
+
+template
+void invsqrtm<double>(
+    HermitianMatrix<double>& A,
+    Matrix<double>& X,
+    Options const& opts);
+
+template
+void invsqrtm< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& X,
+    Options const& opts);
+
+template
+void invsqrtm< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& X,
+    Options const& opts);
+
+} // namespace slate
@@ -10,40 +10,53 @@
 
 #include <cassert>
 #include <complex>
+#include <cstdint>
+#include <cstring>
 
 int* MPI_STATUS_IGNORE;
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-int MPI_Type_contiguous(int count, MPI_Datatype oldtype, MPI_Datatype* newtype)
-{
-    assert(0);
-}
-
-int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count,
-                  MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+//------------------------------------------------------------------------------
+// With one process, a reduction copies sendbuf to recvbuf, for any op.
+static void reduce_copy(const void* sendbuf, void* recvbuf, int count,
+                        MPI_Datatype datatype)
 {
-    assert(count == 1);
-    assert(op == MPI_MAX);
-
+    size_t size = 0;
     switch (datatype) {
+        case MPI_INT64_T:
+            size = sizeof(int64_t);
+            break;
         case MPI_FLOAT:
-            *(float*)recvbuf = *(float*)sendbuf;
+            size = sizeof(float);
             break;
         case MPI_DOUBLE:
-            *(double*)recvbuf = *(double*)sendbuf;
+            size = sizeof(double);
             break;
         case MPI_C_COMPLEX:
-            *(std::complex<float>*)recvbuf = *(std::complex<float>*)sendbuf;
+            size = sizeof(std::complex<float>);
             break;
         case MPI_C_DOUBLE_COMPLEX:
-            *(std::complex<double>*)recvbuf = *(std::complex<double>*)sendbuf;
+            size = sizeof(std::complex<double>);
             break;
         default:
             assert(0);
     }
+    std::memcpy(recvbuf, sendbuf, count * size);
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int MPI_Type_contiguous(int count, MPI_Datatype oldtype, MPI_Datatype* newtype)
+{
+    assert(0);
+}
+
+int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count,
+                  MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+{
+    assert(op == MPI_MAX || op == MPI_MIN || op == MPI_SUM);
+    reduce_copy(sendbuf, recvbuf, count, datatype);
     return MPI_SUCCESS;
 }
 
@@ -86,6 +99,12 @@ int MPI_Comm_size(MPI_Comm comm, int* size)
     return MPI_SUCCESS;
 }
 
+int MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm* newcomm)
+{
+    *newcomm = comm;
+    return MPI_SUCCESS;
+}
+
 MPI_Fint MPI_Comm_f2c(MPI_Comm comm)
 {
     assert(0);
@@ -157,25 +176,8 @@ int MPI_Op_free(MPI_Op* op)
 int MPI_Reduce(void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype,
                MPI_Op op, int root, MPI_Comm comm)
 {
-    assert(count == 1);
-    assert(op == MPI_MAX);
-
-    switch (datatype) {
-        case MPI_FLOAT:
-            *(float*)recvbuf = *(float*)sendbuf;
-            break;
-        case MPI_DOUBLE:
-            *(double*)recvbuf = *(double*)sendbuf;
-            break;
-        case MPI_C_COMPLEX:
-            *(std::complex<float>*)recvbuf = *(std::complex<float>*)sendbuf;
-            break;
-        case MPI_C_DOUBLE_COMPLEX:
-            *(std::complex<double>*)recvbuf = *(std::complex<double>*)sendbuf;
-            break;
-        default:
-            assert(0);
-    }
+    assert(op == MPI_MAX || op == MPI_SUM);
+    reduce_copy(sendbuf, recvbuf, count, datatype);
     return MPI_SUCCESS;
 }
 
@@ -224,6 +226,18 @@ int MPI_Waitall(int count, MPI_Request requests[], MPI_Status statuses[])
     assert(0);
 }
 
+int MPI_Waitany(int count, MPI_Request requests[], int* index,
+                MPI_Status* status)
+{
+    assert(0);
+}
+
+int MPI_Testany(int count, MPI_Request requests[], int* index, int* flag,
+                MPI_Status* status)
+{
+    assert(0);
+}
+
 int MPI_Error_string(int errorcode, char* string, int* resultlen)
 {
     assert(0);
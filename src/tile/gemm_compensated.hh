@@ -0,0 +1,138 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_TILE_GEMM_COMPENSATED_HH
+#define SLATE_TILE_GEMM_COMPENSATED_HH
+
+#include "slate/Tile.hh"
+
+#include <cmath>
+#include <complex>
+
+namespace slate {
+
+namespace tile {
+
+//------------------------------------------------------------------------------
+/// Adds the product $a b$ to the unevaluated sum $hi + lo$, using an exact
+/// product (TwoProduct, via fma) and an exact sum (TwoSum), so the sum is
+/// accumulated as in twice the working precision (Ogita, Rump, Oishi, Dot2).
+/// @ingroup gemm_tile
+///
+template <typename real_t>
+inline void add_product_compensated(
+    real_t a, real_t b, real_t& hi, real_t& lo)
+{
+    real_t p = a * b;
+    real_t e = std::fma( a, b, -p );
+    real_t s = hi + p;
+    real_t z = s - hi;
+    real_t t = (hi - (s - z)) + (p - z);
+    hi = s;
+    lo += t + e;
+}
+
+//------------------------------------------------------------------------------
+/// Complex version, applied to the real and imaginary parts.
+/// @ingroup gemm_tile
+///
+template <typename real_t>
+inline void add_product_compensated(
+    std::complex<real_t> a, std::complex<real_t> b,
+    std::complex<real_t>& hi, std::complex<real_t>& lo)
+{
+    real_t hi_re = real( hi ), hi_im = imag( hi );
+    real_t lo_re = real( lo ), lo_im = imag( lo );
+    add_product_compensated(  real( a ), real( b ), hi_re, lo_re );
+    add_product_compensated( -imag( a ), imag( b ), hi_re, lo_re );
+    add_product_compensated(  real( a ), imag( b ), hi_im, lo_im );
+    add_product_compensated(  imag( a ), real( b ), hi_im, lo_im );
+    hi = std::complex<real_t>( hi_re, hi_im );
+    lo = std::complex<real_t>( lo_re, lo_im );
+}
+
+//------------------------------------------------------------------------------
+/// General matrix multiply with compensated accumulation:
+///     $C + C_{lo} = \alpha op(A) op(B) + C + C_{lo}$,
+///     $C_{abs} = |\alpha| |op(A)| |op(B)| + C_{abs}$,
+/// where $C + C_{lo}$ is an unevaluated sum holding the result to about
+/// twice the working precision. $\alpha$ is applied to $A$ in working
+/// precision, so it should be exact, e.g., $\pm 1$.
+/// $C_{abs}$ holds real values, used for componentwise error bounds.
+///
+/// $A$ may be a diagonal tile of a Hermitian matrix (uplo Lower or Upper),
+/// in which case only its triangle is read.
+/// $C$, $C_{lo}$, and $C_{abs}$ must be column-major and not transposed.
+/// @ingroup gemm_tile
+///
+template <typename scalar_t>
+void gemm_compensated(
+    scalar_t alpha, Tile<scalar_t> const& A,
+                    Tile<scalar_t> const& B,
+                    Tile<scalar_t>& C,
+                    Tile<scalar_t>& C_lo,
+                    Tile<scalar_t>& C_abs)
+{
+    using blas::conj;
+    using blas::real;
+
+    assert( B.uplo() == Uplo::General );
+    assert( C.op() == Op::NoTrans && C.layout() == Layout::ColMajor );
+    assert( C_lo.op() == Op::NoTrans && C_lo.layout() == Layout::ColMajor );
+    assert( C_abs.op() == Op::NoTrans && C_abs.layout() == Layout::ColMajor );
+    assert( C.mb() == A.mb() && C.nb() == B.nb() && A.nb() == B.mb() );
+
+    Uplo uplo = A.uplo();
+    auto get_A = [&]( int64_t i, int64_t k ) -> scalar_t {
+        if (uplo == Uplo::General)
+            return A( i, k );
+        else if (i == k)
+            return real( A( i, i ) );
+        else if ((uplo == Uplo::Lower) == (i > k))
+            return A( i, k );
+        else
+            return conj( A( k, i ) );
+    };
+
+    scalar_t* c     = C.data();
+    scalar_t* c_lo  = C_lo.data();
+    scalar_t* c_abs = C_abs.data();
+    int64_t ldc     = C.stride();
+    int64_t ldc_lo  = C_lo.stride();
+    int64_t ldc_abs = C_abs.stride();
+
+    for (int64_t j = 0; j < C.nb(); ++j) {
+        for (int64_t k = 0; k < A.nb(); ++k) {
+            scalar_t b = B( k, j );
+            for (int64_t i = 0; i < C.mb(); ++i) {
+                scalar_t a = alpha * get_A( i, k );
+                add_product_compensated(
+                    a, b, c[ i + j*ldc ], c_lo[ i + j*ldc_lo ] );
+                c_abs[ i + j*ldc_abs ] += std::abs( a ) * std::abs( b );
+            }
+        }
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup gemm_tile
+///
+template <typename scalar_t>
+void gemm_compensated(
+    scalar_t alpha, Tile<scalar_t> const&& A,
+                    Tile<scalar_t> const&& B,
+                    Tile<scalar_t>&& C,
+                    Tile<scalar_t>&& C_lo,
+                    Tile<scalar_t>&& C_abs)
+{
+    gemm_compensated( alpha, A, B, C, C_lo, C_abs );
+}
+
+} // namespace tile
+
+} // namespace slate
+
+#endif // SLATE_TILE_GEMM_COMPENSATED_HH
@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_schur.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Recursive eigenvectors of the upper quasi-triangular T.
+/// With T = [ T11 T12; 0 T22 ] split near the middle, and X11, X22 the
+/// eigenvectors of T11, T22, the eigenvectors of T are
+/// X = [ X11 W X22; 0 X22 ], where W solves T11 W - W T22 = -T12.
+/// Blocks that fit in one tile are gathered and solved by LAPACK trevc
+/// on the owner of their first tile of X.
+///
+/// @param[in] offset
+///     Global offset of T, to index cross.
+///
+/// @ingroup geev_impl
+///
+template <typename scalar_t>
+void trevc(
+    Matrix<scalar_t> T, Matrix<scalar_t> X, Matrix<scalar_t> W,
+    int64_t offset, std::vector<char> const& cross,
+    int64_t nb, Options const& opts)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t m = T.m();
+    if (m == 0)
+        return;
+
+    // A 2-by-2 block split by a tile boundary can give a block of size
+    // nb+1, so allow at least 2 in the base case.
+    if (m <= std::max( nb, int64_t( 2 ) )) {
+        int root = X.tileRank( 0, 0 );
+        std::vector<scalar_t> T_data, X_data;
+        if (X.mpiRank() == root) {
+            T_data.resize( m*m );
+            X_data.resize( m*m );
+        }
+        internal::copy_block( T, T_data.data(), m, root, false );
+        if (X.mpiRank() == root) {
+            int64_t m_out;
+            lapack::trevc( lapack::Sides::Right, lapack::HowMany::All,
+                           nullptr, m, T_data.data(), m, nullptr, 1,
+                           X_data.data(), m, m, &m_out );
+        }
+        internal::copy_block( X, X_data.data(), m, root, true );
+        return;
+    }
+
+    int64_t k = internal::schur_split( m, offset, nb, cross );
+    auto T11 = T.slice( 0, k-1, 0, k-1 );
+    auto T12 = T.slice( 0, k-1, k, m-1 );
+    auto T22 = T.slice( k, m-1, k, m-1 );
+    auto X11 = X.slice( 0, k-1, 0, k-1 );
+    auto X12 = X.slice( 0, k-1, k, m-1 );
+    auto X21 = X.slice( k, m-1, 0, k-1 );
+    auto X22 = X.slice( k, m-1, k, m-1 );
+    auto W11 = W.slice( 0, k-1, 0, k-1 );
+    auto W12 = W.slice( 0, k-1, k, m-1 );
+    auto W22 = W.slice( k, m-1, k, m-1 );
+
+    trevc( T11, X11, W11, offset,   cross, nb, opts );
+    trevc( T22, X22, W22, offset+k, cross, nb, opts );
+
+    W12.insertLocalTiles();
+    slate::copy( T12, W12, opts );
+    slate::scale( -1.0, W12, opts );
+    internal::trsyl_rec( -1, T11, T22, W12, offset, offset+k,
+                         cross, cross, nb, opts );
+    slate::gemm( one, W12, X22, zero, X12, opts );
+    slate::set( zero, X21, opts );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel right eigenvectors of an upper quasi-triangular
+/// matrix, such as the Schur form from hseqr.
+///
+/// Computes the n-by-n upper triangular matrix $X$ of right eigenvectors
+/// of $T$, $T X = X \Lambda$. Uses recursive blocking: the eigenvectors
+/// of the two diagonal blocks of $T$ are computed recursively and coupled
+/// by a triangular Sylvester solve (see trsyl) and gemm, so most of the
+/// work is Level 3. Back-transform by the Schur vectors $Z$ with gemm
+/// to get eigenvectors of $A = Z T Z^H$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] T
+///     The n-by-n upper quasi-triangular matrix $T$. For complex types,
+///     $T$ is upper triangular; for real types, it may have 2-by-2
+///     diagonal blocks for complex conjugate pairs.
+///
+/// @param[out] X
+///     The n-by-n matrix $X$, with the same tile size as $T$.
+///     On exit, the eigenvectors, stored in the same order as the diagonal
+///     blocks of $T$; they are not normalized.
+///     For real types, for a 2-by-2 diagonal block in rows j, j+1,
+///     columns j and j+1 hold the real and imaginary parts of the
+///     eigenvector for the eigenvalue with positive imaginary part.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void trevc(
+    Matrix<scalar_t>& T,
+    Matrix<scalar_t>& X,
+    Options const& opts)
+{
+    slate_assert( T.op() == Op::NoTrans );
+    slate_assert( X.op() == Op::NoTrans );
+    slate_assert( T.m() == T.n() );
+    slate_assert( X.m() == T.m() );
+    slate_assert( X.n() == T.n() );
+
+    std::vector<char> cross = internal::schur_subdiag( T );
+    auto W = X.emptyLike();
+
+    impl::trevc( T, X, W, 0, cross, T.tileNb( 0 ), opts );
+
+    X.tileUpdateAllOrigin();
+    X.releaseWorkspace();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void trevc<float>(
+    Matrix<float>& T,
+    Matrix<float>& X,
+    Options const& opts);
+
+template
+void trevc<double>(
+    Matrix<double>& T,
+    Matrix<double>& X,
+    Options const& opts);
+
+template
+void trevc< std::complex<float> >(
+    Matrix< std::complex<float> >& T,
+    Matrix< std::complex<float> >& X,
+    Options const& opts);
+
+template
+void trevc< std::complex<double> >(
+    Matrix< std::complex<double> >& T,
+    Matrix< std::complex<double> >& X,
+    Options const& opts);
+
+} // namespace slate
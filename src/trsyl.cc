@@ -0,0 +1,123 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal_schur.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel triangular Sylvester equation solve.
+///
+/// Solves
+/// \[
+///     op(A) X + sign X op(B) = C,
+/// \]
+/// where $A$ and $B$ are in Schur form, as returned by gees: upper
+/// triangular, or for real types, upper quasi-triangular with 2-by-2
+/// diagonal blocks. op(A) and op(B) may be transposed or
+/// conjugate-transposed views, e.g., `conj_transpose( A )`.
+///
+/// This is the recursive blocked algorithm (as in RECSY): the larger of
+/// op(A) and op(B) is split in half, not splitting 2-by-2 blocks; one half
+/// of $X$ is solved recursively; the coupling block is eliminated by gemm;
+/// then the other half is solved. Most flops are in gemm. Blocks of one
+/// tile are solved by LAPACK trsyl on a single rank.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] sign
+///     +1 or -1, the sign in the equation.
+///
+/// @param[in] A
+///     The m-by-m matrix op(A), with $A$ in Schur form.
+///
+/// @param[in] B
+///     The n-by-n matrix op(B), with $B$ in Schur form.
+///
+/// @param[in,out] C
+///     On entry, the m-by-n matrix $C$.
+///     On exit, overwritten by the solution $X$.
+///     $A$, $B$, and $C$ must have the same square tile size.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target, used by gemm. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// If op(A) and -sign op(B) have close eigenvalues, the solution is
+/// ill-conditioned; as in LAPACK, perturbed values are used.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void trsyl(
+    int sign,
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    slate_assert( sign == 1 || sign == -1 );
+    slate_assert( C.op() == Op::NoTrans );
+    slate_assert( A.m() == A.n() && A.m() == C.m() );
+    slate_assert( B.m() == B.n() && B.n() == C.n() );
+
+    int64_t nb = C.tileNb( 0 );
+    slate_assert( C.tileMb( 0 ) == nb );
+    slate_assert( A.tileMb( 0 ) == nb && A.tileNb( 0 ) == nb );
+    slate_assert( B.tileMb( 0 ) == nb && B.tileNb( 0 ) == nb );
+
+    std::vector<char> cross_A = internal::schur_subdiag( A );
+    std::vector<char> cross_B = internal::schur_subdiag( B );
+
+    internal::trsyl_rec( sign, A, B, C, 0, 0, cross_A, cross_B, nb, opts );
+
+    C.releaseWorkspace();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void trsyl<float>(
+    int sign,
+    Matrix<float>& A,
+    Matrix<float>& B,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void trsyl<double>(
+    int sign,
+    Matrix<double>& A,
+    Matrix<double>& B,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void trsyl< std::complex<float> >(
+    int sign,
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void trsyl< std::complex<double> >(
+    int sign,
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,311 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+
+#include <utility>
+#include <vector>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Distributed parallel triangular-triangular matrix multiplication.
+/// Generic implementation for any target.
+/// Follows gemmC, but at step k broadcasts and multiplies only the non-zero
+/// part of block column A(:, k) and block row B(k, :).
+/// Dependencies enforce the following behavior:
+/// - bcast communications are serialized,
+/// - multiply operations are serialized,
+/// - bcasts can get ahead of multiplies by the value of lookahead.
+/// ColMajor layout is assumed
+///
+/// @ingroup trmm_impl
+///
+template <Target target, typename scalar_t>
+void trtrmm(
+    scalar_t alpha, TriangularMatrix<scalar_t>& A,
+                    TriangularMatrix<scalar_t>& B,
+                              Matrix<scalar_t>& C,
+    Options const& opts )
+{
+    using BcastListTag = typename Matrix<scalar_t>::BcastListTag;
+
+    trace::Block trace_block( "trtrmm" );
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const int priority_0 = 0;
+    const int queue_0 = 0;
+    const Layout layout = Layout::ColMajor;
+
+    // Options
+    int64_t lookahead = get_option<int64_t>( opts, Option::Lookahead, 1 );
+
+    // Internal gemm won't release any tiles; this routine cleans up tiles.
+    Options opts2 = opts;
+    opts2[ Option::TileReleaseStrategy ] = TileReleaseStrategy::Slate;
+
+    int64_t nt = A.nt();
+    bool lower_A = A.uplo() == Uplo::Lower;
+    bool upper_B = B.uplo() == Uplo::Upper;
+
+    // Non-zero rows of A(:, k) are [ i1, i2 ], non-zero cols of B(k, :)
+    // are [ j1, j2 ]; both include the diagonal tile k.
+    auto rows_A = [nt, lower_A]( int64_t k ) {
+        return lower_A ? std::make_pair( k, nt-1 )
+                       : std::make_pair( int64_t( 0 ), k );
+    };
+    auto cols_B = [nt, upper_B]( int64_t k ) {
+        return upper_B ? std::make_pair( k, nt-1 )
+                       : std::make_pair( int64_t( 0 ), k );
+    };
+
+    // Broadcast non-zero A(i, k) to ranks owning block row C(i, j1:j2),
+    // and non-zero B(k, j) to ranks owning block col C(i1:i2, j).
+    auto bcast_step = [&]( int64_t k ) {
+        auto ia = rows_A( k );
+        auto jb = cols_B( k );
+
+        BcastListTag bcast_list_A;
+        for (int64_t i = ia.first; i <= ia.second; ++i)
+            bcast_list_A.push_back(
+                {i, k, {C.sub(i, i, jb.first, jb.second)}, i});
+        A.template listBcastMT<target>(bcast_list_A, layout);
+
+        BcastListTag bcast_list_B;
+        for (int64_t j = jb.first; j <= jb.second; ++j)
+            bcast_list_B.push_back(
+                {k, j, {C.sub(ia.first, ia.second, j, j)}, j});
+        B.template listBcastMT<target>(bcast_list_B, layout);
+    };
+
+    // OpenMP needs pointer types, but vectors are exception safe
+    std::vector<uint8_t> bcast_vector( nt );
+    std::vector<uint8_t> gemm_vector( nt );
+    uint8_t* bcast = bcast_vector.data();
+    uint8_t* gemm  =  gemm_vector.data();
+
+    // C is zero outside the products below, which touch only the
+    // non-zero blocks of op(A) op(B).
+    set( zero, zero, C, opts );
+
+    if (target == Target::Devices) {
+        C.allocateBatchArrays();
+        C.reserveDeviceWorkspace();
+    }
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // send first lookahead+1 block cols of A and block rows of B
+        #pragma omp task depend(out:bcast[0])
+        {
+            bcast_step( 0 );
+        }
+        for (int64_t k = 1; k < lookahead+1 && k < nt; ++k) {
+            #pragma omp task depend(in:bcast[k-1]) \
+                             depend(out:bcast[k])
+            {
+                bcast_step( k );
+            }
+        }
+
+        for (int64_t k = 0; k < nt; ++k) {
+            // send next block col of A and block row of B
+            if (k > 0 && k+lookahead < nt) {
+                #pragma omp task depend(in:gemm[k-1]) \
+                                 depend(in:bcast[k+lookahead-1]) \
+                                 depend(out:bcast[k+lookahead])
+                {
+                    bcast_step( k+lookahead );
+                }
+            }
+
+            // C(ia, jb) += alpha A(ia, k) B(k, jb), split into the
+            // off-diagonal gemm, the triangular row and column, and the
+            // triangle-triangle corner C(k, k).
+            #pragma omp task depend(in:bcast[k]) \
+                             depend(in:gemm[k > 0 ? k-1 : 0]) \
+                             depend(out:gemm[k])
+            {
+                auto ia = rows_A( k );
+                auto jb = cols_B( k );
+
+                // Strictly off-diagonal ranges, possibly empty.
+                int64_t is1 = lower_A ? k+1 : 0;
+                int64_t is2 = lower_A ? nt-1 : k-1;
+                int64_t js1 = upper_B ? k+1 : 0;
+                int64_t js2 = upper_B ? nt-1 : k-1;
+
+                if (is1 <= is2 && js1 <= js2) {
+                    internal::gemm<target>(
+                        alpha, A.sub( is1, is2, k, k ),
+                               B.sub( k, k, js1, js2 ),
+                        one,   C.sub( is1, is2, js1, js2 ),
+                        layout, priority_0, queue_0, opts2 );
+                }
+                if (js1 <= js2) {
+                    internal::trmm_add<Target::HostTask>(
+                        Side::Left,
+                        alpha, A.sub( k, k ),
+                               B.sub( k, k, js1, js2 ),
+                               C.sub( k, k, js1, js2 ) );
+                }
+                if (is1 <= is2) {
+                    internal::trmm_add<Target::HostTask>(
+                        Side::Right,
+                        alpha, B.sub( k, k ),
+                               A.sub( is1, is2, k, k ),
+                               C.sub( is1, is2, k, k ) );
+                }
+                internal::trtrmm<Target::HostTask>(
+                    alpha, A.sub( k, k ),
+                           B.sub( k, k ),
+                           C.sub( k, k, k, k ) );
+
+                auto A_colblock = A.sub( ia.first, ia.second, k, k );
+                auto B_rowblock = B.sub( k, k, jb.first, jb.second );
+
+                // Erase remote tiles on all devices including host
+                A_colblock.eraseRemoteWorkspace();
+                B_rowblock.eraseRemoteWorkspace();
+
+                // Erase local workspace on devices.
+                A_colblock.eraseLocalWorkspace();
+                B_rowblock.eraseLocalWorkspace();
+            }
+        }
+        #pragma omp taskwait
+        C.tileUpdateAllOrigin();
+    }
+    C.releaseWorkspace();
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel triangular-triangular matrix multiplication.
+/// Performs the matrix-matrix operation
+/// \[
+///     C = \alpha op(A) op(B),
+/// \]
+/// where alpha is a scalar, $op(A)$ and $op(B)$ are n-by-n triangular
+/// matrices, each either upper or lower and unit or non-unit, and $C$ is an
+/// n-by-n general matrix. For example, with $A = LU$ from getrf_nopiv,
+/// `trtrmm( one, L, U, C )` reconstructs $A$.
+///
+/// Only the non-zero blocks of $op(A)$ and $op(B)$ are communicated and
+/// multiplied, and the diagonal tiles use triangular kernels that skip
+/// their zero triangles. For $L U$, this is $2/3 n^3$ flops rather
+/// than gemm's $2 n^3$; for two lower (or two upper) factors, $1/3 n^3$.
+/// To compute $U U^H$ or $L^H L$ in place, use trtrm (lauum).
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] alpha
+///         The scalar alpha.
+///
+/// @param[in] A
+///         The n-by-n triangular matrix A.
+///
+/// @param[in] B
+///         The n-by-n triangular matrix B, with the same tiling as A.
+///
+/// @param[out] C
+///         The n-by-n matrix C, with the same tiling as A.
+///         On exit, overwritten by the result $\alpha op(A) op(B)$.
+///         C must not be transposed.
+///
+/// @param[in] opts
+///         Additional options, as map of name = value pairs. Possible options:
+///         - Option::Lookahead:
+///           Number of blocks to overlap communication and computation.
+///           lookahead >= 0. Default 1.
+///         - Option::Target:
+///           Implementation to target. Possible values:
+///           - HostTask:  OpenMP tasks on CPU host [default].
+///           - HostNest:  nested OpenMP parallel for loop on CPU host.
+///           - HostBatch: batched BLAS on CPU host.
+///           - Devices:   batched BLAS on GPU device.
+///           The off-diagonal products use the target; the diagonal
+///           triangular kernels run on the CPU host.
+///
+/// @ingroup trmm
+///
+template <typename scalar_t>
+void trtrmm(
+    scalar_t alpha, TriangularMatrix<scalar_t>& A,
+                    TriangularMatrix<scalar_t>& B,
+                              Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    slate_assert( A.mt() == A.nt() && B.mt() == B.nt() );
+    slate_assert( A.nt() == B.mt() );
+    slate_assert( C.mt() == A.mt() && C.nt() == B.nt() );
+    slate_assert( C.op() == Op::NoTrans );
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+            impl::trtrmm<Target::HostTask>( alpha, A, B, C, opts );
+            break;
+
+        case Target::HostNest:
+            impl::trtrmm<Target::HostNest>( alpha, A, B, C, opts );
+            break;
+
+        case Target::HostBatch:
+            impl::trtrmm<Target::HostBatch>( alpha, A, B, C, opts );
+            break;
+
+        case Target::Devices:
+            impl::trtrmm<Target::Devices>( alpha, A, B, C, opts );
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void trtrmm<float>(
+    float alpha, TriangularMatrix<float>& A,
+                 TriangularMatrix<float>& B,
+                           Matrix<float>& C,
+    Options const& opts);
+
+template
+void trtrmm<double>(
+    double alpha, TriangularMatrix<double>& A,
+                  TriangularMatrix<double>& B,
+                            Matrix<double>& C,
+    Options const& opts);
+
+template
+void trtrmm< std::complex<float> >(
+    std::complex<float> alpha, TriangularMatrix< std::complex<float> >& A,
+                               TriangularMatrix< std::complex<float> >& B,
+                                         Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void trtrmm< std::complex<double> >(
+    std::complex<double> alpha, TriangularMatrix< std::complex<double> >& A,
+                                TriangularMatrix< std::complex<double> >& B,
+                                          Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
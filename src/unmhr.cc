@@ -0,0 +1,179 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_schur.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Multiplies the general m-by-n matrix C by Q from `slate::gehrd` as
+/// follows:
+///
+/// op              |  side = Left  |  side = Right
+/// --------------- | ------------- | --------------
+/// op = NoTrans    |  $Q C  $      |  $C Q  $
+/// op = ConjTrans  |  $Q^H C$      |  $C Q^H$
+///
+/// where $Q$ is a unitary matrix defined as the product of
+/// block reflectors, as returned by `slate::gehrd`.
+/// Each block reflector $I - V T V^H$ is applied by distributed gemm.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] side
+///     - Side::Left:  apply $Q$ or $Q^H$ from the left;
+///     - Side::Right: apply $Q$ or $Q^H$ from the right.
+///
+/// @param[in] op
+///     - Op::NoTrans    apply $Q$;
+///     - Op::ConjTrans: apply $Q^H$;
+///     - Op::Trans:     apply $Q^T$ (only if real).
+///       In the real case, Op::Trans is equivalent to Op::ConjTrans.
+///       In the complex case, Op::Trans is not allowed.
+///
+/// @param[in] A
+///     On entry, the n-by-n matrix $A$, as returned by `slate::gehrd`.
+///
+/// @param[in] T
+///     On entry, triangular matrices of the block reflectors,
+///     as returned by `slate::gehrd`.
+///
+/// @param[in,out] C
+///     On entry, the m-by-n matrix $C$, with the same tile size as $A$.
+///     On exit, $C$ is overwritten by $Q C$, $Q^H C$, $C Q$, or $C Q^H$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void unmhr(
+    Side side, Op op,
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    if (is_complex<scalar_t>::value && op == Op::Trans) {
+        throw Exception("Complex numbers uses Op::ConjTrans, not Op::Trans.");
+    }
+    slate_assert( A.op() == Op::NoTrans );
+    slate_assert( C.op() == Op::NoTrans );
+    slate_assert( (side == Side::Left ? C.m() : C.n()) == A.n() );
+
+    int64_t n  = A.n();
+    int64_t mc = C.m();
+    int64_t nc = C.n();
+
+    // Panel offsets, as in gehrd.
+    std::vector<int64_t> panels;
+    int64_t k0 = 0;
+    for (int64_t k = 0; k < A.nt() && k0 < n-1; ++k) {
+        panels.push_back( k0 );
+        k0 += A.tileNb( k );
+    }
+    int64_t npanels = panels.size();
+
+    // Q = Q_0 Q_1 ... Q_{p-1}, so Q C and C Q^H start with the last panel.
+    bool forward = (side == Side::Left) == (op != Op::NoTrans);
+
+    auto V = A.emptyLike();
+    auto W = C.emptyLike();
+
+    for (int64_t p = 0; p < npanels; ++p) {
+        int64_t k = forward ? p : npanels-1 - p;
+        k0 = panels[ k ];
+        int64_t b  = std::min( A.tileNb( k ), n-1-k0 );
+        int64_t c0 = k0 + b;
+
+        auto A_panel = A.slice( k0+1, n-1, k0, c0-1 );
+        auto V_panel = V.slice( k0+1, n-1, k0, c0-1 );
+        V_panel.insertLocalTiles();
+        internal::copy_reflectors( A_panel, V_panel );
+
+        auto T_panel = T[ 0 ].slice( k0, c0-1, k0, c0-1 );
+        auto Tk = TriangularMatrix<scalar_t>(
+            Uplo::Upper, Diag::NonUnit, T_panel );
+        // Q_k^H = I - V T^H V^H.
+        auto TkH = conj_transpose( Tk );
+        auto& Top = (op == Op::NoTrans) ? Tk : TkH;
+
+        if (side == Side::Left) {
+            // C = C - V op(T) V^H C, on rows k0+1 : n-1.
+            auto C_low = C.slice( k0+1, n-1, 0, nc-1 );
+            auto VH = conj_transpose( V_panel );
+            auto W_panel = W.slice( k0, c0-1, 0, nc-1 );
+            W_panel.insertLocalTiles();
+            slate::gemm( one, VH, C_low, zero, W_panel, opts );
+            slate::trmm( Side::Left, one, Top, W_panel, opts );
+            slate::gemm( -one, V_panel, W_panel, one, C_low, opts );
+        }
+        else {
+            // C = C - C V op(T) V^H, on columns k0+1 : n-1.
+            auto C_right = C.slice( 0, mc-1, k0+1, n-1 );
+            auto VH = conj_transpose( V_panel );
+            auto W_panel = W.slice( 0, mc-1, k0, c0-1 );
+            W_panel.insertLocalTiles();
+            slate::gemm( one, C_right, V_panel, zero, W_panel, opts );
+            slate::trmm( Side::Right, one, Top, W_panel, opts );
+            slate::gemm( -one, W_panel, VH, one, C_right, opts );
+        }
+    }
+
+    C.tileUpdateAllOrigin();
+    C.releaseWorkspace();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmhr<float>(
+    Side side, Op op,
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void unmhr<double>(
+    Side side, Op op,
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void unmhr< std::complex<float> >(
+    Side side, Op op,
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void unmhr< std::complex<double> >(
+    Side side, Op op,
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
@@ -43,16 +43,13 @@ void unmlq(
         C.reserveDeviceWorkspace();
     }
 
-    // Reserve workspace
-    auto W = C.emptyLike();
+    // Reserve workspace: one tile row (side = left) or column
+    // (side = right) of W per MPI process, reused by every panel.
+    auto W = internal::unmqr_workspace( side, C );
 
     if (target == Target::Devices) {
         W.allocateBatchArrays();
-        // todo: this is demanding too much device workspace memory
-        // only one tile-col of matrix W per MPI process is going to be used,
-        // but W with size of whole C is being allocated
-        // thus limiting the matrix size that can be processed
-        //W.reserveDeviceWorkspace();
+        W.reserveDeviceWorkspace();
     }
 
     assert(T.size() == 2);
@@ -200,11 +197,11 @@ void unmlq(
                 Matrix<scalar_t> C_trail, W_trail;
                 if (side == Side::Left) {
                     C_trail = C.sub(k, C_mt-1, 0, C_nt-1);
-                    W_trail = W.sub(k, C_mt-1, 0, C_nt-1);
+                    W_trail = W.sub(0, 0, 0, C_nt-1);
                 }
                 else {
                     C_trail = C.sub(0, C_mt-1, k, C_nt-1);
-                    W_trail = W.sub(0, C_mt-1, k, C_nt-1);
+                    W_trail = W.sub(0, C_mt-1, 0, 0);
                 }
 
                 // Left,  (Conj)Trans: Qi^H C = Qi_local^H Qi_reduce^H C, or
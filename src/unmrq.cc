@@ -0,0 +1,120 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_reverse.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel multiply by $Q$ from RQ factorization.
+///
+/// Multiplies the general m-by-n matrix $C$ by $Q$ from RQ factorization,
+/// according to:
+///
+/// op              |  side = Left  |  side = Right
+/// --------------- | ------------- | --------------
+/// op = NoTrans    |  $Q C  $      |  $C Q  $
+/// op = ConjTrans  |  $Q^H C$      |  $C Q^H$
+///
+/// where $Q$ is a unitary matrix defined as the product of k
+/// elementary reflectors, as returned by gerqf.
+/// $Q$ is of order m if side = Left and of order n if side = Right.
+///
+/// Since $Q = J Z J$, where $Z$ is from the LQ factorization of the
+/// reversed matrix $J A J$, this computes $J C J$, multiplies it by $Z$
+/// using unmlq, and reverses the result back into $C$; the $J$ on the
+/// other side of $C$ cancels. Reversing $A$ and $C$ takes all-to-all
+/// exchanges and a workspace the size of $A$ and $C$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] side
+///     - Side::Left:  apply $Q$ or $Q^H$ from the left;
+///     - Side::Right: apply $Q$ or $Q^H$ from the right.
+///
+/// @param[in] op
+///     - Op::NoTrans    apply $Q$;
+///     - Op::ConjTrans: apply $Q^H$;
+///     - Op::Trans:     apply $Q^T$ (only if real).
+///       In the real case, Op::Trans is equivalent to Op::ConjTrans.
+///       In the complex case, Op::Trans is not allowed.
+///
+/// @param[in] A
+///     Details of the RQ factorization of the original matrix $A$ as returned
+///     by gerqf.
+///
+/// @param[in] T
+///     Triangular matrices of the block reflectors as returned by gerqf.
+///
+/// @param[in,out] C
+///     On entry, the m-by-n matrix $C$.
+///     On exit, $C$ is overwritten by $Q C$, $Q^H C$, $C Q$, or $C Q^H$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs, passed to unmlq.
+///
+/// @ingroup gerqf_computational
+///
+template <typename scalar_t>
+void unmrq(
+    Side side, Op op,
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Matrix<scalar_t>& C,
+    Options const& opts )
+{
+    auto Ar = A.emptyLike();
+    Ar.insertLocalTiles();
+    internal::reverse_copy( A, Ar );
+
+    auto Cr = C.emptyLike();
+    Cr.insertLocalTiles();
+    internal::reverse_copy( C, Cr );
+
+    unmlq( side, op, Ar, T, Cr, opts );
+
+    internal::reverse_copy( Cr, C );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmrq<float>(
+    Side side, Op op,
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void unmrq<double>(
+    Side side, Op op,
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void unmrq< std::complex<float> >(
+    Side side, Op op,
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void unmrq< std::complex<double> >(
+    Side side, Op op,
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
@@ -116,6 +116,22 @@ inline void he2ge(slate::HermitianMatrix<scalar_t> A, slate::Matrix<scalar_t> B)
     }
 }
 
+//------------------------------------------------------------------------------
+// Adds shift to the diagonal of A.
+template <typename matrix_type>
+void shift_diagonal(
+    blas::real_type<typename matrix_type::value_type> shift, matrix_type& A)
+{
+    for (int64_t i = 0; i < std::min( A.mt(), A.nt() ); ++i) {
+        if (A.tileIsLocal( i, i )) {
+            A.tileGetForWriting( i, i, slate::LayoutConvert::ColMajor );
+            auto Aii = A( i, i );
+            for (int64_t k = 0; k < std::min( Aii.mb(), Aii.nb() ); ++k)
+                Aii.at( k, k ) += shift;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 // Class to carry matrix_type for overloads with return type, in lieu of
 // partial specialization. See
@@ -484,7 +484,7 @@ if (opts.ql):
 # RQ
 if (opts.rq):
     cmds += [
-    #[ 'gerqf', gen + dtype + la + mn ],
+    [ 'gerqf', gen + dtype + la + mn ],
     #[ 'ggrqf', gen + dtype + la + mnk ],
     #[ 'ungrq', gen + dtype + la + mnk ],
     #[ 'unmrq', gen + dtype_real    + la + mnk + side + trans    ],  # real does trans = N, T, C
@@ -53,6 +53,7 @@ enum Section {
     sygv,
     geev,
     svd,
+    matfun,
     aux,
     aux_norm,
     aux_householder,
@@ -73,6 +74,7 @@ const char* section_names[] = {
     "generalized symmetric eigenvalues",
     "non-symmetric eigenvalues",
     "singular value decomposition (SVD)",
+    "matrix functions",
     "auxiliary",
     "matrix norms",
     "auxiliary - Householder",
@@ -103,6 +105,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "trmm",               test_trmm,         Section::blas3 },
     { "trsm",               test_trsm,         Section::blas3 },
     { "trsmA",              test_trsm,         Section::blas3 },
+    { "trtrmm",             test_trtrmm,       Section::blas3 },
     { "tbsm",               test_tbsm,         Section::blas3 },
 
     // -----
@@ -111,6 +114,8 @@ std::vector< testsweeper::routines_t > routines = {
     { "gesv_nopiv",         test_gesv,         Section::gesv },
     { "gesv_tntpiv",        test_gesv,         Section::gesv },
     { "gesvMixed",          test_gesv,         Section::gesv },
+    { "gesv_multishift",    test_gesv_multishift, Section::gesv },
+    { "gerfs",              test_gerfs,        Section::gesv },
     { "gbsv",               test_gbsv,         Section::gesv },
     { "",                   nullptr,           Section::newline },
 
@@ -138,6 +143,7 @@ std::vector< testsweeper::routines_t > routines = {
     // Cholesky
     { "posv",               test_posv,         Section::posv },
     { "posvMixed",          test_posv,         Section::posv },
+    { "porfs",              test_gerfs,        Section::posv },
     { "pbsv",               test_pbsv,         Section::posv },
     { "",                   nullptr,           Section::newline },
 
@@ -152,6 +158,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "potri",              test_potri,        Section::posv },
     { "",                   nullptr,           Section::newline },
 
+    { "potrf_update",       test_potrf_update, Section::posv },
+    { "potrf_downdate",     test_potrf_update, Section::posv },
+    { "",                   nullptr,           Section::newline },
+
     // -----
     // symmetric indefinite
     //{ "sysv",                test_sysv,         Section::sysv },
@@ -177,6 +187,9 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // least squares
     { "gels",                test_gels,         Section::gels },
+    { "gelsy",               test_gelsy,        Section::gels },
+    { "gglse",               test_gglse,        Section::gels },
+    { "ggglm",               test_gglse,        Section::gels },
     { "",                    nullptr,           Section::newline },
 
     // -----
@@ -185,7 +198,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "cholqr",             test_geqrf,     Section::qr },
     { "gelqf",              test_gelqf,     Section::qr },
     //{ "geqlf",              test_geqlf,     Section::qr },
-    //{ "gerqf",              test_gerqf,     Section::qr },
+    { "gerqf",              test_gerqf,     Section::qr },
     //{ "",                   nullptr,        Section::newline },
 
     //{ "ungqr",              test_ungqr,     Section::qr },
@@ -224,6 +237,12 @@ std::vector< testsweeper::routines_t > routines = {
 
     // -----
     // non-symmetric eigenvalues
+    { "geev",               test_geev,         Section::geev },
+    { "gees",               test_geev,         Section::geev },
+    { "gesyl",              test_gesyl,        Section::geev },
+    { "gelyap",             test_gesyl,        Section::geev },
+    { "gelyap_sign",        test_gesyl,        Section::geev },
+    { "",                   nullptr,           Section::newline },
 
     // -----
     // SVD
@@ -231,6 +250,15 @@ std::vector< testsweeper::routines_t > routines = {
     { "ge2tb",              test_ge2tb,        Section::svd },
     { "tb2bd",              test_tb2bd,        Section::svd },
     { "bdsqr",              test_bdsqr,        Section::svd },
+    { "ggsvd",              test_ggsvd,        Section::svd },
+    { "",                   nullptr,           Section::newline },
+
+    // -----
+    // matrix functions
+    { "expm",               test_expm,         Section::matfun },
+    { "sqrtm",              test_expm,         Section::matfun },
+    { "invsqrtm",           test_expm,         Section::matfun },
+    { "hefunm",             test_expm,         Section::matfun },
     { "",                   nullptr,           Section::newline },
 
     // -----
@@ -256,6 +284,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "headd",              test_add,          Section::aux },
     { "",                   nullptr,           Section::newline },
 
+    { "compress",           test_compress,     Section::aux },
+    { "compress_lossy",     test_compress,     Section::aux },
+    { "",                   nullptr,           Section::newline },
+
     { "copy",               test_copy,         Section::aux },
     { "tzcopy",             test_copy,         Section::aux },
     { "trcopy",             test_copy,         Section::aux },
@@ -263,6 +295,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "hecopy",             test_copy,         Section::aux },
     { "",                   nullptr,           Section::newline },
 
+    { "redistribute",       test_redistribute, Section::aux },
+    { "",                   nullptr,           Section::newline },
+
     { "scale",              test_scale,        Section::aux },
     { "tzscale",            test_scale,        Section::aux },
     { "trscale",            test_scale,        Section::aux },
@@ -279,6 +314,27 @@ std::vector< testsweeper::routines_t > routines = {
     { "syset",              test_set,          Section::aux },
     { "heset",              test_set,          Section::aux },
     { "",                   nullptr,           Section::newline },
+
+    { "write",              test_io,           Section::aux },
+    { "write_colmajor",     test_io,           Section::aux },
+    { "",                   nullptr,           Section::newline },
+
+    { "import_dense",       test_import,       Section::aux },
+    { "import_csr",         test_import,       Section::aux },
+    { "",                   nullptr,           Section::newline },
+
+    { "potrf_restart",      test_checkpoint,   Section::aux },
+    { "getrf_restart",      test_checkpoint,   Section::aux },
+    { "geqrf_restart",      test_checkpoint,   Section::aux },
+    { "",                   nullptr,           Section::newline },
+
+    { "posv_ooc",           test_ooc,          Section::aux },
+    { "gesv_ooc",           test_ooc,          Section::aux },
+    { "",                   nullptr,           Section::newline },
+
+    { "gemm_generator",     test_generator,    Section::aux },
+    { "potrf_generator",    test_generator,    Section::aux },
+    { "",                   nullptr,           Section::newline },
 };
 
 // -----------------------------------------------------------------------------
@@ -332,7 +388,7 @@ Params::Params():
 
     method_cholQR ("method-cholQR", 6, ParamType::List, 0, str2methodCholQR, methodCholQR2str, "method-cholQR: auto=auto, herkC, gemmA, gemmC"),
     method_gels   ("method-gels",   6, ParamType::List, 0, str2methodGels,   methodGels2str,   "method-gels: auto=auto, qr, cholqr"),
-    method_gemm   ("method-gemm",   4, ParamType::List, 0, str2methodGemm,   methodGemm2str,   "method-gemm: auto=auto, A=gemmA, C=gemmC"),
+    method_gemm   ("method-gemm",   4, ParamType::List, 0, str2methodGemm,   methodGemm2str,   "method-gemm: auto=auto, A=gemmA, C=gemmC, S=Strassen"),
     method_hemm   ("method-hemm",   4, ParamType::List, 0, str2methodHemm,   methodHemm2str,   "method-hemm: auto=auto, A=hemmA, C=hemmC"),
     method_lu     ("method-lu",     5, ParamType::List, slate::MethodLU::PartialPiv, str2methodLU, methodLU2str, "method-lu: PartialPiv, CALU, NoPiv"),
     method_trsm   ("method-trsm",   4, ParamType::List, 0, str2methodTrsm,   methodTrsm2str,   "method-trsm: auto=auto, A=trsmA, B=trsmB"),
@@ -396,6 +452,8 @@ Params::Params():
                "given rank waits for debugger (gdb/lldb) to attach"),
     pivot_threshold(
                "thresh",  6, 2, ParamType::List, 1.0,   0.0,     1.0, "threshold for pivoting a remote row"),
+    pivot_batch("pivot-batch",
+                          2,    ParamType::List, 1,       1, 1000000, "(pb) number of panels whose row swaps are applied together in getrf"),
 
     // ----- output parameters
     // min, max are ignored
@@ -433,6 +491,7 @@ Params::Params():
     // set header different than command line prefix
     lookahead.name("la", "lookahead");
     panel_threads.name("pt", "panel-threads");
+    pivot_batch.name("pb", "pivot-batch");
     grid_order.name("go", "grid-order");
 
     // Change name for the methods to use less space in the stdout
@@ -138,6 +138,7 @@ public:
     testsweeper::ParamChar   nonuniform_nb;
     testsweeper::ParamInt    debug;
     testsweeper::ParamDouble pivot_threshold;
+    testsweeper::ParamInt    pivot_batch;
 
     // ----- output parameters
     testsweeper::ParamScientific value;
@@ -187,6 +188,7 @@ void test_syrk   (Params& params, bool run);
 void test_tbsm   (Params& params, bool run);
 void test_trsm   (Params& params, bool run);
 void test_trmm   (Params& params, bool run);
+void test_trtrmm (Params& params, bool run);
 void test_hemm   (Params& params, bool run);
 void test_hbmm   (Params& params, bool run);
 void test_her2k  (Params& params, bool run);
@@ -194,6 +196,8 @@ void test_herk   (Params& params, bool run);
 
 // LU, general
 void test_gesv       (Params& params, bool run);
+void test_gesv_multishift (Params& params, bool run);
+void test_gerfs      (Params& params, bool run);
 void test_gecondest  (Params& params, bool run);
 void test_getri      (Params& params, bool run);
 void test_trtri      (Params& params, bool run);
@@ -204,6 +208,7 @@ void test_gbsv   (Params& params, bool run);
 // Cholesky
 void test_posv   (Params& params, bool run);
 void test_potri  (Params& params, bool run);
+void test_potrf_update (Params& params, bool run);
 
 // Cholesky, band
 void test_pbsv   (Params& params, bool run);
@@ -220,8 +225,11 @@ void test_hetrs  (Params& params, bool run);
 
 // QR, LQ, RQ, QL
 void test_gels      (Params& params, bool run);
+void test_gelsy     (Params& params, bool run);
+void test_gglse     (Params& params, bool run);
 void test_geqrf     (Params& params, bool run);
 void test_gelqf     (Params& params, bool run);
+void test_gerqf     (Params& params, bool run);
 void test_unmqr     (Params& params, bool run);
 void test_trcondest (Params& params, bool run);
 
@@ -238,14 +246,22 @@ void test_unmtr_hb2st(Params& params, bool run);
 void test_hegv   (Params& params, bool run);
 void test_hegst  (Params& params, bool run);
 
+// non-symmetric eigenvalues
+void test_geev   (Params& params, bool run);
+void test_gesyl  (Params& params, bool run);
+
 // SVD
 void test_gesvd  (Params& params, bool run);
 void test_ge2tb  (Params& params, bool run);
 void test_tb2bd  (Params& params, bool run);
 void test_bdsqr  (Params& params, bool run);
+void test_ggsvd  (Params& params, bool run);
 void test_unmbr_ge2tb(Params& params, bool run);
 void test_unmbr_tb2bd(Params& params, bool run);
 
+// matrix functions
+void test_expm   (Params& params, bool run);
+
 // matrix norms
 void test_gbnorm (Params& params, bool run);
 void test_genorm (Params& params, bool run);
@@ -256,7 +272,14 @@ void test_trnorm (Params& params, bool run);
 
 // auxiliary matrix routines
 void test_add    (Params& params, bool run);
+void test_checkpoint(Params& params, bool run);
+void test_compress(Params& params, bool run);
 void test_copy   (Params& params, bool run);
+void test_generator(Params& params, bool run);
+void test_import (Params& params, bool run);
+void test_io     (Params& params, bool run);
+void test_ooc    (Params& params, bool run);
+void test_redistribute(Params& params, bool run);
 void test_scale  (Params& params, bool run);
 void test_scale_row_col(Params& params, bool run);
 void test_set    (Params& params, bool run);
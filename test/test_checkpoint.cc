@@ -0,0 +1,206 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Factors A with checkpoints, then restarts the factorization from the last
+// checkpoint into B, and checks that B matches A.
+template <typename scalar_t>
+void test_checkpoint_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    bool is_potrf = params.routine == "potrf_restart";
+    slate::Uplo uplo = slate::Uplo::General;
+    if (is_potrf)
+        uplo = params.uplo();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t lookahead = params.lookahead();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.time2();
+    params.time2.name( "restart (s)" );
+
+    if (! run) {
+        if (is_potrf)
+            params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (is_potrf)
+        m = n;
+
+    // Checkpoint half way, so the restart redoes the second half.
+    int64_t kt = std::min( slate::ceildiv( m, nb ), slate::ceildiv( n, nb ) );
+    if (kt < 2) {
+        params.msg() = "skipping: requires at least 2 block columns";
+        return;
+    }
+    int64_t interval = kt / 2;
+
+    std::string prefix = "slate_test_checkpoint";
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::InnerBlocking, ib},
+        {slate::Option::CheckpointInterval, interval},
+        {slate::Option::CheckpointFile, prefix.c_str()}
+    };
+
+    int mpi_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+
+    slate::Matrix<scalar_t> B( m, n, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    slate::set( zero, B );
+
+    slate::HermitianMatrix<scalar_t> AH, BH;
+    if (is_potrf) {
+        AH = slate::HermitianMatrix<scalar_t>( uplo, A );
+        BH = slate::HermitianMatrix<scalar_t>( uplo, B );
+        slate::generate_matrix( params.matrix, AH );
+    }
+    else {
+        slate::generate_matrix( params.matrix, A );
+    }
+
+    print_matrix( "A", A, params );
+
+    slate::Pivots pivots_A, pivots_B;
+    slate::TriangularFactors<scalar_t> T_A, T_B;
+
+    //==================================================
+    // Run SLATE test: factor A with checkpoints.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (is_potrf)
+        slate::potrf( AH, opts );
+    else if (params.routine == "getrf_restart")
+        slate::getrf( A, pivots_A, opts );
+    else
+        slate::geqrf( A, T_A, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    //==================================================
+    // Restart from the last checkpoint into B.
+    //==================================================
+    time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (is_potrf)
+        slate::potrf_restart( BH, opts );
+    else if (params.routine == "getrf_restart")
+        slate::getrf_restart( B, pivots_B, opts );
+    else
+        slate::geqrf_restart( B, T_B, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time2() = time;
+
+    if (mpi_rank == 0) {
+        std::remove( (prefix + ".meta").c_str() );
+        for (std::string slot : { "0", "1" }) {
+            for (std::string name : { "A", "T0", "T1" })
+                std::remove( (prefix + "." + slot + "." + name).c_str() );
+        }
+    }
+
+    print_matrix( "B", B, params );
+
+    if (check) {
+        //==================================================
+        // Test results: B - A should be zero, up to rounding
+        // from a different order of operations.
+        //==================================================
+        real_t error;
+        if (is_potrf) {
+            slate::TriangularMatrix<scalar_t> LA( uplo, slate::Diag::NonUnit, A );
+            slate::TriangularMatrix<scalar_t> LB( uplo, slate::Diag::NonUnit, B );
+            real_t A_norm = slate::norm( slate::Norm::One, LA );
+            slate::add( -one, LA, one, LB );
+            error = slate::norm( slate::Norm::One, LB ) / A_norm;
+        }
+        else {
+            real_t A_norm = slate::norm( slate::Norm::One, A );
+            slate::add( -one, A, one, B );
+            error = slate::norm( slate::Norm::One, B ) / A_norm;
+        }
+
+        // Pivots restored from the checkpoint and recomputed must match.
+        bool pivots_okay = pivots_A.size() == pivots_B.size();
+        for (size_t k = 0; pivots_okay && k < pivots_A.size(); ++k) {
+            pivots_okay = pivots_A[ k ].size() == pivots_B[ k ].size();
+            for (size_t i = 0; pivots_okay && i < pivots_A[ k ].size(); ++i) {
+                auto const& pa = pivots_A[ k ][ i ];
+                auto const& pb = pivots_B[ k ][ i ];
+                pivots_okay = pa.tileIndex() == pb.tileIndex()
+                              && pa.elementOffset() == pb.elementOffset();
+            }
+        }
+
+        params.error() = error;
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+        params.okay() = (error <= tol) && pivots_okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_checkpoint(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_checkpoint_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_checkpoint_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_checkpoint_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_checkpoint_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Packs and unpacks every local tile of A, as a tile broadcast does,
+// and reports the codec throughput, compression ratio, and error.
+template <typename scalar_t>
+void test_compress_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // get & mark input values
+    bool lossy = params.routine == "compress_lossy";
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t repeat = params.repeat();
+    bool check = params.check() == 'y';
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.gflops();
+    params.gflops.name( "pack GB/s" );
+    params.gflops2();
+    params.gflops2.name( "unpack GB/s" );
+    params.value();
+    params.value.name( "ratio" );
+
+    if (! run)
+        return;
+
+    slate::TileCompression compression = lossy
+                                       ? slate::TileCompression::Lossy
+                                       : slate::TileCompression::Lossless;
+    // Keep about half the mantissa.
+    double tolerance = lossy
+                     ? std::sqrt( std::numeric_limits<real_t>::epsilon() )
+                     : 0;
+
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles();
+    slate::generate_matrix( params.matrix, A );
+
+    slate::Matrix<scalar_t> B( m, n, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles();
+
+    print_matrix( "A", A, params );
+
+    std::vector< std::pair<int64_t, int64_t> > tiles;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j ))
+                tiles.push_back( { i, j } );
+        }
+    }
+    std::vector< std::vector<uint8_t> > buffers( tiles.size() );
+
+    //==================================================
+    // Run test: pack, then unpack, all local tiles.
+    //==================================================
+    double pack_time = 0, unpack_time = 0;
+    for (int64_t r = 0; r < repeat; ++r) {
+        double time = barrier_get_wtime( MPI_COMM_WORLD );
+        for (size_t k = 0; k < tiles.size(); ++k) {
+            auto T = A( tiles[ k ].first, tiles[ k ].second );
+            T.pack( compression, tolerance, buffers[ k ] );
+        }
+        pack_time += barrier_get_wtime( MPI_COMM_WORLD ) - time;
+
+        time = barrier_get_wtime( MPI_COMM_WORLD );
+        for (size_t k = 0; k < tiles.size(); ++k) {
+            auto T = B( tiles[ k ].first, tiles[ k ].second );
+            T.unpack( buffers[ k ].data(), A.tileLayout( tiles[ k ].first,
+                                                         tiles[ k ].second ) );
+        }
+        unpack_time += barrier_get_wtime( MPI_COMM_WORLD ) - time;
+    }
+
+    double local_bytes = 0;
+    for (auto const& buffer : buffers)
+        local_bytes += buffer.size();
+    double packed_bytes;
+    MPI_Allreduce( &local_bytes, &packed_bytes, 1, MPI_DOUBLE, MPI_SUM,
+                   MPI_COMM_WORLD );
+
+    double gbyte = 1e-9 * repeat * m * n * sizeof(scalar_t);
+    params.time() = pack_time + unpack_time;
+    params.gflops() = gbyte / pack_time;
+    params.gflops2() = gbyte / unpack_time;
+    params.value() = m * n * sizeof(scalar_t) / packed_bytes;
+
+    print_matrix( "B", B, params );
+
+    if (check) {
+        //==================================================
+        // Test results: each entry of B is within the
+        // relative error bound of the entry of A.
+        //==================================================
+        real_t local_error = 0;
+        for (auto const& ij : tiles) {
+            auto TA = A( ij.first, ij.second );
+            auto TB = B( ij.first, ij.second );
+            for (int64_t jj = 0; jj < TA.nb(); ++jj) {
+                for (int64_t ii = 0; ii < TA.mb(); ++ii) {
+                    real_t a = std::abs( TA( ii, jj ) );
+                    real_t d = std::abs( TB( ii, jj ) - TA( ii, jj ) );
+                    if (a > std::numeric_limits<real_t>::min())
+                        local_error = std::max( local_error, d / a );
+                    else
+                        local_error = std::max( local_error, d );
+                }
+            }
+        }
+        real_t error;
+        MPI_Allreduce( &local_error, &error, 1, slate::mpi_type<real_t>::value,
+                       MPI_MAX, MPI_COMM_WORLD );
+
+        params.error() = error;
+        params.okay() = (error <= tolerance);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_compress(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_compress_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_compress_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_compress_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_compress_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,205 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+#include "matrix_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_expm_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    std::string routine = params.routine;
+    slate::Target origin_target = origin2target( origin );
+
+    // expm takes a general matrix; the others a Hermitian matrix,
+    // shifted to be positive definite for sqrtm and invsqrtm.
+    // For exp, A is scaled to || A ||_1 = 8, to avoid overflow while
+    // still using squaring.
+    const real_t exp_norm = 8;
+    slate::Matrix<scalar_t> A( n, n, nb, p, q, MPI_COMM_WORLD );
+    slate::HermitianMatrix<scalar_t> AH(
+        slate::Uplo::Lower, n, nb, p, q, MPI_COMM_WORLD );
+    if (routine == "expm") {
+        A.insertLocalTiles( origin_target );
+        slate::generate_matrix( params.matrix, A );
+        slate::scale( exp_norm, slate::norm( slate::Norm::One, A ), A );
+    }
+    else {
+        AH.insertLocalTiles( origin_target );
+        slate::generate_matrix( params.matrix, AH );
+        if (routine == "hefunm")
+            slate::scale( exp_norm, slate::norm( slate::Norm::One, AH ), AH );
+        else
+            shift_diagonal( slate::norm( slate::Norm::One, AH ) + 1, AH );
+
+        // General copy of A for checks.
+        A.insertLocalTiles();
+        he2ge( AH, A );
+    }
+
+    slate::Matrix<scalar_t> Aref;
+    if (check) {
+        Aref = A.emptyLike();
+        Aref.insertLocalTiles();
+        slate::copy( A, Aref );
+    }
+
+    slate::Matrix<scalar_t> X;
+    if (routine != "expm") {
+        X = A.emptyLike();
+        X.insertLocalTiles();
+    }
+
+    print_matrix( "A", A, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    if (routine == "expm") {
+        slate::expm( A, opts );
+        X = A;
+    }
+    else if (routine == "sqrtm") {
+        slate::sqrtm( AH, X, opts );
+    }
+    else if (routine == "invsqrtm") {
+        slate::invsqrtm( AH, X, opts );
+    }
+    else {
+        slate::hefunm(
+            []( real_t lambda ) { return scalar_t( std::exp( lambda ) ); },
+            AH, X, opts );
+    }
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+
+    print_matrix( "X", X, params );
+
+    if (check) {
+        //==================================================
+        // Test results by checking
+        //
+        //      expm:     || exp(A) exp(-A) - I ||_1 / (|| exp(A) ||_1 || exp(-A) ||_1 N)
+        //      sqrtm:    || X X - A ||_1 / (|| A ||_1 N)
+        //      invsqrtm: || X A X - I ||_1 / (|| X ||_1^2 || A ||_1 N)
+        //      hefunm:   || X - expm(A) ||_1 / (|| expm(A) ||_1 N)
+        //==================================================
+        real_t X_norm = slate::norm( slate::Norm::One, X );
+        real_t A_norm = slate::norm( slate::Norm::One, Aref );
+
+        auto R = A.emptyLike();
+        R.insertLocalTiles();
+
+        if (routine == "expm") {
+            // Aref = exp(-A)
+            slate::scale( -1.0, 1.0, Aref );
+            slate::expm( Aref, opts );
+            real_t E_norm = slate::norm( slate::Norm::One, Aref );
+            slate::set( zero, one, R );
+            slate::multiply( one, X, Aref, -one, R );
+            params.error() = slate::norm( slate::Norm::One, R )
+                           / (X_norm * E_norm * n);
+        }
+        else if (routine == "sqrtm") {
+            slate::multiply( one, X, X, -one, Aref );
+            params.error() = slate::norm( slate::Norm::One, Aref )
+                           / (A_norm * n);
+        }
+        else if (routine == "invsqrtm") {
+            auto W = A.emptyLike();
+            W.insertLocalTiles();
+            slate::multiply( one, X, Aref, zero, W );
+            slate::set( zero, one, R );
+            slate::multiply( one, W, X, -one, R );
+            params.error() = slate::norm( slate::Norm::One, R )
+                           / (X_norm * X_norm * A_norm * n);
+        }
+        else {
+            slate::expm( Aref, opts );
+            real_t E_norm = slate::norm( slate::Norm::One, Aref );
+            slate::add( one, X, -one, Aref );
+            params.error() = slate::norm( slate::Norm::One, Aref )
+                           / (E_norm * n);
+        }
+        real_t tol = params.tol() * 0.5 * eps;
+        params.okay() = (params.error() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_expm(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_expm_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_expm_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_expm_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_expm_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,225 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Sets D to the n-by-n block diagonal eigenvalue matrix, so that A V = V D.
+// For real types, a complex conjugate pair (re + i im, re - i im) in
+// Lambda(j), Lambda(j+1) gives the 2-by-2 block [ re, im; -im, re ].
+template <typename scalar_t>
+void set_eigenvalue_matrix(
+    std::vector< std::complex< blas::real_type<scalar_t> > > const& Lambda,
+    slate::Matrix<scalar_t>& D)
+{
+    const scalar_t zero = 0;
+    slate::set( zero, D );
+
+    int64_t n = D.n();
+    auto set_entry = [&D]( int64_t r, int64_t c, scalar_t value ) {
+        int64_t i = r / D.tileMb( 0 );
+        int64_t j = c / D.tileNb( 0 );
+        if (D.tileIsLocal( i, j )) {
+            D.tileGetForWriting( i, j, slate::LayoutConvert::ColMajor );
+            D( i, j ).at( r % D.tileMb( 0 ), c % D.tileNb( 0 ) ) = value;
+        }
+    };
+    for (int64_t j = 0; j < n; ++j) {
+        if constexpr (blas::is_complex<scalar_t>::value) {
+            set_entry( j, j, Lambda[ j ] );
+        }
+        else if (std::imag( Lambda[ j ] ) != 0 && j+1 < n) {
+            scalar_t re = std::real( Lambda[ j ] );
+            scalar_t im = std::imag( Lambda[ j ] );
+            set_entry( j,   j,    re );
+            set_entry( j+1, j,   -im );
+            set_entry( j,   j+1,  im );
+            set_entry( j+1, j+1,  re );
+            ++j;
+        }
+        else {
+            set_entry( j, j, std::real( Lambda[ j ] ) );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_geev_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t tol = params.tol() * 0.5 * eps;
+
+    // get & mark input values
+    slate::Job jobz = params.jobz();
+    int64_t n = params.dim.n();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.error2();
+    params.ortho();
+    params.error2.name( "back err" );
+    params.ortho.name( "Z orth." );
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    bool schur = params.routine == "gees";
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( n, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+
+    slate::Matrix<scalar_t> Z;
+    if (jobz == slate::Job::Vec) {
+        Z = A.emptyLike();
+        Z.insertLocalTiles( origin_target );
+    }
+
+    slate::Matrix<scalar_t> Aref;
+    if (check && jobz == slate::Job::Vec) {
+        Aref = A.emptyLike();
+        Aref.insertLocalTiles();
+        slate::copy( A, Aref );
+    }
+
+    print_matrix( "A", A, params );
+
+    std::vector< std::complex<real_t> > Lambda( n );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    if (schur)
+        slate::gees( A, Lambda, Z, opts );
+    else
+        slate::geev( A, Lambda, Z, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+
+    print_matrix( "A_out", A, params );
+    if (jobz == slate::Job::Vec)
+        print_matrix( "Z_out", Z, params );
+
+    if (check && jobz == slate::Job::Vec) {
+        real_t A_norm = slate::norm( slate::Norm::One, Aref );
+        auto R = A.emptyLike();
+        R.insertLocalTiles();
+
+        if (schur) {
+            //==================================================
+            // Test results by checking backwards error
+            //
+            //      || A - Z T Z^H ||_1
+            //     --------------------- < tol * epsilon
+            //        || A ||_1 * N
+            //
+            // and orthogonality
+            //
+            //      || I - Z^H Z ||_1
+            //     ------------------- < tol * epsilon
+            //              N
+            //==================================================
+            // R = Z T; Aref = Aref - R Z^H
+            slate::multiply( one, Z, A, zero, R );
+            auto ZH = conj_transpose( Z );
+            slate::multiply( -one, R, ZH, one, Aref );
+            params.error2() = slate::norm( slate::Norm::One, Aref )
+                            / (A_norm * n);
+
+            // R = I - Z^H Z
+            slate::set( zero, one, R );
+            slate::multiply( -one, ZH, Z, one, R );
+            params.ortho() = slate::norm( slate::Norm::One, R ) / n;
+            params.okay() = (params.error2() <= tol && params.ortho() <= tol);
+        }
+        else {
+            //==================================================
+            // Test results by checking backwards error
+            //
+            //      || A V - V Lambda ||_1
+            //     ------------------------------ < tol * epsilon
+            //      || A ||_1 * || V ||_1 * N
+            //==================================================
+            auto D = A.emptyLike();
+            D.insertLocalTiles();
+            set_eigenvalue_matrix( Lambda, D );
+
+            // R = A V - V D
+            slate::multiply( one, Aref, Z, zero, R );
+            slate::multiply( -one, Z, D, one, R );
+            real_t V_norm = slate::norm( slate::Norm::One, Z );
+            params.error2() = slate::norm( slate::Norm::One, R )
+                            / (A_norm * V_norm * n);
+            params.okay() = (params.error2() <= tol);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geev(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_geev_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geev_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geev_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geev_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Solves a least squares problem with a rank-deficient A = A1 A2,
+// where A1 is m-by-r and A2 is r-by-n, with r = min(m, n)/4,
+// and checks the rank and that the residual is orthogonal to A.
+template <typename scalar_t>
+void test_gelsy_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0, one = 1;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.error.name("leastsqr");
+    params.error2();
+    params.error2.name("rank err");
+    params.time();
+
+    if (! run)
+        return;
+
+    slate::Options const opts =  {
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    int64_t maxmn = std::max(m, n);
+    int64_t rank_ref = std::max( std::min(m, n) / 4, int64_t( 1 ) );
+    real_t rcond = std::sqrt( std::numeric_limits<real_t>::epsilon() );
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A1( m, rank_ref, nb, p, q, MPI_COMM_WORLD );
+    A1.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> A2( rank_ref, n, nb, p, q, MPI_COMM_WORLD );
+    A2.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Aref( m, n, nb, p, q, MPI_COMM_WORLD );
+    Aref.insertLocalTiles( origin_target );
+
+    slate::Matrix<scalar_t> BX( maxmn, nrhs, nb, p, q, MPI_COMM_WORLD );
+    BX.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Bref( m, nrhs, nb, p, q, MPI_COMM_WORLD );
+    Bref.insertLocalTiles( origin_target );
+
+    slate::generate_matrix( params.matrix, A1 );
+    slate::generate_matrix( params.matrix, A2 );
+    slate::multiply( one, A1, A2, zero, A );
+    slate::copy( A, Aref );
+
+    auto B = BX.slice( 0, m-1, 0, nrhs-1 );
+    auto X = BX.slice( 0, n-1, 0, nrhs-1 );
+    slate::generate_matrix( params.matrixB, B );
+    slate::copy( B, Bref );
+
+    print_matrix( "A", A, params );
+    print_matrix( "B", B, params );
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    int64_t rank = slate::gelsy( A, BX, rcond, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    print_matrix( "X", X, params );
+
+    if (check) {
+        //==================================================
+        // Test results.
+        // The rank should be exact, and the residual Res = B - A X
+        // orthogonal to A:
+        //
+        //      || Res^H A ||_1
+        //     ------------------------------------- < tol * epsilon
+        //      max(m, n, nrhs) || A ||_1 * || B ||_1
+        //==================================================
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+
+        real_t A_norm = slate::norm( slate::Norm::One, Aref );
+        real_t B_norm = slate::norm( slate::Norm::One, Bref );
+
+        // Bref = B - A X
+        slate::multiply( -one, Aref, X, one, Bref );
+
+        // RA = Res^H A
+        slate::Matrix<scalar_t> RA( nrhs, n, nb, p, q, MPI_COMM_WORLD );
+        RA.insertLocalTiles();
+        auto RT = conj_transpose( Bref );
+        slate::multiply( one, RT, Aref, zero, RA );
+
+        real_t error = slate::norm( slate::Norm::One, RA );
+        if (A_norm != 0)
+            error /= A_norm;
+        if (B_norm != 0)
+            error /= B_norm;
+        error /= blas::max( m, n, nrhs );
+
+        params.error() = error;
+        params.error2() = std::abs( rank - rank_ref );
+        params.okay() = (error <= tol && rank == rank_ref);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gelsy(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gelsy_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gelsy_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gelsy_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gelsy_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -13,6 +13,7 @@
 #include "scalapack_support_routines.hh"
 #include "scalapack_copy.hh"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -68,12 +69,28 @@ void test_gemm_work(Params& params, bool run)
     if (! run)
         return;
 
+    // For Strassen, recurse down to 2 tiles, to exercise it at test sizes.
     slate::Options const opts =  {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::MethodGemm, method_gemm},
+        {slate::Option::StrassenCrossover, 2*nb},
         {slate::Option::Target, target}
     };
 
+    // Strassen calls gemmC unless the top level splits into conforming
+    // quadrants: even, full tile counts, with p | mt/2 and q | nt/2.
+    if (method_gemm == slate::MethodGemm::Strassen) {
+        auto splits = [&]( int64_t rows, int64_t cols ) {
+            int64_t mt = rows / nb, nt = cols / nb;
+            return rows % nb == 0 && cols % nb == 0
+                   && mt % (2*p) == 0 && nt % (2*q) == 0;
+        };
+        if (transA != slate::Op::NoTrans || transB != slate::Op::NoTrans
+            || std::min( { m, n, k } ) < 2*nb
+            || ! splits( m, k ) || ! splits( k, n ) || ! splits( m, n ))
+            params.msg() = "Strassen does not split; ran gemmC";
+    }
+
     // Error analysis applies in these norms.
     slate_assert(norm == Norm::One || norm == Norm::Inf || norm == Norm::Fro);
 
@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Runs gemm or potrf on a matrix A whose tiles come from a generator
+// (Matrix::fromGenerator), and checks the result against the same routine
+// run on an explicitly stored copy of A.
+// The generator is the Kac-Murdock-Szego matrix, a_ij = (1/2)^|i - j|,
+// which is Hermitian positive definite, so the same A serves both routines.
+template <typename scalar_t>
+void test_generator_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    bool is_potrf = params.routine == "potrf_generator";
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.time();
+
+    if (! run)
+        return;
+
+    slate::Options const opts =  {
+        {slate::Option::Target, target}
+    };
+
+    auto kms = [](int64_t row, int64_t col, int64_t mb, int64_t nb,
+                  scalar_t* A, int64_t lda)
+    {
+        for (int64_t jj = 0; jj < nb; ++jj) {
+            for (int64_t ii = 0; ii < mb; ++ii) {
+                int64_t dist = std::abs( (row + ii) - (col + jj) );
+                A[ ii + jj*lda ] = std::pow( real_t( 0.5 ), real_t( dist ) );
+            }
+        }
+    };
+
+    // A is m-by-k for gemm, n-by-n for potrf.
+    int64_t Am = is_potrf ? n : m;
+    int64_t An = is_potrf ? n : k;
+
+    slate::Target origin_target = origin2target( origin );
+    auto A = slate::Matrix<scalar_t>::fromGenerator(
+        Am, An, nb, nb, p, q, kms, MPI_COMM_WORLD );
+    slate::Matrix<scalar_t> Aref( Am, An, nb, p, q, MPI_COMM_WORLD );
+    Aref.insertLocalTiles( slate::Target::Host );
+    for (int64_t j = 0; j < Aref.nt(); ++j) {
+        for (int64_t i = 0; i < Aref.mt(); ++i) {
+            if (Aref.tileIsLocal( i, j )) {
+                auto T = Aref( i, j );
+                kms( i*nb, j*nb, T.mb(), T.nb(), T.data(), T.stride() );
+            }
+        }
+    }
+
+    slate::Matrix<scalar_t> B, C, Cref;
+    if (! is_potrf) {
+        B = slate::Matrix<scalar_t>( k, n, nb, p, q, MPI_COMM_WORLD );
+        B.insertLocalTiles( origin_target );
+        slate::generate_matrix( params.matrixB, B );
+        C = slate::Matrix<scalar_t>( m, n, nb, p, q, MPI_COMM_WORLD );
+        C.insertLocalTiles( origin_target );
+        Cref = slate::Matrix<scalar_t>( m, n, nb, p, q, MPI_COMM_WORLD );
+        Cref.insertLocalTiles( origin_target );
+    }
+
+    slate::HermitianMatrix<scalar_t> AH, ArefH;
+    if (is_potrf) {
+        AH = slate::HermitianMatrix<scalar_t>( slate::Uplo::Lower, A );
+        ArefH = slate::HermitianMatrix<scalar_t>( slate::Uplo::Lower, Aref );
+    }
+
+    print_matrix( "Aref", Aref, params );
+
+    //==================================================
+    // Run SLATE test on the generated matrix.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (is_potrf) {
+        slate::potrf( AH, opts );
+    }
+    else {
+        slate::gemm( one, A, B, zero, C, opts );
+    }
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    if (check) {
+        //==================================================
+        // Run the same routine on the stored matrix.
+        //==================================================
+        real_t error;
+        if (is_potrf) {
+            slate::potrf( ArefH, opts );
+
+            // Bring the factor, including generated tiles that potrf
+            // overwrote, back to the host before comparing.
+            A.tileUpdateAllOrigin();
+            slate::TriangularMatrix<scalar_t> L(
+                slate::Uplo::Lower, slate::Diag::NonUnit, A );
+            slate::TriangularMatrix<scalar_t> Lref(
+                slate::Uplo::Lower, slate::Diag::NonUnit, Aref );
+            real_t L_norm = slate::norm( slate::Norm::One, Lref );
+            slate::add( -one, Lref, one, L );
+            error = slate::norm( slate::Norm::One, L ) / L_norm;
+        }
+        else {
+            slate::gemm( one, Aref, B, zero, Cref, opts );
+
+            real_t C_norm = slate::norm( slate::Norm::One, Cref );
+            slate::add( -one, Cref, one, C );
+            error = slate::norm( slate::Norm::One, C ) / C_norm;
+        }
+
+        params.error() = error;
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+        params.okay() = (error <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_generator(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_generator_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_generator_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_generator_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_generator_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+#include "matrix_utils.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Refines a solution from factors in precision scalar_lo, which is single
+// precision for double precision scalar_t, to exercise mixed precision.
+template <typename scalar_t, typename scalar_lo>
+void test_gerfs_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    // get & mark input values
+    slate::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t lookahead = params.lookahead();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    bool hpd = params.routine == "porfs";
+
+    // mark non-standard output values
+    params.error.name("berr");
+    params.error2();
+    params.error2.name("ferr");
+    params.iters();
+    params.time();
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( n, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+    slate::HermitianMatrix<scalar_t> AH( uplo, A );
+    if (hpd) {
+        // Diagonally dominant, hence positive definite.
+        shift_diagonal( real_t( n ), AH );
+    }
+
+    slate::Matrix<scalar_t> B( n, nrhs, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrixB, B );
+    auto X = B.emptyLike();
+    X.insertLocalTiles( origin_target );
+
+    print_matrix( "A", A, params );
+    print_matrix( "B", B, params );
+
+    // Factor in precision scalar_lo and solve.
+    auto A_lo = A.template emptyLike<scalar_lo>();
+    A_lo.insertLocalTiles();
+    auto X_lo = X.template emptyLike<scalar_lo>();
+    X_lo.insertLocalTiles();
+    slate::copy( A, A_lo );
+    slate::copy( B, X_lo );
+    slate::HermitianMatrix<scalar_lo> AH_lo( uplo, A_lo );
+    slate::Pivots pivots;
+    if (hpd) {
+        slate::potrf( AH_lo, opts );
+        slate::potrs( AH_lo, X_lo, opts );
+    }
+    else {
+        slate::getrf( A_lo, pivots, opts );
+        slate::getrs( A_lo, pivots, X_lo, opts );
+    }
+    slate::copy( X_lo, X );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    // Refine X to solve A X = B.
+    //==================================================
+    std::vector<real_t> ferr, berr;
+    int64_t iters;
+    if (hpd)
+        iters = slate::porfs( AH, AH_lo, B, X, ferr, berr, opts );
+    else
+        iters = slate::gerfs( A, A_lo, pivots, B, X, ferr, berr, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+    params.iters() = iters;
+
+    print_matrix( "X", X, params );
+
+    if (check) {
+        //==================================================
+        // Test results by checking the componentwise backward error,
+        //     max_j max_i |B - A X|_ij / (|A| |X| + |B|)_ij < tol * epsilon,
+        // and the normwise residual
+        //     || B - A X ||_1 / (|| A ||_1 || X ||_1 n) < tol * epsilon.
+        //==================================================
+        real_t berr_max = *std::max_element( berr.begin(), berr.end() );
+        real_t ferr_max = *std::max_element( ferr.begin(), ferr.end() );
+
+        real_t A_norm = hpd ? slate::norm( slate::Norm::One, AH )
+                            : slate::norm( slate::Norm::One, A );
+        real_t X_norm = slate::norm( slate::Norm::One, X );
+        auto R = B.emptyLike();
+        R.insertLocalTiles();
+        slate::copy( B, R );
+        if (hpd)
+            slate::multiply( -one, AH, X, one, R );
+        else
+            slate::multiply( -one, A, X, one, R );
+        real_t R_norm = slate::norm( slate::Norm::One, R );
+        real_t error = R_norm / (A_norm * X_norm * n);
+
+        params.error() = berr_max;
+        params.error2() = ferr_max;
+        real_t tol = params.tol() * 0.5 * eps;
+        params.okay() = (berr_max <= tol && error <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gerfs(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gerfs_work<float, float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gerfs_work<double, float> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gerfs_work<std::complex<float>, std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gerfs_work<std::complex<double>, std::complex<float>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "blas/flops.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gerqf_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0;
+    const scalar_t one = 1;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t lookahead = params.lookahead();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    // MPI variables
+    int mpi_rank, myrow, mycol;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    gridinfo(mpi_rank, p, q, &myrow, &mycol);
+
+    // Matrix A: figure out local size.
+    int64_t mlocA = num_local_rows_cols(m, nb, myrow, p);
+    int64_t nlocA = num_local_rows_cols(n, nb, mycol, q);
+    int64_t lldA  = blas::max(1, mlocA); // local leading dimension of A
+    std::vector<scalar_t> A_data;
+
+    slate::Matrix<scalar_t> A;
+    if (origin != slate::Origin::ScaLAPACK) {
+        // SLATE allocates CPU or GPU tiles.
+        slate::Target origin_target = origin2target(origin);
+        A = slate::Matrix<scalar_t>(m, n, nb, p, q, MPI_COMM_WORLD);
+        A.insertLocalTiles(origin_target);
+    }
+    else {
+        // create SLATE matrices from the ScaLAPACK layouts
+        A_data.resize( lldA * nlocA );
+        A = slate::Matrix<scalar_t>::fromScaLAPACK(
+                m, n, &A_data[0], lldA, nb, p, q, MPI_COMM_WORLD);
+    }
+
+    slate::generate_matrix(params.matrix, A);
+
+    slate::TriangularFactors<scalar_t> T;
+
+    print_matrix("A", A, params);
+
+    // For checks, keep copy of original matrix A.
+    std::vector<scalar_t> Aref_data;
+    slate::Matrix<scalar_t> Aref;
+    if (check) {
+        Aref_data.resize(lldA*nlocA);
+        Aref = slate::Matrix<scalar_t>::fromScaLAPACK(
+                   m, n, &Aref_data[0], lldA, nb, p, q, MPI_COMM_WORLD);
+        slate::copy(A, Aref);
+    }
+
+    // RQ has the same flop count as LQ.
+    double gflop = lapack::Gflop<scalar_t>::gelqf(m, n);
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    slate::gerqf(A, T, opts);
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    // compute and save timing/performance
+    params.time() = time;
+    params.gflops() = gflop / time;
+
+    print_matrix("A_factored", A, params);
+    print_matrix("Tlocal",  T[0], params);
+    print_matrix("Treduce", T[1], params);
+
+    if (check) {
+        //==================================================
+        // Test results by checking backwards error
+        //
+        //      || RQ - A ||_1
+        //     ---------------- < tol * epsilon
+        //      || A ||_1 * m
+        //
+        //==================================================
+
+        // R is on and above the (n-m)-th diagonal of A; zero the rest.
+        std::vector<scalar_t> RQ_data(Aref_data.size(), zero);
+        auto RQ = slate::Matrix<scalar_t>::fromScaLAPACK(
+                      m, n, &RQ_data[0], lldA, nb, p, q, MPI_COMM_WORLD);
+        slate::copy(A, RQ);
+        for (int64_t j = 0; j < RQ.nt(); ++j) {
+            for (int64_t i = 0; i < RQ.mt(); ++i) {
+                if (RQ.tileIsLocal(i, j)) {
+                    auto Tij = RQ(i, j);
+                    for (int64_t jj = 0; jj < Tij.nb(); ++jj) {
+                        for (int64_t ii = 0; ii < Tij.mb(); ++ii) {
+                            if ((j*nb + jj) - (i*nb + ii) < n - m)
+                                Tij.at(ii, jj) = zero;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Norm of original matrix: || A ||_1
+        real_t A_norm = slate::norm(slate::Norm::One, Aref);
+
+        print_matrix("R", RQ, params);
+
+        // Form RQ, where Q's representation is in A and T, and R is in RQ.
+        slate::unmrq(
+            slate::Side::Right, slate::Op::NoTrans, A, T, RQ, opts);
+
+        print_matrix("RQ", RQ, params);
+
+        // Form RQ - A, where A is in Aref.
+        // using axpy assumes Aref_data and RQ_data have same lda.
+        blas::axpy(RQ_data.size(), -one, &Aref_data[0], 1, &RQ_data[0], 1);
+
+        print_matrix("RQ - A", RQ, params);
+
+        // Norm of backwards error: || RQ - A ||_1
+        real_t R_norm = slate::norm(slate::Norm::One, RQ);
+
+        double residual = R_norm / (m*A_norm);
+        params.error() = residual;
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+        params.okay() = (params.error() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gerqf(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gerqf_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gerqf_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gerqf_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gerqf_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -77,6 +77,8 @@ void test_gesv_work(Params& params, bool run)
 
     // NoPiv and CALU ignore threshold.
     double pivot_threshold = params.pivot_threshold();
+    // NoPiv and CALU ignore pivot batch.
+    int64_t pivot_batch = params.pivot_batch();
 
     // mark non-standard output values
     params.time();
@@ -127,14 +129,18 @@ void test_gesv_work(Params& params, bool run)
         return;
     }
 
-    slate::Options const opts =  {
+    slate::Options opts =  {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, ib},
         {slate::Option::PivotThreshold, pivot_threshold},
+        {slate::Option::PivotBatch, pivot_batch},
         {slate::Option::MethodLU, method},
     };
+    // As in the ScaLAPACK API, work directly on ScaLAPACK data.
+    if (origin == slate::Origin::ScaLAPACK)
+        opts[ slate::Option::Layout ] = slate::Layout::ColMajor;
 
     // Matrix A: figure out local size.
     int64_t mlocA = num_local_rows_cols(m, nb, myrow, p);
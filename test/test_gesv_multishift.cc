@@ -0,0 +1,154 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+#include "matrix_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gesv_multishift_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t lookahead = params.lookahead();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.time();
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( n, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+
+    slate::Matrix<scalar_t> B( n, nrhs, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrixB, B );
+
+    // Shifts spread over [ 0, || A ||_1 ], enough for a group per rank
+    // on small grids.
+    real_t A_norm = slate::norm( slate::Norm::One, A );
+    int64_t nshifts = 4;
+    std::vector<scalar_t> shifts( nshifts );
+    for (int64_t i = 0; i < nshifts; ++i)
+        shifts[ i ] = A_norm * i / nshifts;
+
+    print_matrix( "A", A, params );
+    print_matrix( "B", B, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    // Solve (A - shifts[ i ] I) X[ i ] = B.
+    //==================================================
+    std::vector< slate::Matrix<scalar_t> > X;
+    slate::gesv_multishift( A, shifts, B, X, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+
+    if (check) {
+        //==================================================
+        // Test results by checking the residual of each shift
+        //
+        //      || B - (A - sigma I) X ||_1
+        //     -------------------------------------- < tol * epsilon
+        //      || A - sigma I ||_1 || X ||_1 N
+        //
+        // and reporting the largest.
+        //==================================================
+        auto As = A.emptyLike();
+        As.insertLocalTiles();
+        auto R = B.emptyLike();
+        R.insertLocalTiles();
+
+        real_t error = 0;
+        for (int64_t i = 0; i < nshifts; ++i) {
+            print_matrix( "X", X[ i ], params );
+
+            slate::copy( A, As );
+            shift_diagonal( -std::real( shifts[ i ] ), As );
+            slate::copy( B, R );
+
+            real_t As_norm = slate::norm( slate::Norm::One, As );
+            real_t X_norm = slate::norm( slate::Norm::One, X[ i ] );
+            slate::multiply( -one, As, X[ i ], one, R );
+            real_t R_norm = slate::norm( slate::Norm::One, R );
+            error = std::max( error, R_norm / (As_norm * X_norm * n) );
+        }
+        params.error() = error;
+        real_t tol = params.tol() * 0.5 * eps;
+        params.okay() = (params.error() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesv_multishift(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gesv_multishift_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesv_multishift_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesv_multishift_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesv_multishift_work<std::complex<double>> (params, run);
+            break;
+    }
+}
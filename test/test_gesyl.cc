@@ -0,0 +1,182 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+#include "matrix_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gesyl_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.time();
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    // For Lyapunov, A X + X A^H = C, all matrices are n-by-n.
+    bool sylvester = params.routine == "gesyl";
+    if (! sylvester)
+        m = n;
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( m, m, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+
+    slate::Matrix<scalar_t> B;
+    if (sylvester) {
+        B = slate::Matrix<scalar_t>( n, n, nb, p, q, MPI_COMM_WORLD );
+        B.insertLocalTiles( origin_target );
+        slate::generate_matrix( params.matrixB, B );
+    }
+
+    slate::Matrix<scalar_t> C( m, n, nb, p, q, MPI_COMM_WORLD );
+    C.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, C );
+
+    // Shift so the equation is well conditioned: for Sylvester, the
+    // eigenvalues of A and B have real part >= 1, so A and -B have
+    // disjoint spectra; for Lyapunov, A is stable.
+    if (sylvester) {
+        shift_diagonal( slate::norm( slate::Norm::One, A ) + 1, A );
+        shift_diagonal( slate::norm( slate::Norm::One, B ) + 1, B );
+    }
+    else {
+        shift_diagonal( -(slate::norm( slate::Norm::One, A ) + 1), A );
+    }
+
+    slate::Matrix<scalar_t> Aref, Bref, Cref;
+    if (check) {
+        Aref = A.emptyLike();
+        Aref.insertLocalTiles();
+        slate::copy( A, Aref );
+        if (sylvester) {
+            Bref = B.emptyLike();
+            Bref.insertLocalTiles();
+            slate::copy( B, Bref );
+        }
+        Cref = C.emptyLike();
+        Cref.insertLocalTiles();
+        slate::copy( C, Cref );
+    }
+
+    print_matrix( "A", A, params );
+    if (sylvester)
+        print_matrix( "B", B, params );
+    print_matrix( "C", C, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    if (sylvester)
+        slate::gesyl( 1, A, B, C, opts );
+    else if (params.routine == "gelyap")
+        slate::gelyap( A, C, opts );
+    else
+        slate::gelyap_sign( A, C, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+
+    print_matrix( "X", C, params );
+
+    if (check) {
+        //==================================================
+        // Test results by checking the residual
+        //
+        //      || C - A X - X B ||_1
+        //     ------------------------------------- < tol * epsilon
+        //      (|| A ||_1 + || B ||_1) || X ||_1 N
+        //
+        // with B = A^H for Lyapunov.
+        //==================================================
+        auto AH = conj_transpose( Aref );
+        auto& Bop = sylvester ? Bref : AH;
+
+        real_t A_norm = slate::norm( slate::Norm::One, Aref );
+        real_t B_norm = slate::norm( slate::Norm::One, Bop );
+        real_t X_norm = slate::norm( slate::Norm::One, C );
+
+        // Cref -= A X + X B
+        slate::multiply( -one, Aref, C, one, Cref );
+        slate::multiply( -one, C, Bop, one, Cref );
+
+        params.error() = slate::norm( slate::Norm::One, Cref )
+                       / ((A_norm + B_norm) * X_norm * std::max( m, n ));
+        real_t tol = params.tol() * 0.5 * eps;
+        params.okay() = (params.error() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesyl(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gesyl_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesyl_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesyl_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesyl_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,232 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// gglse: A is m-by-n, B is k-by-n; solves min || C - A X || s.t. B X = D.
+// ggglm: A is m-by-n, B is m-by-k; solves min || Y || s.t. D = A X + B Y.
+template <typename scalar_t>
+void test_gglse_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0, one = 1;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t nrhs = params.nrhs();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t lookahead = params.lookahead();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    bool glm = params.routine == "ggglm";
+
+    // mark non-standard output values
+    params.error.name("constraint");
+    if (! glm) {
+        params.error2();
+        params.error2.name("optimality");
+    }
+    params.time();
+
+    if (! run)
+        return;
+
+    if (! glm && ! (1 <= k && k <= n && n <= m + k)) {
+        params.msg() = "skipping: gglse requires 1 <= k <= n <= m + k";
+        return;
+    }
+    if (glm && ! (n <= m && m <= n + k)) {
+        params.msg() = "skipping: ggglm requires n <= m <= n + k";
+        return;
+    }
+
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    // Rows of the constraint B X = D, or D = A X + B Y.
+    int64_t Bm = glm ? m : k;
+    int64_t Bn = glm ? k : n;
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Aref( m, n, nb, p, q, MPI_COMM_WORLD );
+    Aref.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> B( Bm, Bn, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Bref( Bm, Bn, nb, p, q, MPI_COMM_WORLD );
+    Bref.insertLocalTiles( origin_target );
+
+    slate::Matrix<scalar_t> C( m, nrhs, nb, p, q, MPI_COMM_WORLD );
+    C.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Cref( m, nrhs, nb, p, q, MPI_COMM_WORLD );
+    Cref.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> D( Bm, nrhs, nb, p, q, MPI_COMM_WORLD );
+    D.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Dref( Bm, nrhs, nb, p, q, MPI_COMM_WORLD );
+    Dref.insertLocalTiles( origin_target );
+
+    slate::Matrix<scalar_t> X( n, nrhs, nb, p, q, MPI_COMM_WORLD );
+    X.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Y( k, nrhs, nb, p, q, MPI_COMM_WORLD );
+    Y.insertLocalTiles( origin_target );
+
+    slate::generate_matrix( params.matrix, A );
+    slate::generate_matrix( params.matrix, B );
+    slate::generate_matrix( params.matrixB, C );
+    slate::generate_matrix( params.matrixB, D );
+    slate::copy( A, Aref );
+    slate::copy( B, Bref );
+    slate::copy( C, Cref );
+    slate::copy( D, Dref );
+
+    print_matrix( "A", A, params );
+    print_matrix( "B", B, params );
+    print_matrix( "D", D, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (glm)
+        slate::ggglm( A, B, D, X, Y, opts );
+    else
+        slate::gglse( A, B, C, D, X, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+
+    print_matrix( "X", X, params );
+    if (glm)
+        print_matrix( "Y", Y, params );
+
+    if (check) {
+        //==================================================
+        // Test results.
+        // The constraint should hold:
+        //
+        //      || D - B X ||_1  or  || D - A X - B Y ||_1
+        //     -------------------------------------------- < tol * epsilon
+        //      max(m, n, k) (|| A ||_1 + || B ||_1) || X, Y ||_1
+        //
+        // For gglse, the residual Res = C - A X should also be
+        // orthogonal to A Z2^H, where the rows of Z2 span the null
+        // space of B:
+        //
+        //      || Z2 A^H Res ||_1
+        //     ------------------------------ < tol * epsilon
+        //      max(m, n) || A ||_1^2 || X ||_1
+        //==================================================
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+
+        real_t A_norm = slate::norm( slate::Norm::One, Aref );
+        real_t B_norm = slate::norm( slate::Norm::One, Bref );
+        real_t X_norm = slate::norm( slate::Norm::One, X );
+        real_t denom = A_norm + B_norm;
+
+        // Dref = D - A X - B Y or D - B X.
+        if (glm) {
+            real_t Y_norm = slate::norm( slate::Norm::One, Y );
+            X_norm = std::max( X_norm, Y_norm );
+            slate::multiply( -one, Aref, X, one, Dref );
+            slate::multiply( -one, Bref, Y, one, Dref );
+        }
+        else {
+            slate::multiply( -one, Bref, X, one, Dref );
+        }
+        real_t error = slate::norm( slate::Norm::One, Dref );
+        if (denom != 0 && X_norm != 0)
+            error /= denom * X_norm;
+        error /= blas::max( m, n, k );
+        params.error() = error;
+        params.okay() = (error <= tol);
+
+        if (! glm) {
+            // Cref = C - A X; W = A^H Res; W = Z W.
+            slate::multiply( -one, Aref, X, one, Cref );
+            slate::Matrix<scalar_t> W( n, nrhs, nb, p, q, MPI_COMM_WORLD );
+            W.insertLocalTiles();
+            auto AH = conj_transpose( Aref );
+            slate::multiply( one, AH, Cref, zero, W );
+
+            slate::TriangularFactors<scalar_t> T;
+            slate::lq_factor( Bref, T );
+            slate::lq_multiply_by_q( slate::Side::Left, slate::Op::NoTrans,
+                                     Bref, T, W );
+
+            real_t error2 = 0;
+            if (k < n) {
+                auto W2 = W.slice( k, n-1, 0, nrhs-1 );
+                error2 = slate::norm( slate::Norm::One, W2 );
+            }
+            if (A_norm != 0 && X_norm != 0)
+                error2 /= A_norm * A_norm * X_norm;
+            error2 /= blas::max( m, n );
+            params.error2() = error2;
+            params.okay() = params.okay() && (error2 <= tol);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gglse(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gglse_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gglse_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gglse_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gglse_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,179 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// A is m-by-n, B is k-by-n; A = U diag( alpha ) X, B = V diag( beta ) X.
+template <typename scalar_t>
+void test_ggsvd_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0, one = 1;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t ib = params.ib();
+    int64_t lookahead = params.lookahead();
+    int64_t panel_threads = params.panel_threads();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.error.name("backward");
+    params.error2();
+    params.error2.name("orth. err");
+    params.time();
+
+    if (! run)
+        return;
+
+    if (! (m >= 1 && k >= 1 && n <= m + k)) {
+        params.msg() = "skipping: ggsvd requires m, k >= 1 and n <= m + k";
+        return;
+    }
+
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib}
+    };
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> B( k, n, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+    slate::generate_matrix( params.matrixB, B );
+
+    slate::Matrix<scalar_t> U( m, n, nb, p, q, MPI_COMM_WORLD );
+    U.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> V( k, n, nb, p, q, MPI_COMM_WORLD );
+    V.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> X( n, n, nb, p, q, MPI_COMM_WORLD );
+    X.insertLocalTiles( origin_target );
+    std::vector<real_t> alpha, beta;
+
+    print_matrix( "A", A, params );
+    print_matrix( "B", B, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    slate::ggsvd( A, B, alpha, beta, U, V, X, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+
+    print_matrix( "U", U, params );
+    print_matrix( "V", V, params );
+    print_matrix( "X", X, params );
+
+    if (check) {
+        //==================================================
+        // Test results by checking the backward error
+        //
+        //      max( || A - U diag( alpha ) X ||_1 / || A ||_1,
+        //           || B - V diag( beta  ) X ||_1 / || B ||_1 )
+        //     -------------------------------------------------- < tol * epsilon
+        //      n
+        //
+        // and the orthogonality of U and V
+        //
+        //      max( || I - U^H U ||_1, || I - V^H V ||_1 ) / n < tol * epsilon.
+        //==================================================
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+        std::vector<real_t> R;
+
+        real_t error = 0;
+        real_t error2 = 0;
+        for (int pass = 0; pass < 2; ++pass) {
+            auto& M = pass == 0 ? A : B;
+            auto& W = pass == 0 ? U : V;
+            auto& s = pass == 0 ? alpha : beta;
+
+            // M = M - W diag( s ) X.
+            real_t M_norm = slate::norm( slate::Norm::One, M );
+            auto Ws = W.emptyLike();
+            Ws.insertLocalTiles();
+            slate::copy( W, Ws );
+            slate::scale_row_col( slate::Equed::Col, R, s, Ws );
+            slate::multiply( -one, Ws, X, one, M );
+            real_t M_error = slate::norm( slate::Norm::One, M );
+            if (M_norm != 0)
+                M_error /= M_norm;
+            error = std::max( error, M_error / n );
+
+            // G = I - W^H W.
+            slate::Matrix<scalar_t> G( n, n, nb, p, q, MPI_COMM_WORLD );
+            G.insertLocalTiles();
+            slate::set( zero, one, G );
+            auto WH = conj_transpose( W );
+            slate::multiply( -one, WH, W, one, G );
+            error2 = std::max( error2, slate::norm( slate::Norm::One, G ) / n );
+        }
+
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error <= tol && error2 <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_ggsvd(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_ggsvd_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_ggsvd_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_ggsvd_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_ggsvd_work<std::complex<double>> (params, run);
+            break;
+    }
+}
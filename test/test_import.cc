@@ -0,0 +1,143 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Exports A to 1D row slabs, either dense or CSR, then imports the slabs
+// into B, and checks that B matches A exactly.
+template <typename scalar_t>
+void test_import_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.time2();
+    params.time.name( "export (s)" );
+    params.time2.name( "import (s)" );
+
+    if (! run)
+        return;
+
+    int mpi_rank, mpi_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+
+    slate::Matrix<scalar_t> B( m, n, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    slate::set( zero, B );
+
+    print_matrix( "A", A, params );
+
+    // 1D block row distribution, as an external application might use.
+    int64_t row_offset = (m * mpi_rank) / mpi_size;
+    int64_t mloc = (m * (mpi_rank + 1)) / mpi_size - row_offset;
+    int64_t lda = std::max( int64_t( 1 ), mloc );
+
+    std::vector<scalar_t> data;
+    std::vector<int64_t> rowptr, colind;
+    std::vector<scalar_t> values;
+
+    //==================================================
+    // Run SLATE test: export A, then import it into B.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (params.routine == "import_dense") {
+        data.resize( lda*n );
+        slate::export_dense( A, row_offset, 0, mloc, n, data.data(), lda );
+    }
+    else {
+        slate::export_csr( A, mloc, row_offset, rowptr, colind, values );
+    }
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (params.routine == "import_dense") {
+        slate::import_dense( row_offset, 0, mloc, n, data.data(), lda, B );
+    }
+    else {
+        slate::import_csr( mloc, row_offset, rowptr.data(), colind.data(),
+                           values.data(), B );
+    }
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time2() = time;
+
+    print_matrix( "B", B, params );
+
+    if (check) {
+        //==================================================
+        // Test results: B - A should be exactly zero.
+        //==================================================
+        real_t A_norm = slate::norm( slate::Norm::One, A );
+        slate::add( -one, A, one, B );
+        real_t error = slate::norm( slate::Norm::One, B );
+        if (A_norm != 0)
+            error /= A_norm;
+
+        params.error() = error;
+        params.okay() = (error == 0);  // redistribution should be exact.
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_import(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_import_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_import_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_import_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_import_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,146 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_io_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.time2();
+
+    if (! run)
+        return;
+
+    slate::FileFormat format = slate::FileFormat::Tiled;
+    if (params.routine == "write_colmajor")
+        format = slate::FileFormat::ColMajor;
+
+    slate::Options const opts =  {
+        {slate::Option::FileFormat, format}
+    };
+
+    int mpi_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+
+    // Read back with a different tile size, to exercise tiles that
+    // straddle the tile boundaries in the file.
+    int64_t nb2 = nb/2 + 1;
+    slate::Matrix<scalar_t> B( m, n, nb2, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+
+    print_matrix( "A", A, params );
+
+    std::string filename = "slate_test_io.dat";
+
+    //==================================================
+    // Run SLATE test: write A, then read it into B.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    slate::write( filename.c_str(), A, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    if (format == slate::FileFormat::Tiled) {
+        int64_t m2, n2, mb2, nb2_;
+        slate::read_header( filename.c_str(), &m2, &n2, &mb2, &nb2_,
+                            MPI_COMM_WORLD );
+        slate_assert( m2 == m && n2 == n );
+        slate_assert( mb2 == std::min( nb, m ) && nb2_ == std::min( nb, n ) );
+    }
+
+    time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    slate::read( filename.c_str(), B, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time2() = time;
+
+    if (mpi_rank == 0)
+        std::remove( filename.c_str() );
+
+    print_matrix( "B", B, params );
+
+    if (check) {
+        //==================================================
+        // Test results: B - A should be exactly zero.
+        // B has different tile sizes, so copy it into A's tiling first.
+        //==================================================
+        slate::Matrix<scalar_t> C( m, n, nb, p, q, MPI_COMM_WORLD );
+        C.insertLocalTiles( origin_target );
+        slate::write( filename.c_str(), B, opts );
+        slate::read( filename.c_str(), C, opts );
+        if (mpi_rank == 0)
+            std::remove( filename.c_str() );
+
+        real_t A_norm = slate::norm( slate::Norm::One, A );
+        slate::add( -one, A, one, C );
+        real_t error = slate::norm( slate::Norm::One, C );
+        if (A_norm != 0)
+            error /= A_norm;
+
+        params.error() = error;
+        params.okay() = (error == 0);  // I/O should be exact.
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_io(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_io_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_io_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_io_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_io_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Stores A in the out-of-core tile files, factors and solves out-of-core,
+// and checks that the solution X, and for posv the factor L, match the
+// in-memory factorization and solve of a copy of A.
+template <typename scalar_t>
+void test_ooc_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    bool is_posv = params.routine == "posv_ooc";
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.time2();
+    params.time2.name( "in-core (s)" );
+
+    if (! run) {
+        if (is_posv)
+            params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // Memory for only one block column, so each block column is a
+    // super-panel and the factors are streamed as often as possible.
+    std::string prefix = "slate_test_ooc";
+    slate::Options const opts =  {
+        {slate::Option::Target, target},
+        {slate::Option::OutOfCoreFile, prefix.c_str()},
+        {slate::Option::OutOfCoreMemory, int64_t( 0 )}
+    };
+
+    int mpi_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( n, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Aref( n, n, nb, p, q, MPI_COMM_WORLD );
+    Aref.insertLocalTiles( origin_target );
+
+    slate::Matrix<scalar_t> B( n, nrhs, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> Bref( n, nrhs, nb, p, q, MPI_COMM_WORLD );
+    Bref.insertLocalTiles( origin_target );
+
+    slate::HermitianMatrix<scalar_t> AH, ArefH;
+    if (is_posv) {
+        AH = slate::HermitianMatrix<scalar_t>( slate::Uplo::Lower, A );
+        ArefH = slate::HermitianMatrix<scalar_t>( slate::Uplo::Lower, Aref );
+        slate::generate_matrix( params.matrix, AH );
+    }
+    else {
+        slate::generate_matrix( params.matrix, A );
+    }
+    slate::generate_matrix( params.matrixB, B );
+    slate::copy( A, Aref );
+    slate::copy( B, Bref );
+
+    print_matrix( "A", A, params );
+
+    slate::Pivots pivots, pivots_ref;
+
+    //==================================================
+    // Run SLATE test: factor and solve out-of-core.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (is_posv) {
+        slate::ooc_store( AH, opts );
+        slate::potrf_ooc( AH, opts );
+        slate::potrs_ooc( AH, B, opts );
+        slate::ooc_load( AH, opts );
+    }
+    else {
+        slate::ooc_store( A, opts );
+        slate::getrf_ooc( A, pivots, opts );
+        slate::getrs_ooc( A, pivots, B, opts );
+        slate::ooc_load( A, opts );
+    }
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    std::remove( (prefix + "." + std::to_string( mpi_rank )).c_str() );
+
+    print_matrix( "X", B, params );
+
+    if (check) {
+        //==================================================
+        // Run in-memory reference.
+        //==================================================
+        time = barrier_get_wtime(MPI_COMM_WORLD);
+
+        if (is_posv) {
+            slate::potrf( ArefH, opts );
+            slate::potrs( ArefH, Bref, opts );
+        }
+        else {
+            slate::getrf( Aref, pivots_ref, opts );
+            slate::getrs( Aref, pivots_ref, Bref, opts );
+        }
+
+        time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+        params.time2() = time;
+
+        //==================================================
+        // Test results: X - Xref, and for posv L - Lref, should be
+        // zero, up to rounding from a different order of operations.
+        //==================================================
+        real_t B_norm = slate::norm( slate::Norm::One, Bref );
+        slate::add( -one, Bref, one, B );
+        real_t error = slate::norm( slate::Norm::One, B ) / B_norm;
+
+        if (is_posv) {
+            slate::TriangularMatrix<scalar_t> L(
+                slate::Uplo::Lower, slate::Diag::NonUnit, A );
+            slate::TriangularMatrix<scalar_t> Lref(
+                slate::Uplo::Lower, slate::Diag::NonUnit, Aref );
+            real_t L_norm = slate::norm( slate::Norm::One, Lref );
+            slate::add( -one, Lref, one, L );
+            error = std::max( error,
+                              slate::norm( slate::Norm::One, L ) / L_norm );
+        }
+
+        params.error() = error;
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+        params.okay() = (error <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_ooc(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_ooc_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_ooc_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_ooc_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_ooc_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// With A Hermitian positive definite and Aplus = A + V V^H,
+// potrf_update modifies the factor of A to the factor of Aplus,
+// and potrf_downdate modifies the factor of Aplus to the factor of A.
+// The result is compared with the factor computed by potrf.
+template <typename scalar_t>
+void test_potrf_update_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    slate::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.ref_time();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (uplo == slate::Uplo::Upper) {
+        params.msg() = "skipping: only Uplo::Lower is supported";
+        return;
+    }
+
+    slate::Options const opts =  {
+        {slate::Option::Target, target}
+    };
+
+    bool downdate = params.routine == "potrf_downdate";
+
+    slate::Target origin_target = origin2target( origin );
+    slate::HermitianMatrix<scalar_t> A( uplo, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::HermitianMatrix<scalar_t> Aplus( uplo, n, nb, p, q, MPI_COMM_WORLD );
+    Aplus.insertLocalTiles( origin_target );
+    slate::Matrix<scalar_t> V( n, k, nb, p, q, MPI_COMM_WORLD );
+    V.insertLocalTiles( origin_target );
+
+    slate::generate_matrix( params.matrix, A );
+    slate::generate_matrix( params.matrixB, V );
+    slate::copy( A, Aplus );
+    slate::rank_k_update( real_t( 1.0 ), V, real_t( 1.0 ), Aplus, opts );
+
+    // Modify the factor of L0 to that of L1.
+    auto& L0 = downdate ? Aplus : A;
+    auto& L1 = downdate ? A : Aplus;
+
+    slate::chol_factor( L0, opts );
+
+    print_matrix( "L0", L0, params );
+    print_matrix( "V", V, params );
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    if (downdate)
+        slate::potrf_downdate( L0, V, opts );
+    else
+        slate::potrf_update( L0, V, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    print_matrix( "L0_out", L0, params );
+
+    if (check) {
+        //==================================================
+        // Test results by comparing with the factor from potrf,
+        //
+        //      || L0 - L1 ||_1 / || L1 ||_1 < tol * epsilon.
+        //
+        // Both factors have positive real diagonal, so they are equal
+        // up to rounding.
+        //==================================================
+        time = barrier_get_wtime(MPI_COMM_WORLD);
+
+        slate::chol_factor( L1, opts );
+
+        params.ref_time() = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+        auto T0 = slate::TriangularMatrix<scalar_t>( slate::Diag::NonUnit, L0 );
+        auto T1 = slate::TriangularMatrix<scalar_t>( slate::Diag::NonUnit, L1 );
+        real_t L1_norm = slate::norm( slate::Norm::One, T1 );
+
+        // T0 = T0 - T1
+        slate::add( -one, T1, one, T0, opts );
+        real_t error = slate::norm( slate::Norm::One, T0 );
+        if (L1_norm != 0)
+            error /= L1_norm;
+
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+        params.error() = error;
+        params.okay() = (error <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_update(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_update_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work<std::complex<double>> (params, run);
+            break;
+    }
+}
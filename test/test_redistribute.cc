@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Redistributes A from a p-by-q grid with tile size nb to B on a 1D column
+// grid with a different tile size, then back into C with A's distribution,
+// and checks that C matches A exactly.
+template <typename scalar_t>
+void test_redistribute_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    bool check = params.check() == 'y';
+    slate::Origin origin = params.origin();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.time2();
+    params.time.name( "to 1D (s)" );
+    params.time2.name( "to 2D (s)" );
+
+    if (! run)
+        return;
+
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, A );
+
+    // Tile size that does not divide nb, so tiles of B straddle tiles of A.
+    int64_t nb2 = nb/2 + 1;
+    slate::Matrix<scalar_t> B( m, n, nb2, 1, p*q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+
+    slate::Matrix<scalar_t> C( m, n, nb, p, q, MPI_COMM_WORLD );
+    C.insertLocalTiles( origin_target );
+
+    print_matrix( "A", A, params );
+
+    //==================================================
+    // Run SLATE test: redistribute A to B, then B to C.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    slate::redistribute( A, B );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+
+    time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    slate::redistribute( B, C );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time2() = time;
+
+    print_matrix( "B", B, params );
+    print_matrix( "C", C, params );
+
+    if (check) {
+        //==================================================
+        // Test results: C - A should be exactly zero.
+        //==================================================
+        real_t A_norm = slate::norm( slate::Norm::One, A );
+        slate::add( -one, A, one, C );
+        real_t error = slate::norm( slate::Norm::One, C );
+        if (A_norm != 0)
+            error /= A_norm;
+
+        params.error() = error;
+        params.okay() = (error == 0);  // redistribution should be exact.
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_redistribute(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_redistribute_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_redistribute_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_redistribute_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_redistribute_work<std::complex<double>> (params, run);
+            break;
+    }
+}
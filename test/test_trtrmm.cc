@@ -0,0 +1,171 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_trtrmm_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using slate::Op;
+
+    // Constants
+    const scalar_t zero = 0.0, one = 1.0;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    // get & mark input values
+    slate::Uplo uplo = params.uplo();
+    slate::Op transA = params.transA();
+    slate::Op transB = params.transB();
+    slate::Diag diag = params.diag();
+    int64_t n = params.dim.n();
+    scalar_t alpha = params.alpha.get<scalar_t>();
+    int p = params.grid.m();
+    int q = params.grid.n();
+    int64_t nb = params.nb();
+    int64_t lookahead = params.lookahead();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target}
+    };
+
+    // A has the given uplo and diag; B has the opposite uplo and is
+    // non-unit, so the defaults (lower, unit) give the L U product of getrf.
+    slate::Uplo uploB = (uplo == slate::Uplo::Lower ? slate::Uplo::Upper
+                                                     : slate::Uplo::Lower);
+    slate::Target origin_target = origin2target( origin );
+    slate::TriangularMatrix<scalar_t> A(
+        uplo, diag, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    generate_matrix( params.matrix, A );
+
+    slate::TriangularMatrix<scalar_t> B(
+        uploB, slate::Diag::NonUnit, n, nb, p, q, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+    generate_matrix( params.matrixB, B );
+
+    slate::Matrix<scalar_t> C( n, n, nb, p, q, MPI_COMM_WORLD );
+    C.insertLocalTiles( origin_target );
+
+    auto opA = A;
+    if (transA == Op::Trans)
+        opA = transpose( A );
+    else if (transA == Op::ConjTrans)
+        opA = conj_transpose( A );
+
+    auto opB = B;
+    if (transB == Op::Trans)
+        opB = transpose( B );
+    else if (transB == Op::ConjTrans)
+        opB = conj_transpose( B );
+
+    print_matrix( "A", A, params );
+    print_matrix( "B", B, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    // C = alpha op(A) op(B).
+    //==================================================
+    slate::trtrmm( alpha, opA, opB, C, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    // A triangular times a triangular of the opposite shape is 2/3 n^3
+    // flops; of the same shape, 1/3 n^3.
+    double nn = double( n );
+    double gflop = (opA.uplo() == opB.uplo() ? 1./3 : 2./3) * nn*nn*nn * 1e-9;
+    if (slate::is_complex<scalar_t>::value)
+        gflop *= 4;
+    params.time() = time;
+    params.gflops() = gflop / time;
+
+    print_matrix( "C", C, params );
+
+    if (check) {
+        //==================================================
+        // Test results by comparing with the product computed by trmm:
+        //
+        //      || C - alpha op(A) op(B) ||_1
+        //     ---------------------------------------- < tol * epsilon
+        //      |alpha| || op(A) ||_1 || op(B) ||_1 N
+        //==================================================
+        // Cref = op(B), densely, then Cref = alpha op(A) Cref.
+        auto Cref = C.emptyLike();
+        Cref.insertLocalTiles();
+        slate::set( zero, one, Cref );
+        slate::trmm( slate::Side::Right, one, opB, Cref, opts );
+        real_t B_norm = slate::norm( slate::Norm::One, Cref );
+        slate::trmm( slate::Side::Left, alpha, opA, Cref, opts );
+
+        auto Aref = C.emptyLike();
+        Aref.insertLocalTiles();
+        slate::set( zero, one, Aref );
+        slate::trmm( slate::Side::Left, one, opA, Aref, opts );
+        real_t A_norm = slate::norm( slate::Norm::One, Aref );
+
+        slate::add( -one, C, one, Cref );
+        params.error() = slate::norm( slate::Norm::One, Cref )
+                       / (std::abs( alpha ) * A_norm * B_norm * n);
+        real_t tol = params.tol() * 0.5 * eps;
+        params.okay() = (params.error() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_trtrmm(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_trtrmm_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_trtrmm_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_trtrmm_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_trtrmm_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -66,6 +66,7 @@ cmds = [
     'test_geset',
     'test_internal_blas',
     #'test_lq', todo hanging on dopamine
+    'test_lu',
     'test_norm',
     #'test_qr',  # todo: failing
 ]
@@ -9,6 +9,9 @@
 #include "unit_test.hh"
 #include "util_matrix.hh"
 
+#include <cstdio>
+#include <string>
+
 using slate::ceildiv;
 using slate::roundup;
 using slate::GridOrder;
@@ -219,18 +222,26 @@ void test_Matrix_lambda()
     int ii = 0;
     for (int i = 0; i < mt; ++i) {
         test_assert( A.tileMb(i) == blas::min( tileMb(i), m - ii ) );
+        test_assert( A.tileRowOffset(i) == ii );
+        test_assert( A.tileRowIndex(ii) == i );
         ii += A.tileMb(i);
+        test_assert( A.tileRowIndex(ii - 1) == i );
     }
     test_assert( ii == m );
+    test_assert( A.tileRowOffset(mt) == m );
 
     // verify nt, tileNb(i), and sum tileNb(i) == n
     int nt = A.nt();
     int jj = 0;
     for (int j = 0; j < nt; ++j) {
         test_assert( A.tileNb(j) == blas::min( tileNb(j), n - jj ) );
+        test_assert( A.tileColOffset(j) == jj );
+        test_assert( A.tileColIndex(jj) == j );
         jj += A.tileNb(j);
+        test_assert( A.tileColIndex(jj - 1) == j );
     }
     test_assert( jj == n );
+    test_assert( A.tileColOffset(nt) == n );
 
     test_assert(A.m() == m);
     test_assert(A.n() == n);
@@ -462,6 +473,115 @@ void test_Matrix_fromDevices()
         delete dev_queues[dev];
 }
 
+//------------------------------------------------------------------------------
+/// fromMappedFile
+/// Test Matrix::fromMappedFile, A(i, j), tileIsLocal, tileMb, tileNb,
+/// and that data written to tiles persists in the file.
+void test_Matrix_fromMappedFile()
+{
+    std::string prefix = "slate_unit_test_mapped";
+    std::string filename = prefix + "." + std::to_string( mpi_rank );
+    std::remove( filename.c_str() );
+
+    {
+        auto A = slate::Matrix<double>::fromMappedFile(
+            m, n, mb, nb, p, q, prefix.c_str(), mpi_comm );
+
+        test_assert(A.mt() == ceildiv(m, mb));
+        test_assert(A.nt() == ceildiv(n, nb));
+        test_assert(A.op() == blas::Op::NoTrans);
+
+        // Tiles are contiguous in the mapping, column-major order of tiles,
+        // and zero in a new file.
+        double* next = nullptr;
+        for (int j = 0; j < A.nt(); ++j) {
+            for (int i = 0; i < A.mt(); ++i) {
+                if (A.tileIsLocal(i, j)) {
+                    auto T = A(i, j);
+                    test_assert(T.mb() == A.tileMb(i));
+                    test_assert(T.nb() == A.tileNb(j));
+                    test_assert(T.stride() == A.tileMb(i));
+                    test_assert(! T.allocated());
+                    if (next != nullptr)
+                        test_assert(T.data() == next);
+                    next = T.data() + T.mb()*T.nb();
+                    test_assert(T(0, 0) == 0.0);
+                    T.at(0, 0) = i + j*1000.;
+                }
+            }
+        }
+    }
+
+    // Map again; data written above must be there.
+    {
+        auto A = slate::Matrix<double>::fromMappedFile(
+            m, n, mb, nb, p, q, prefix.c_str(), mpi_comm );
+        for (int j = 0; j < A.nt(); ++j) {
+            for (int i = 0; i < A.mt(); ++i) {
+                if (A.tileIsLocal(i, j)) {
+                    test_assert(A(i, j)(0, 0) == i + j*1000.);
+                }
+            }
+        }
+    }
+
+    std::remove( filename.c_str() );
+}
+
+//------------------------------------------------------------------------------
+/// fromGenerator
+/// Test Matrix::fromGenerator: tiles are generated on first access,
+/// freed by releaseWorkspace, and generated again.
+void test_Matrix_fromGenerator()
+{
+    auto A = slate::Matrix<double>::fromGenerator(
+        m, n, mb, nb, p, q,
+        [](int64_t row, int64_t col, int64_t mb_, int64_t nb_,
+           double* data, int64_t lda)
+        {
+            for (int64_t jj = 0; jj < nb_; ++jj)
+                for (int64_t ii = 0; ii < mb_; ++ii)
+                    data[ ii + jj*lda ] = (row + ii) + (col + jj)*1000.;
+        },
+        mpi_comm );
+
+    test_assert(A.mt() == ceildiv(m, mb));
+    test_assert(A.nt() == ceildiv(n, nb));
+
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int j = 0; j < A.nt(); ++j) {
+            for (int i = 0; i < A.mt(); ++i) {
+                if (A.tileIsLocal(i, j)) {
+                    test_assert(! A.tileExists(i, j));
+                    A.tileGetForReading(i, j, slate::LayoutConvert::ColMajor);
+                    auto T = A(i, j);
+                    test_assert(T.mb() == A.tileMb(i));
+                    test_assert(T.nb() == A.tileNb(j));
+                    for (int jj = 0; jj < T.nb(); ++jj)
+                        for (int ii = 0; ii < T.mb(); ++ii)
+                            test_assert(T(ii, jj) == (i*mb + ii)
+                                                     + (j*nb + jj)*1000.);
+                }
+            }
+        }
+        A.releaseWorkspace();
+    }
+
+    // A modified tile becomes an origin tile: it survives releaseWorkspace,
+    // and tileUpdateAllOrigin skips the tiles that were never modified.
+    if (A.tileIsLocal(0, 0)) {
+        A.tileGetForWriting(0, 0, slate::LayoutConvert::ColMajor);
+        A(0, 0).at(0, 0) = -1.;
+    }
+    A.releaseWorkspace();
+    A.tileUpdateAllOrigin();
+    if (A.tileIsLocal(0, 0)) {
+        test_assert(A.tileExists(0, 0));
+        test_assert(A(0, 0)(0, 0) == -1.);
+        test_assert(A(0, 0)(1, 0) == 1.);
+    }
+}
+
 //==============================================================================
 // Methods
 
@@ -1438,8 +1558,12 @@ static void verify_slice(
         test_assert( A.nt() == ceildiv( int(A.col0_offset() + col2 - col1 + 1), nb ) );
         int n_ = col1;  // start of tile j
         for (int j = 0; j < A.nt(); ++j) {
+            test_assert( A.tileColOffset( j ) == n_ - col1 );
+            test_assert( A.tileColIndex( n_ - col1 ) == j );
             int m_ = row1;  // start of tile i
             for (int i = 0; i < A.mt(); ++i) {
+                test_assert( A.tileRowOffset( i ) == m_ - row1 );
+                test_assert( A.tileRowIndex( m_ - row1 ) == i );
                 if (A.tileIsLocal( i, j )) {
                     auto T = A.at( i, j );
                     test_assert( T.mb() == A.tileMb( i ) );
@@ -1464,8 +1588,12 @@ static void verify_slice(
         test_assert( A.nt() == ceildiv( int(A.row0_offset() + row2 - row1 + 1), mb ) );
         int n_ = row1;  // start of tile j
         for (int j = 0; j < A.nt(); ++j) {
+            test_assert( A.tileColOffset( j ) == n_ - row1 );
+            test_assert( A.tileColIndex( n_ - row1 ) == j );
             int m_ = col1;  // start of tile i
             for (int i = 0; i < A.mt(); ++i) {
+                test_assert( A.tileRowOffset( i ) == m_ - col1 );
+                test_assert( A.tileRowIndex( m_ - col1 ) == i );
                 if (A.tileIsLocal( i, j )) {
                     auto T = A.at( i, j );
                     test_assert( T.mb() == A.tileMb( i ) );
@@ -2060,6 +2188,8 @@ void run_tests()
     run_test(test_Matrix_fromScaLAPACK,      "Matrix::fromScaLAPACK",      mpi_comm);
     run_test(test_Matrix_fromScaLAPACK_rect, "Matrix::fromScaLAPACK_rect", mpi_comm);
     run_test(test_Matrix_fromDevices,        "Matrix::fromDevices",        mpi_comm);
+    run_test(test_Matrix_fromMappedFile,     "Matrix::fromMappedFile",     mpi_comm);
+    run_test(test_Matrix_fromGenerator,      "Matrix::fromGenerator",      mpi_comm);
 
     if (mpi_rank == 0)
         printf("\nMethods\n");
@@ -637,6 +637,46 @@ void test_bcast_ss()
     test_bcast(32, 32);
 }
 
+//------------------------------------------------------------------------------
+/// Tests pack() and unpack(), from strided to contiguous tile,
+/// with each compression.
+void test_pack_unpack()
+{
+    const int m = 300;  // more than one block per column
+    const int n = 30;
+    int lda = roundup(m, 32);
+    std::vector<double> Adata( lda*n ), Bdata( m*n );
+    slate::Tile<double> A(m, n, Adata.data(), lda, -1, slate::TileKind::UserOwned);
+    slate::Tile<double> B(m, n, Bdata.data(), m,   -1, slate::TileKind::UserOwned);
+    setup_data(A);
+
+    const double tol = 1e-6;
+    for (auto compression : { slate::TileCompression::None,
+                              slate::TileCompression::Lossless,
+                              slate::TileCompression::Lossy }) {
+        clear_data(B);
+        std::vector<uint8_t> buffer;
+        A.pack(compression, tol, buffer);
+        test_assert(buffer.size() <= A.packedMaxBytes());
+        test_assert(buffer.size() == slate::internal::packed_bytes(buffer.data()));
+        B.unpack(buffer.data(), A.layout());
+
+        // Lossy is within the relative error bound; others are exact.
+        double bound = compression == slate::TileCompression::Lossy ? tol : 0;
+        for (int j = 0; j < n; ++j) {
+            for (int i = 0; i < m; ++i) {
+                test_assert(std::abs(B(i, j) - A(i, j)) <= bound*std::abs(A(i, j)));
+            }
+        }
+    }
+
+    // A constant tile compresses to little more than its plane modes.
+    std::fill(Adata.begin(), Adata.end(), 1.5);
+    std::vector<uint8_t> buffer;
+    A.pack(slate::TileCompression::Lossless, 0, buffer);
+    test_assert(buffer.size() < sizeof(double)*m*n / 10);
+}
+
 //------------------------------------------------------------------------------
 /// Tests copyData().
 /// host/device lda is rounded up to multiple of align_host/dev, respectively.
@@ -821,6 +861,9 @@ void run_tests()
             test_print_complex,
             "print, complex");
     }
+    run_test(
+        test_pack_unpack,
+        "pack and unpack, with compression",       MPI_COMM_WORLD);
     run_test(
         test_send_recv_cc,
         "send and recv, contiguous => contiguous", MPI_COMM_WORLD);
@@ -0,0 +1,241 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+
+#include "unit_test.hh"
+#include "../test/print_matrix.hh"
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// globals
+int      g_argc      = 0;
+char**   g_argv      = nullptr;
+int      verbose     = 0;
+int      debug       = 0;
+int      mpi_rank    = -1;
+int      mpi_size    = 0;
+int      num_devices = 0;
+MPI_Comm mpi_comm;
+
+//------------------------------------------------------------------------------
+/// Test getrf with Option::PivotBatch: the pivots must match getrf with
+/// interchanges applied after each panel, and the factors must match up
+/// to rounding, since the trailing updates are done in a different order.
+///
+template <typename scalar_t>
+void test_getrf_pivot_batch_work(
+    int m, int n, int nb, int pivot_batch, int p, int q )
+{
+    if (verbose && mpi_rank == 0) {
+        printf( "%s( m=%3d, n=%3d, nb=%3d, pivot_batch=%d, p=%d, q=%d ) ",
+                __func__, m, n, nb, pivot_batch, p, q );
+    }
+
+    using real_t = blas::real_type<scalar_t>;
+
+    scalar_t one = 1;
+
+    slate::Matrix<scalar_t> A( m, n, nb, p, q, mpi_comm );
+    A.insertLocalTiles();
+
+    // Entries depend only on their global index, so are the same for
+    // any process grid.
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto T = A( i, j );
+                int64_t iseed[4] = { 0, i % 4096, j % 4096, 1 };
+                std::vector<scalar_t> data( T.mb() * T.nb() );
+                lapack::larnv( 2, iseed, data.size(), data.data() );
+                lapack::lacpy( lapack::MatrixType::General, T.mb(), T.nb(),
+                               data.data(), T.mb(), T.data(), T.stride() );
+            }
+        }
+    }
+
+    auto B = A.emptyLike();
+    B.insertLocalTiles();
+    slate::copy( A, B );
+
+    slate::Pivots pivots_A, pivots_B;
+    slate::getrf( A, pivots_A );
+    slate::getrf( B, pivots_B, {
+        { slate::Option::PivotBatch, int64_t( pivot_batch ) }
+    } );
+
+    if (verbose > 1) {
+        slate::print( "LU", A );
+        slate::print( "LU_batch", B );
+    }
+
+    // Pivots must be identical.
+    test_assert( pivots_A.size() == pivots_B.size() );
+    for (size_t k = 0; k < pivots_A.size(); ++k) {
+        test_assert( pivots_A[ k ].size() == pivots_B[ k ].size() );
+        for (size_t i = 0; i < pivots_A[ k ].size(); ++i) {
+            test_assert( pivots_A[ k ][ i ].tileIndex()
+                         == pivots_B[ k ][ i ].tileIndex() );
+            test_assert( pivots_A[ k ][ i ].elementOffset()
+                         == pivots_B[ k ][ i ].elementOffset() );
+        }
+    }
+
+    // Relative error check, || LU - LU_batch || / || LU ||.
+    real_t LU_norm = slate::norm( slate::Norm::One, A );
+    slate::add( -one, A, one, B );
+    real_t error = slate::norm( slate::Norm::One, B ) / LU_norm;
+    if (verbose > 0 && mpi_rank == 0) {
+        printf( "error %.2e\n", error );
+    }
+    real_t eps = std::numeric_limits<real_t>::epsilon();
+    real_t tol = 50 * m * eps;
+    test_assert( error < tol );
+}
+
+//------------------------------------------------------------------------------
+void test_getrf_pivot_batch()
+{
+    // Try all valid combinations of p*q.
+    for (int q = 1; q <= mpi_size; ++q) {
+        int p = mpi_size / q;
+        if (p*q != mpi_size)
+            continue;
+
+        int nb = 8;
+        for (int pivot_batch = 2; pivot_batch <= 3; ++pivot_batch) {
+            // Square, tall, and wide, including partial tiles.
+            for (int m : { 40, 53 }) {
+                for (int n : { 29, 40, 53 }) {
+                    test_getrf_pivot_batch_work< double >(
+                        m, n, nb, pivot_batch, p, q );
+                    test_getrf_pivot_batch_work< std::complex<float> >(
+                        m, n, nb, pivot_batch, p, q );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Similar routine list to testsweeper. No params yet.
+typedef void (*test_func_ptr)();
+
+typedef struct {
+    const char* name;
+    test_func_ptr func;
+    int section;
+} routines_t;
+
+//------------------------------------------------------------------------------
+enum Section {
+    newline = 0,  // zero flag forces newline
+    lu,
+};
+
+//------------------------------------------------------------------------------
+std::vector< routines_t > routines = {
+    { "getrf_pivot_batch", test_getrf_pivot_batch, Section::lu },
+    { "",                  nullptr,                Section::newline },
+};
+
+//------------------------------------------------------------------------------
+// todo: usage as in testsweeper.
+void usage()
+{
+    printf("Usage: %s [routines]\n", g_argv[0]);
+    int col = 0;
+    int last_section = routines[0].section;
+    for (size_t j = 0; j < routines.size(); ++j) {
+        if (routines[j].section != Section::newline &&
+            routines[j].section != last_section)
+        {
+            last_section = routines[j].section;
+            col = 0;
+            printf("\n");
+        }
+        if (routines[j].name)
+            printf("    %-20s", routines[j].name);
+        col += 1;
+        if (col == 3 || routines[j].section == Section::newline) {
+            col = 0;
+            printf("\n");
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    // Parse global options -h, -v, -d.
+    int i;
+    for (i = 1; i < g_argc; ++i) {
+        std::string arg = g_argv[i];
+        if (arg == "-h" || arg == "--help") {
+            usage();
+            return;
+        }
+        else if (arg == "-v" || arg == "--verbose") {
+            ++verbose;
+            continue;
+        }
+        else if (arg == "-d" || arg == "--debug") {
+            ++debug;
+            continue;
+        }
+        else {
+            break;
+        }
+    }
+
+    // Remaining options are tests to run.
+    if (i == g_argc) {
+        // Run all tests.
+        for (size_t j = 0; j < routines.size(); ++j)
+            if (routines[j].func != nullptr)
+                run_test(routines[j].func, routines[j].name, MPI_COMM_WORLD);
+    }
+    else {
+        // Run tests mentioned on command line.
+        for (/* continued */; i < g_argc; ++i) {
+            std::string arg = g_argv[i];
+            bool found = false;
+            for (size_t j = 0; j < routines.size(); ++j) {
+                if (arg == routines[j].name) {
+                    run_test(routines[j].func, routines[j].name, MPI_COMM_WORLD);
+                    found = true;
+                }
+            }
+            if (! found) {
+                usage();
+                printf("Unknown routine: %s\n", g_argv[i]);
+            }
+        }
+    }
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    g_argc = argc;
+    g_argv = argv;
+    MPI_Init(&argc, &argv);
+    mpi_comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(mpi_comm, &mpi_rank);
+    MPI_Comm_size(mpi_comm, &mpi_size);
+
+    num_devices = blas::get_device_count();
+
+    int err = unit_test_main(mpi_comm);  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}